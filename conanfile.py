@@ -37,21 +37,32 @@ class ArcheConan (ConanFile):
     def _run_tests (self):
         return tools.get_env('CONAN_RUN_TESTS', default = False)
 
+    @property
+    def _run_benchmarks (self):
+        return tools.get_env('CONAN_RUN_BENCHMARKS', default = False)
+
     def build_requirements (self):
         if self._run_tests:
             self.test_requires('catch2/2.13.9')
             self.test_requires('trompeloeil/42')
+        if self._run_benchmarks:
+            self.test_requires('benchmark/1.7.1')
 
     def config_options (self):
         if self.settings.arch == 'avr':
             del self.options.fPIC
 
     def build (self):
-        if self._run_tests:
+        if self._run_tests or self._run_benchmarks:
             cmake = CMake(self)
+            cmake.definitions['BUILD_TESTING'] = bool(self._run_tests)
+            cmake.definitions['BUILD_BENCHMARKS'] = bool(self._run_benchmarks)
             cmake.configure()
             cmake.build()
-            cmake.test()
+            if self._run_tests:
+                cmake.test()
+            if self._run_benchmarks:
+                cmake.build(target = 'bench_json')
 
     def package (self):
         self.copy('*.hpp')
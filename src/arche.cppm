@@ -0,0 +1,102 @@
+// Interface of the `arche` C++20 named module, built by the arche_module
+// target when ARCHE_BUILD_MODULE is on. It exports every public header of
+// arche and exfs (except those under testing/, which depend on Catch2 and
+// trompeloeil), so that a translation unit can `import arche;` instead of
+// parsing the concept and trait hierarchies of the headers again.
+//
+// The headers are included into the module purview inside an export block;
+// the standard and intrinsic headers they depend on are included first, in
+// the global module fragment, so that they are not attached to the module.
+// CMake checks that every public header is listed below.
+//
+// With GCC, importers which placement-new into exfs storage must include
+// <new> themselves, and must be compiled with the same target flags (such as
+// -mavx2) as the module.
+module;
+
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#if __STDC_HOSTED__
+#include <memory_resource>
+#endif  // __STDC_HOSTED__
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+export module arche;
+
+export {
+#include "arche/Bitset.hpp"
+#include "arche/Fixed.hpp"
+#include "arche/Register.hpp"
+#include "arche/Register_Clock.hpp"
+#include "arche/concepts/Register.hpp"
+#include "arche/dsp/Biquad_Cascade.hpp"
+#include "arche/dsp/Fir_Filter.hpp"
+#include "arche/fixed_kernels.hpp"
+#include "arche/int_literals.hpp"
+#include "exfs/algorithm/bitwise.hpp"
+#include "exfs/algorithm/byte_search.hpp"
+#include "exfs/algorithm/compare.hpp"
+#include "exfs/algorithm/copy.hpp"
+#include "exfs/algorithm/count.hpp"
+#include "exfs/algorithm/fill.hpp"
+#include "exfs/algorithm/find.hpp"
+#include "exfs/algorithm/sort.hpp"
+#include "exfs/bitmap_set.hpp"
+#include "exfs/concepts.hpp"
+#include "exfs/inplace_function.hpp"
+#include "exfs/intrusive_list.hpp"
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/counted_iterator.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/iterator/legacy.hpp"
+#include "exfs/iterator/models.hpp"
+#include "exfs/iterator/move_iterator.hpp"
+#include "exfs/iterator/operations.hpp"
+#include "exfs/iterator/reverse_iterator.hpp"
+#include "exfs/iterator/sentinels.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/memory/arena.hpp"
+#include "exfs/memory/storage.hpp"
+#include "exfs/optional.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/adaptor.hpp"
+#include "exfs/ranges/all.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/drop.hpp"
+#include "exfs/ranges/filter.hpp"
+#include "exfs/ranges/operations.hpp"
+#include "exfs/ranges/take.hpp"
+#include "exfs/ranges/transform.hpp"
+#include "exfs/ranges/view_interface.hpp"
+#include "exfs/ranges/zip.hpp"
+#include "exfs/static_priority_queue.hpp"
+#include "exfs/static_soa_vector.hpp"
+#include "exfs/static_vector.hpp"
+#include "exfs/utility/comparison.hpp"
+#include "exfs/utility/compressed_pair.hpp"
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/in_place.hpp"
+#include "exfs/utility/integer_sequence.hpp"
+#include "exfs/utility/pair.hpp"
+#include "exfs/utility/simd.hpp"
+#include "exfs/utility/tuple.hpp"
+#include "exfs/variant.hpp"
+}
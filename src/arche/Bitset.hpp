@@ -1,6 +1,7 @@
 #ifndef ARCHE_BITSET_HPP_
 #define ARCHE_BITSET_HPP_
 
+#include <bit>
 #include <concepts>
 
 namespace arche {
@@ -100,7 +101,19 @@ class Bitset {
             "Bit index must be within the specified size of the bitset."
         );
 
-        return Bitset{static_cast<Underlying>(1 << bit_index)};
+        return Bitset{static_cast<Underlying>(Underlying{1} << bit_index)};
+    }
+
+    /**
+     * Create a new @c Bitset with the specified bit set and all others unset.
+     *
+     * @warning It is undefined behavior if @p bit_index is not less than @p
+     *     t_bit_count.
+     *
+     * @param[in] bit_index The index of the bit to set.
+     */
+    static constexpr Bitset bit (unsigned bit_index) {
+        return Bitset{static_cast<Underlying>(Underlying{1} << bit_index)};
     }
 
     /**
@@ -119,6 +132,61 @@ class Bitset {
         return value_;
     }
 
+    /**
+     * Check whether the bit at @p bit_index is set.
+     *
+     * @warning It is undefined behavior if @p bit_index is not less than @p
+     *     t_bit_count.
+     */
+    constexpr bool test (unsigned bit_index) const {
+        return (value_ >> bit_index) & 1u;
+    }
+
+    /**
+     * Get the number of bits which are set.
+     */
+    constexpr int count () const {
+        return std::popcount(value_);
+    }
+
+    /**
+     * Check whether no bits are set.
+     */
+    constexpr bool none () const {
+        return value_ == 0u;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Bitwise Operators
+     *
+     * These operate on the whole underlying value at once. The complement
+     * only flips the bits used by the @c Bitset.
+     *
+     * @{
+     */
+
+    friend constexpr Bitset operator | (Bitset lhs, Bitset rhs) {
+        return Bitset{static_cast<Underlying>(lhs.value_ | rhs.value_)};
+    }
+
+    friend constexpr Bitset operator & (Bitset lhs, Bitset rhs) {
+        return Bitset{static_cast<Underlying>(lhs.value_ & rhs.value_)};
+    }
+
+    friend constexpr Bitset operator ^ (Bitset lhs, Bitset rhs) {
+        return Bitset{static_cast<Underlying>(lhs.value_ ^ rhs.value_)};
+    }
+
+    friend constexpr Bitset operator ~ (Bitset set) {
+        return Bitset{static_cast<Underlying>(~set.value_)};
+    }
+
+    friend constexpr bool operator == (Bitset, Bitset) = default;
+
     /**
      * @}
      */
@@ -15,7 +15,8 @@ using Bitset_Types = std::tuple<
     arche::Bitset<7u, std::uint32_t>,
     arche::Bitset<16u, std::uint32_t>,
     arche::Bitset<29u, std::uint32_t>,
-    arche::Bitset<32u, std::uint32_t>
+    arche::Bitset<32u, std::uint32_t>,
+    arche::Bitset<64u, std::uint64_t>
 >;
 
 SCENARIO (
@@ -176,3 +177,57 @@ TEMPLATE_LIST_TEST_CASE (
         }
     }
 }
+
+TEMPLATE_LIST_TEST_CASE (
+    "arche::Bitset - runtime bit access",
+    "[unit][Bitset]",
+    Bitset_Types
+) {
+    GIVEN ("a Bitset with some bits set") {
+        auto const last = TestType::bit_count - 1u;
+        TestType const test_obj =
+            TestType::bit(0u) | TestType::bit(3u) | TestType::bit(last);
+
+        THEN ("test() reports exactly those bits") {
+            CHECK(test_obj.test(0u));
+            CHECK(not test_obj.test(1u));
+            CHECK(test_obj.test(3u));
+            CHECK(test_obj.test(last));
+            CHECK(test_obj.count() == 3);
+            CHECK(not test_obj.none());
+            CHECK(TestType{}.none());
+        }
+
+        THEN ("the runtime bit() matches the compile-time bit()") {
+            CHECK(TestType::bit(3u) == TestType::template bit<3u>());
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE (
+    "arche::Bitset - bitwise operators",
+    "[unit][Bitset]",
+    Bitset_Types
+) {
+    using Underlying = typename TestType::Underlying;
+
+    GIVEN ("two Bitsets") {
+        constexpr TestType lhs{static_cast<Underlying>(0b0110'1100u)};
+        constexpr TestType rhs{static_cast<Underlying>(0b0101'0101u)};
+
+        THEN ("the operators combine the whole value at once") {
+            CHECK((lhs | rhs).value() == (0b0111'1101u & lhs.used_bits_mask()));
+            CHECK((lhs & rhs).value() == (0b0100'0100u & lhs.used_bits_mask()));
+            CHECK((lhs ^ rhs).value() == (0b0011'1001u & lhs.used_bits_mask()));
+            CHECK(lhs == lhs);
+            CHECK(lhs != rhs);
+        }
+
+        THEN ("the complement only flips the used bits") {
+            CHECK((~lhs).value() == (
+                static_cast<Underlying>(~lhs.value()) & lhs.used_bits_mask()
+            ));
+            CHECK((~TestType{}).value() == TestType::used_bits_mask());
+        }
+    }
+}
@@ -0,0 +1,256 @@
+#include "arche/Fixed.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "arche/fixed_kernels.hpp"
+
+namespace {
+// Each fixed-point operation is compared with the float code it replaces,
+// on the same values. Throughput is reported in values per second, and the
+// largest error of each result against a double-precision reference in the
+// "max_error" counter, in units of the value (not of the last place).
+//
+// On a host with an FPU, float is fast; these show what the integer code
+// costs relative to it, and the accuracy given up. On cores without an FPU
+// each float operation is a call into a soft-float library instead.
+
+// Reproducible values spread over [-1, 1), as Q15 and as float.
+struct Signal {
+    std::vector<arche::Q15> fixed;
+    std::vector<float> floating;
+
+    explicit Signal (std::size_t size, std::uint32_t seed) {
+        for (std::size_t i = 0u; i < size; ++i) {
+            seed = seed * 1'664'525u + 1'013'904'223u;
+            auto const value = arche::Q15::from_raw(
+                static_cast<std::int16_t>(seed >> 16)
+            );
+            fixed.push_back(value);
+            floating.push_back(static_cast<float>(value));
+        }
+    }
+};
+
+// Positive values spread over (0, 128), as Q16.16 and as float.
+struct Positive_Signal {
+    std::vector<arche::Q16_16> fixed;
+    std::vector<float> floating;
+
+    explicit Positive_Signal (std::size_t size, std::uint32_t seed) {
+        for (std::size_t i = 0u; i < size; ++i) {
+            seed = seed * 1'664'525u + 1'013'904'223u;
+            auto const value = arche::Q16_16::from_raw(
+                static_cast<std::int32_t>(seed >> 9) + 1
+            );
+            fixed.push_back(value);
+            floating.push_back(static_cast<float>(value));
+        }
+    }
+};
+
+double exact_dot (Signal const& lhs, Signal const& rhs) {
+    double sum = 0.0;
+    for (std::size_t i = 0u; i < lhs.fixed.size(); ++i) {
+        sum += static_cast<double>(lhs.fixed[i])
+            * static_cast<double>(rhs.fixed[i]);
+    }
+    return sum;
+}
+
+float float_dot (Signal const& lhs, Signal const& rhs) {
+    float sum = 0.0f;
+    for (std::size_t i = 0u; i < lhs.floating.size(); ++i) {
+        sum += lhs.floating[i] * rhs.floating[i];
+    }
+    return sum;
+}
+
+void fixed_dot_float (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    Signal const lhs{size, 1u};
+    Signal const rhs{size, 2u};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(float_dot(lhs, rhs));
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+    state.counters["max_error"] = std::fabs(
+        static_cast<double>(float_dot(lhs, rhs)) - exact_dot(lhs, rhs)
+    );
+}
+BENCHMARK(fixed_dot_float)->Arg(64)->Arg(1024)->Arg(16384);
+
+void fixed_dot_scalar (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    Signal const lhs{size, 1u};
+    Signal const rhs{size, 2u};
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0u; i < size; ++i) {
+            sum += std::int64_t{lhs.fixed[i].raw()} * rhs.fixed[i].raw();
+            benchmark::DoNotOptimize(sum);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(fixed_dot_scalar)->Arg(64)->Arg(1024)->Arg(16384);
+
+void fixed_dot_kernel (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    Signal const lhs{size, 1u};
+    Signal const rhs{size, 2u};
+    auto const dot = [&] {
+        return arche::dot(
+            lhs.fixed.data(),
+            lhs.fixed.data() + size,
+            rhs.fixed.data()
+        );
+    };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs.fixed.data());
+        benchmark::DoNotOptimize(dot());
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+    state.counters["max_error"] = std::fabs(
+        static_cast<double>(dot()) - exact_dot(lhs, rhs)
+    );
+}
+BENCHMARK(fixed_dot_kernel)->Arg(64)->Arg(1024)->Arg(16384);
+
+void fixed_scale_float (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    Signal const signal{size, 3u};
+    float const factor = 0.7071f;
+    std::vector<float> out(size);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < size; ++i) {
+            out[i] = signal.floating[i] * factor;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(fixed_scale_float)->Arg(64)->Arg(1024)->Arg(16384);
+
+void fixed_scale_kernel (benchmark::State& state) {
+    using namespace arche::fixed_literals;
+
+    auto const size = static_cast<std::size_t>(state.range(0));
+    Signal const signal{size, 3u};
+    auto const factor = 0.7071_q15;
+    std::vector<arche::Q15> out(size);
+
+    for (auto _ : state) {
+        arche::scale(
+            signal.fixed.data(),
+            signal.fixed.data() + size,
+            out.data(),
+            factor
+        );
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+    double max_error = 0.0;
+    for (std::size_t i = 0u; i < size; ++i) {
+        auto const exact = static_cast<double>(signal.fixed[i]) * 0.7071;
+        max_error = std::fmax(
+            max_error,
+            std::fabs(static_cast<double>(out[i]) - exact)
+        );
+    }
+    state.counters["max_error"] = max_error;
+}
+BENCHMARK(fixed_scale_kernel)->Arg(64)->Arg(1024)->Arg(16384);
+
+// Applies the operation to each value of a signal, and reports the largest
+// error against the double-precision function.
+template <typename Operation, typename Values, typename Exact>
+void run_elementwise (
+    benchmark::State& state,
+    Values const& values,
+    Operation operation,
+    Exact exact
+) {
+    using Value = typename Values::value_type;
+    std::vector<Value> out(values.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < values.size(); ++i) {
+            out[i] = operation(values[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+    double max_error = 0.0;
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        auto const expected = exact(static_cast<double>(values[i]));
+        max_error = std::fmax(
+            max_error,
+            std::fabs(static_cast<double>(out[i]) - expected)
+        );
+    }
+    state.counters["max_error"] = max_error;
+}
+
+constexpr std::size_t elementwise_size = 1024u;
+
+void fixed_reciprocal_float (benchmark::State& state) {
+    Positive_Signal const signal{elementwise_size, 4u};
+    run_elementwise(
+        state,
+        signal.floating,
+        [] (float value) { return 1.0f / value; },
+        [] (double value) { return 1.0 / value; }
+    );
+}
+BENCHMARK(fixed_reciprocal_float);
+
+void fixed_reciprocal (benchmark::State& state) {
+    Positive_Signal const signal{elementwise_size, 4u};
+    run_elementwise(
+        state,
+        signal.fixed,
+        [] (arche::Q16_16 value) { return arche::reciprocal(value); },
+        // Reciprocals of values below 2^-15 saturate.
+        [] (double value) { return std::fmin(1.0 / value, 32'768.0); }
+    );
+}
+BENCHMARK(fixed_reciprocal);
+
+void fixed_sqrt_float (benchmark::State& state) {
+    Positive_Signal const signal{elementwise_size, 5u};
+    run_elementwise(
+        state,
+        signal.floating,
+        [] (float value) { return std::sqrt(value); },
+        [] (double value) { return std::sqrt(value); }
+    );
+}
+BENCHMARK(fixed_sqrt_float);
+
+void fixed_sqrt (benchmark::State& state) {
+    Positive_Signal const signal{elementwise_size, 5u};
+    run_elementwise(
+        state,
+        signal.fixed,
+        [] (arche::Q16_16 value) { return arche::sqrt(value); },
+        [] (double value) { return std::sqrt(value); }
+    );
+}
+BENCHMARK(fixed_sqrt);
+}  // namespace
@@ -0,0 +1,688 @@
+#ifndef ARCHE_FIXED_HPP_
+#define ARCHE_FIXED_HPP_
+
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace arche {
+/**
+ * Selects what the arithmetic of a @c Fixed does with a result which is out
+ * of range.
+ */
+enum class Overflow_Mode {
+    /**
+     * The result wraps around modulo 2^width, like unsigned integer
+     * arithmetic. This is the cheapest mode, and suits accumulators with
+     * enough guard bits that they never overflow.
+     */
+    wrap,
+
+    /**
+     * The result is clamped to [lowest(), max()], as most DSP instruction
+     * sets do, so that an overflowing filter clips instead of inverting.
+     */
+    saturate,
+};
+
+namespace __detail {
+/**
+ * The smallest standard signed integer type with at least @p t_bits bits.
+ */
+template <int t_bits>
+using __fixed_rep_t = std::conditional_t<t_bits <= 8, std::int8_t,
+    std::conditional_t<t_bits <= 16, std::int16_t,
+    std::conditional_t<t_bits <= 32, std::int32_t, std::int64_t>>>;
+
+/**
+ * Convert @p raw, an exact raw value of @p T_Fixed which may be out of range,
+ * to @p T_Fixed according to its overflow mode.
+ */
+template <typename T_Fixed>
+constexpr T_Fixed __narrow (std::int64_t raw) noexcept {
+    using Rep = typename T_Fixed::Rep;
+    if constexpr (T_Fixed::width == 64) {
+        return T_Fixed::from_raw(raw);
+    } else if constexpr (T_Fixed::overflow_mode == Overflow_Mode::saturate) {
+        if (raw > T_Fixed::raw_max) {
+            return T_Fixed::max();
+        }
+        if (raw < T_Fixed::raw_min) {
+            return T_Fixed::lowest();
+        }
+        return T_Fixed::from_raw(static_cast<Rep>(raw));
+    } else {
+        // Keep the low `width` bits, and extend the sign bit of those.
+        constexpr int unused_bits = 64 - T_Fixed::width;
+        auto const shifted = static_cast<std::int64_t>(
+            static_cast<std::uint64_t>(raw) << unused_bits
+        );
+        return T_Fixed::from_raw(static_cast<Rep>(shifted >> unused_bits));
+    }
+}
+
+/**
+ * Shift @p raw right by @p shift bits, rounding to nearest with ties toward
+ * positive infinity.
+ */
+constexpr std::int64_t __round_shift (std::int64_t raw, int shift) noexcept {
+    if (shift <= 0) {
+        return raw;
+    }
+    return ((raw >> (shift - 1)) + 1) >> 1;
+}
+}  // namespace __detail
+
+/**
+ * A signed binary fixed-point number with @p t_int_bits integer bits and @p
+ * t_frac_bits fractional bits.
+ *
+ * The value of a @c Fixed is its raw integer representation divided by
+ * 2^t_frac_bits. The integer bits include the sign bit, so that the
+ * representation is @c t_int_bits + @c t_frac_bits bits wide and the range of
+ * values is [-2^(t_int_bits-1), 2^(t_int_bits-1)). For example, the Q15 format
+ * is @c Fixed<1,15>, which is 16 bits wide and holds values in [-1, 1).
+ *
+ * Values are best written with the literals of @c arche::fixed_literals, which
+ * are converted to the raw representation at compile time using only integer
+ * arithmetic, so that tables of constants pull in no floating-point code.
+ *
+ * The arithmetic operators only use integer instructions, which on cores
+ * without an FPU are many times faster than software floating point.
+ * Multiplication rounds the exact product to nearest (ties toward positive
+ * infinity), as a rounding right shift of the double-width product. Results
+ * which are out of range wrap or saturate according to @p t_overflow.
+ * Multiplication, @c reciprocal() and @c sqrt() need a representation of at
+ * most 32 bits, so that the intermediate products fit in 64 bits.
+ *
+ * @tparam t_int_bits The number of integer bits, including the sign bit.
+ * @tparam t_frac_bits The number of fractional bits.
+ * @tparam T_Rep The signed integer type of the raw representation. Must have
+ *     at least @c t_int_bits + @c t_frac_bits bits; defaults to the smallest
+ *     such fixed-width type.
+ * @tparam t_overflow What arithmetic does with results which are out of range.
+ */
+template <
+    int t_int_bits,
+    int t_frac_bits,
+    std::signed_integral T_Rep =
+        __detail::__fixed_rep_t<t_int_bits + t_frac_bits>,
+    Overflow_Mode t_overflow = Overflow_Mode::saturate
+>
+class Fixed {
+    static_assert(t_int_bits >= 1, "The integer bits include the sign bit.");
+    static_assert(t_frac_bits >= 0, "The fractional bits cannot be negative.");
+    static_assert(
+        t_int_bits + t_frac_bits <= std::numeric_limits<T_Rep>::digits + 1,
+        "T_Rep must have at least t_int_bits + t_frac_bits bits."
+    );
+
+  public:
+    /**
+     * The type of the raw representation.
+     */
+    using Rep = T_Rep;
+
+    /**
+     * The number of integer bits, including the sign bit.
+     */
+    static constexpr int int_bits = t_int_bits;
+
+    /**
+     * The number of fractional bits.
+     */
+    static constexpr int frac_bits = t_frac_bits;
+
+    /**
+     * The number of bits of the raw representation which are used.
+     */
+    static constexpr int width = t_int_bits + t_frac_bits;
+
+    /**
+     * What arithmetic does with results which are out of range.
+     */
+    static constexpr Overflow_Mode overflow_mode = t_overflow;
+
+    /**
+     * The largest raw representation.
+     */
+    static constexpr Rep raw_max = static_cast<Rep>(
+        (std::uint64_t{1} << (width - 1)) - 1u
+    );
+
+    /**
+     * The smallest (most negative) raw representation.
+     */
+    static constexpr Rep raw_min = static_cast<Rep>(-raw_max - 1);
+
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Construct a @c Fixed with the value zero.
+     */
+    constexpr Fixed () noexcept = default;
+
+    /**
+     * Construct a @c Fixed with the value of the integer @p value.
+     *
+     * This is only available for integer types which the integer bits can
+     * always represent exactly, such as @c std::int16_t for @c Q16_16, so
+     * that the checked literals of @c arche::int_literals can be used in
+     * fixed-point expressions, as in @c gain * 3_i8.
+     */
+    template <std::integral T>
+        requires (
+            not std::same_as<T, bool> and
+            std::numeric_limits<T>::digits <= t_int_bits - 1
+        )
+    constexpr Fixed (T value) noexcept
+          : raw_{static_cast<Rep>(static_cast<Rep>(value) << t_frac_bits)} {}
+
+    /**
+     * Convert @p value from another fixed-point format, rounding to nearest
+     * (ties toward positive infinity) when this format has fewer fractional
+     * bits. A value which is out of range wraps or saturates according to the
+     * overflow mode of this format.
+     */
+    template <
+        int t_other_int_bits,
+        int t_other_frac_bits,
+        typename T_Other_Rep,
+        Overflow_Mode t_other_overflow
+    >
+        requires (not std::same_as<
+            Fixed,
+            Fixed<
+                t_other_int_bits,
+                t_other_frac_bits,
+                T_Other_Rep,
+                t_other_overflow
+            >
+        >)
+    explicit constexpr Fixed (Fixed<
+        t_other_int_bits,
+        t_other_frac_bits,
+        T_Other_Rep,
+        t_other_overflow
+    > value) noexcept {
+        constexpr int shift = t_frac_bits - t_other_frac_bits;
+        auto const raw = static_cast<std::int64_t>(value.raw());
+        if constexpr (shift <= 0) {
+            *this = __detail::__narrow<Fixed>(
+                __detail::__round_shift(raw, -shift)
+            );
+        } else if constexpr (t_overflow == Overflow_Mode::wrap) {
+            *this = __detail::__narrow<Fixed>(static_cast<std::int64_t>(
+                static_cast<std::uint64_t>(raw) << shift
+            ));
+        } else if (raw > (std::numeric_limits<std::int64_t>::max() >> shift)) {
+            *this = max();
+        } else if (raw < (std::numeric_limits<std::int64_t>::min() >> shift)) {
+            *this = lowest();
+        } else {
+            *this = __detail::__narrow<Fixed>(raw << shift);
+        }
+    }
+
+    /**
+     * Convert the floating-point @p value to the nearest @c Fixed, saturating
+     * values which are out of range. NaN converts to zero.
+     *
+     * This pulls in floating-point code, which is slow on cores without an
+     * FPU; it is meant for host-side code and tests. Constants are better
+     * written with the literals of @c arche::fixed_literals.
+     */
+    template <std::floating_point T>
+    explicit constexpr Fixed (T value) noexcept {
+        auto const scaled =
+            value * static_cast<T>(std::uint64_t{1} << frac_bits);
+        if (scaled != scaled) {
+            raw_ = 0;
+        } else if (scaled >= static_cast<T>(raw_max)) {
+            raw_ = raw_max;
+        } else if (scaled <= static_cast<T>(raw_min)) {
+            raw_ = raw_min;
+        } else {
+            raw_ = static_cast<Rep>(
+                scaled < T{0} ? scaled - T{0.5} : scaled + T{0.5}
+            );
+        }
+    }
+
+    /**
+     * Create a @c Fixed from its raw representation.
+     *
+     * @warning It is undefined behavior if @p raw is not in [raw_min,
+     *     raw_max].
+     */
+    static constexpr Fixed from_raw (Rep raw) noexcept {
+        Fixed result;
+        result.raw_ = raw;
+        return result;
+    }
+
+    /**
+     * The most negative value.
+     */
+    static constexpr Fixed lowest () noexcept {
+        return from_raw(raw_min);
+    }
+
+    /**
+     * The largest value.
+     */
+    static constexpr Fixed max () noexcept {
+        return from_raw(raw_max);
+    }
+
+    /**
+     * The smallest positive value, 2^-t_frac_bits.
+     */
+    static constexpr Fixed epsilon () noexcept {
+        return from_raw(Rep{1});
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Read-only access to the raw representation.
+     */
+    constexpr Rep raw () const noexcept {
+        return raw_;
+    }
+
+    /**
+     * Convert to the nearest floating-point value.
+     *
+     * Like the floating-point constructor, this is meant for host-side code
+     * and tests.
+     */
+    template <std::floating_point T>
+    explicit constexpr operator T () const noexcept {
+        return static_cast<T>(raw_)
+            / static_cast<T>(std::uint64_t{1} << frac_bits);
+    }
+
+    /**
+     * @name Arithmetic Operators
+     *
+     * The results wrap or saturate according to @c overflow_mode.
+     *
+     * @{
+     */
+
+    friend constexpr Fixed operator - (Fixed value) noexcept {
+        if constexpr (width == 64) {
+            if (value.raw_ == raw_min) {
+                return t_overflow == Overflow_Mode::wrap ? lowest() : max();
+            }
+        }
+        return __detail::__narrow<Fixed>(
+            -static_cast<std::int64_t>(value.raw_)
+        );
+    }
+
+    friend constexpr Fixed operator + (Fixed lhs, Fixed rhs) noexcept {
+        if constexpr (width == 64) {
+            Rep sum;
+            if (__builtin_add_overflow(lhs.raw_, rhs.raw_, &sum)
+                and t_overflow == Overflow_Mode::saturate) {
+                return lhs.raw_ < 0 ? lowest() : max();
+            }
+            return from_raw(sum);
+        } else {
+            return __detail::__narrow<Fixed>(
+                static_cast<std::int64_t>(lhs.raw_) + rhs.raw_
+            );
+        }
+    }
+
+    friend constexpr Fixed operator - (Fixed lhs, Fixed rhs) noexcept {
+        if constexpr (width == 64) {
+            Rep difference;
+            if (__builtin_sub_overflow(lhs.raw_, rhs.raw_, &difference)
+                and t_overflow == Overflow_Mode::saturate) {
+                return lhs.raw_ < 0 ? lowest() : max();
+            }
+            return from_raw(difference);
+        } else {
+            return __detail::__narrow<Fixed>(
+                static_cast<std::int64_t>(lhs.raw_) - rhs.raw_
+            );
+        }
+    }
+
+    friend constexpr Fixed operator * (Fixed lhs, Fixed rhs) noexcept
+        requires (width <= 32) {
+        return __detail::__narrow<Fixed>(__detail::__round_shift(
+            static_cast<std::int64_t>(lhs.raw_) * rhs.raw_,
+            t_frac_bits
+        ));
+    }
+
+    /**
+     * Multiply by an integer, exactly except for overflow.
+     */
+    template <std::integral T>
+        requires (width <= 32 and sizeof(T) <= 4u)
+    friend constexpr Fixed operator * (Fixed lhs, T rhs) noexcept {
+        return __detail::__narrow<Fixed>(
+            static_cast<std::int64_t>(lhs.raw_) * static_cast<std::int64_t>(rhs)
+        );
+    }
+
+    template <std::integral T>
+        requires (width <= 32 and sizeof(T) <= 4u)
+    friend constexpr Fixed operator * (T lhs, Fixed rhs) noexcept {
+        return rhs * lhs;
+    }
+
+    constexpr Fixed& operator += (Fixed rhs) noexcept {
+        return *this = *this + rhs;
+    }
+
+    constexpr Fixed& operator -= (Fixed rhs) noexcept {
+        return *this = *this - rhs;
+    }
+
+    constexpr Fixed& operator *= (Fixed rhs) noexcept requires (width <= 32) {
+        return *this = *this * rhs;
+    }
+
+    /**
+     * @}
+     */
+
+    friend constexpr bool operator == (Fixed, Fixed) = default;
+    friend constexpr auto operator <=> (Fixed, Fixed) = default;
+
+  private:
+    Rep raw_ = 0;
+};
+
+/**
+ * @name Common Q formats
+ *
+ * Qm.n has m integer bits, including the sign bit, and n fractional bits; Qn
+ * is short for Q1.n.
+ *
+ * @{
+ */
+using Q7 = Fixed<1, 7>;
+using Q15 = Fixed<1, 15>;
+using Q31 = Fixed<1, 31>;
+using Q2_14 = Fixed<2, 14>;
+using Q8_8 = Fixed<8, 8>;
+using Q16_16 = Fixed<16, 16>;
+/**
+ * @}
+ */
+
+namespace __detail {
+/**
+ * Approximate 1/m, for m in [0.5, 1) given in Q0.32, as a Q2.30 value in
+ * (1, 2].
+ *
+ * Starting from the linear approximation 48/17 - 32/17 m, whose relative error
+ * is at most 1/17, each Newton-Raphson step y' = y (2 - m y) squares the error,
+ * so three steps leave only the rounding error of the arithmetic, within 2
+ * units of 2^-30.
+ */
+constexpr std::uint64_t __reciprocal_q30 (std::uint64_t m) noexcept {
+    std::uint64_t y = 3'031'741'621u - ((2'021'161'080u * m) >> 32);
+    for (int step = 0; step < 3; ++step) {
+        y = (y * ((std::uint64_t{1} << 31) - ((m * y) >> 32))) >> 30;
+    }
+    return y;
+}
+
+/**
+ * Approximate sqrt(m), for m in [0.25, 1) given in Q0.32, as a Q2.30 value in
+ * [0.5, 1).
+ *
+ * Newton-Raphson steps y' = y (3 - m y^2) / 2 converge to 1/sqrt(m) without
+ * dividing; the result is then m y. The initial linear approximation 2.134 -
+ * 1.22 m is within 9% of 1/sqrt(m), so four steps leave only the rounding
+ * error of the arithmetic, within 2 units of 2^-30.
+ */
+constexpr std::uint64_t __sqrt_q30 (std::uint64_t m) noexcept {
+    std::uint64_t y = 2'291'365'052u - ((1'309'965'025u * m) >> 32);
+    for (int step = 0; step < 4; ++step) {
+        auto const m_y_y = (((m * y) >> 32) * y) >> 30;
+        y = (y * ((std::uint64_t{3} << 30) - m_y_y)) >> 31;
+    }
+    return (m * y) >> 32;
+}
+
+/**
+ * Scale the Q2.30 magnitude @p value by 2^exponent, rounding to nearest, and
+ * clamp the result to @p limit.
+ */
+constexpr std::uint64_t __scale_magnitude (
+    std::uint64_t value,
+    int exponent,
+    std::uint64_t limit
+) noexcept {
+    if (exponent >= 0) {
+        if (exponent > 32 or value > (limit >> exponent)) {
+            return limit;
+        }
+        return value << exponent;
+    }
+    if (exponent < -40) {
+        return 0u;
+    }
+    auto const result = ((value >> (-exponent - 1)) + 1u) >> 1;
+    return result < limit ? result : limit;
+}
+}  // namespace __detail
+
+/**
+ * Compute 1/@p value by Newton-Raphson iteration, without dividing.
+ *
+ * The result is within a few units in the last place, and saturates when it
+ * is out of range, whatever the overflow mode; the reciprocal of zero is
+ * @c max().
+ */
+template <
+    int t_int_bits,
+    int t_frac_bits,
+    typename T_Rep,
+    Overflow_Mode t_overflow
+>
+    requires (t_int_bits + t_frac_bits <= 32)
+constexpr Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> reciprocal (
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> value
+) noexcept {
+    using Result = Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow>;
+    auto const raw = static_cast<std::int64_t>(value.raw());
+    if (raw == 0) {
+        return Result::max();
+    }
+
+    // Normalize the magnitude to m 2^(32 - shift) raw units, with m in
+    // [0.5, 1), so that 1/value is 1/m 2^(2 t_frac_bits + shift - 32) raw
+    // units.
+    auto const magnitude = static_cast<std::uint32_t>(raw < 0 ? -raw : raw);
+    int const shift = std::countl_zero(magnitude);
+    auto const inverse = __detail::__reciprocal_q30(
+        std::uint64_t{magnitude} << shift
+    );
+
+    auto const limit = static_cast<std::uint64_t>(Result::raw_max)
+        + (raw < 0 ? 1u : 0u);
+    auto const result = static_cast<std::int64_t>(__detail::__scale_magnitude(
+        inverse,
+        2 * t_frac_bits + shift - 62,
+        limit
+    ));
+    return Result::from_raw(static_cast<T_Rep>(raw < 0 ? -result : result));
+}
+
+/**
+ * Compute the square root of @p value by Newton-Raphson iteration, without
+ * dividing.
+ *
+ * The result is within a few units in the last place. The square root of a
+ * negative value is zero.
+ */
+template <
+    int t_int_bits,
+    int t_frac_bits,
+    typename T_Rep,
+    Overflow_Mode t_overflow
+>
+    requires (t_int_bits + t_frac_bits <= 32)
+constexpr Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> sqrt (
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> value
+) noexcept {
+    using Result = Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow>;
+    if (value.raw() <= 0) {
+        return Result{};
+    }
+
+    // Normalize the raw value to m 2^(32 - shift), with m in [0.25, 1) and
+    // the exponent 32 - shift - t_frac_bits of the value even, so that the
+    // square root is sqrt(m) 2^((32 - shift + t_frac_bits) / 2) raw units.
+    auto const raw = static_cast<std::uint32_t>(value.raw());
+    int shift = std::countl_zero(raw);
+    if ((shift - t_frac_bits) % 2 != 0) {
+        --shift;
+    }
+    auto const root = __detail::__sqrt_q30(std::uint64_t{raw} << shift);
+
+    return Result::from_raw(static_cast<T_Rep>(__detail::__scale_magnitude(
+        root,
+        (32 - shift + t_frac_bits) / 2 - 30,
+        static_cast<std::uint64_t>(Result::raw_max)
+    )));
+}
+
+namespace __detail {
+// Deliberately not constexpr: a fixed-point literal which is malformed or out
+// of range calls one of these, which makes the literal ill-formed, and the
+// compiler's error names the function.
+inline void __fixed_literal_out_of_range () {}
+inline void __fixed_literal_not_decimal () {}
+inline void __fixed_literal_too_many_digits () {}
+
+/**
+ * Convert the characters of a numeric literal to @p T_Fixed, rounding to the
+ * nearest representable value (ties away from zero).
+ *
+ * Only decimal literals without an exponent, such as @c 1.25 or @c 3, are
+ * accepted, with up to 18 fractional digits. The conversion uses integer
+ * arithmetic only: the integer part is shifted into place, and the bits of the
+ * fractional part are produced one at a time by long division by a power of
+ * ten.
+ */
+template <typename T_Fixed, char... t_chars>
+consteval T_Fixed __parse_fixed_literal () {
+    using Rep = typename T_Fixed::Rep;
+    constexpr char chars[] = {t_chars...};
+    constexpr auto max_magnitude =
+        static_cast<unsigned long long int>(T_Fixed::raw_max);
+    constexpr auto max_integer = max_magnitude >> T_Fixed::frac_bits;
+
+    // Reject hexadecimal and binary literals, exponents, and octal integer
+    // literals (a leading zero followed by another digit and no decimal
+    // point) before reading any digits. With a decimal point, leading zeros
+    // are allowed, as in the floating literal `00.5`.
+    bool has_point = false;
+    for (char const ch : chars) {
+        if ((ch < '0' or ch > '9') and ch != '.' and ch != '\'') {
+            __fixed_literal_not_decimal();
+        }
+        has_point = has_point or ch == '.';
+    }
+    if (sizeof...(t_chars) > 1u and chars[0] == '0' and not has_point) {
+        __fixed_literal_not_decimal();
+    }
+
+    unsigned long long int integer = 0u;
+    unsigned long long int fraction = 0u;
+    unsigned long long int scale = 1u;
+    bool in_fraction = false;
+    for (char const ch : chars) {
+        if (ch == '\'') {
+            continue;
+        }
+        if (ch == '.') {
+            in_fraction = true;
+            continue;
+        }
+        auto const digit = static_cast<unsigned long long int>(ch - '0');
+        if (in_fraction) {
+            if (scale > 100'000'000'000'000'000u) {
+                __fixed_literal_too_many_digits();
+            }
+            fraction = fraction * 10u + digit;
+            scale *= 10u;
+        } else {
+            if (integer > max_integer / 10u) {
+                __fixed_literal_out_of_range();
+            }
+            integer = integer * 10u + digit;
+            if (integer > max_integer) {
+                __fixed_literal_out_of_range();
+            }
+        }
+    }
+
+    unsigned long long int magnitude = integer;
+    for (int bit = 0; bit < T_Fixed::frac_bits; ++bit) {
+        fraction *= 2u;
+        magnitude <<= 1u;
+        if (fraction >= scale) {
+            fraction -= scale;
+            magnitude |= 1u;
+        }
+    }
+    if (2u * fraction >= scale) {
+        ++magnitude;
+    }
+    if (magnitude > max_magnitude) {
+        __fixed_literal_out_of_range();
+    }
+
+    return T_Fixed::from_raw(static_cast<Rep>(magnitude));
+}
+}  // namespace __detail
+
+/**
+ * Literals for the common Q formats, such as @c 0.5_q15 or @c 1.25_q8_8.
+ *
+ * The literals are evaluated at compile time, rounding to the nearest
+ * representable value, and are ill-formed if they are not decimal literals
+ * without an exponent or if their value is out of range. As with the built-in
+ * literals, a minus sign is a separate operator applied to the literal, so
+ * @c -0.5_q15 is valid but the most negative value of each format, such as
+ * @c -1 for Q15, must be written as @c Q15::lowest().
+ */
+namespace fixed_literals {
+#define FIXED_LITERAL(TYPE, SUFFIX) \
+template <char... t_chars> \
+consteval TYPE operator "" SUFFIX() { \
+    return __detail::__parse_fixed_literal<TYPE, t_chars...>(); \
+}
+
+FIXED_LITERAL(Q7, _q7)
+FIXED_LITERAL(Q15, _q15)
+FIXED_LITERAL(Q31, _q31)
+FIXED_LITERAL(Q2_14, _q2_14)
+FIXED_LITERAL(Q8_8, _q8_8)
+FIXED_LITERAL(Q16_16, _q16_16)
+
+#undef FIXED_LITERAL
+}  // namespace fixed_literals
+}  // namespace arche
+
+#endif  // ARCHE_FIXED_HPP_
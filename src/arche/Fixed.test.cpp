@@ -0,0 +1,351 @@
+#include "arche/Fixed.hpp"
+#include "arche/int_literals.hpp"
+
+#include <cstdint>
+
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE ("arche::Fixed - representation", "[unit][Fixed]") {
+    SECTION ("the default representation is the smallest that fits") {
+        REQUIRE(std::is_same_v<arche::Q7::Rep, std::int8_t>);
+        REQUIRE(std::is_same_v<arche::Q15::Rep, std::int16_t>);
+        REQUIRE(std::is_same_v<arche::Q31::Rep, std::int32_t>);
+        REQUIRE(std::is_same_v<arche::Q8_8::Rep, std::int16_t>);
+        REQUIRE(std::is_same_v<arche::Q2_14::Rep, std::int16_t>);
+        REQUIRE(std::is_same_v<arche::Q16_16::Rep, std::int32_t>);
+        REQUIRE(std::is_same_v<arche::Fixed<4, 5>::Rep, std::int16_t>);
+        REQUIRE(sizeof(arche::Q15) == sizeof(std::int16_t));
+    }
+
+    SECTION ("the representation can be chosen") {
+        using Wide_Q15 = arche::Fixed<1, 15, std::int32_t>;
+        REQUIRE(std::is_same_v<Wide_Q15::Rep, std::int32_t>);
+        REQUIRE(Wide_Q15::max().raw() == 32'767);
+        REQUIRE(Wide_Q15::lowest().raw() == -32'768);
+    }
+
+    SECTION ("limits") {
+        REQUIRE(arche::Q15::max().raw() == 32'767);
+        REQUIRE(arche::Q15::lowest().raw() == -32'768);
+        REQUIRE(arche::Q15::epsilon().raw() == 1);
+        REQUIRE(arche::Fixed<4, 5>::max().raw() == 255);
+        REQUIRE(arche::Fixed<4, 5>::lowest().raw() == -256);
+        REQUIRE(arche::Q31::lowest().raw() == INT32_MIN);
+    }
+
+    SECTION ("default construction is zero") {
+        REQUIRE(arche::Q15{}.raw() == 0);
+    }
+
+    SECTION ("negation and comparison") {
+        auto const half = arche::Q15::from_raw(16'384);
+        REQUIRE((-half).raw() == -16'384);
+        REQUIRE(-half < half);
+        REQUIRE(half == arche::Q15::from_raw(16'384));
+        REQUIRE(half != -half);
+    }
+}
+
+TEST_CASE ("arche::fixed_literals", "[unit][Fixed][fixed_literals]") {
+    using namespace arche::fixed_literals;
+
+    SECTION ("types") {
+        REQUIRE(std::is_same_v<decltype(0.5_q7), arche::Q7>);
+        REQUIRE(std::is_same_v<decltype(0.5_q15), arche::Q15>);
+        REQUIRE(std::is_same_v<decltype(0.5_q31), arche::Q31>);
+        REQUIRE(std::is_same_v<decltype(1.25_q8_8), arche::Q8_8>);
+        REQUIRE(std::is_same_v<decltype(1.25_q2_14), arche::Q2_14>);
+        REQUIRE(std::is_same_v<decltype(1.25_q16_16), arche::Q16_16>);
+    }
+
+    SECTION ("exact values") {
+        REQUIRE((0.5_q7).raw() == 64);
+        REQUIRE((0.5_q15).raw() == 16'384);
+        REQUIRE((0.25_q31).raw() == 536'870'912);
+        REQUIRE((1.25_q8_8).raw() == 320);
+        REQUIRE((-1.5_q2_14).raw() == -24'576);
+        REQUIRE((0.999969482421875_q15).raw() == 32'767);
+        REQUIRE((127.99609375_q8_8).raw() == 32'767);
+        REQUIRE((0.0_q15).raw() == 0);
+        REQUIRE((0_q15).raw() == 0);
+    }
+
+    SECTION ("integer literals") {
+        REQUIRE((1_q8_8).raw() == 256);
+        REQUIRE((3_q16_16).raw() == 196'608);
+        REQUIRE((127_q8_8).raw() == 32'512);
+        REQUIRE((32'767_q16_16).raw() == 32'767 * 65'536);
+    }
+
+    SECTION ("digit separators") {
+        REQUIRE((1'000.5_q16_16).raw() == 65'568'768);
+    }
+
+    SECTION ("leading zeros before a decimal point") {
+        REQUIRE((00.5_q15).raw() == 16'384);
+        REQUIRE((007.25_q8_8).raw() == 1'856);
+        REQUIRE((0'0.5_q15).raw() == 16'384);
+    }
+
+    SECTION ("values are rounded to nearest") {
+        REQUIRE((0.1_q15).raw() == 3'277);
+        REQUIRE((0.1_q31).raw() == 214'748'365);
+        REQUIRE((0.3_q7).raw() == 38);
+        REQUIRE((0.0019531249_q8_8).raw() == 0);
+        REQUIRE((0.123456789012345678_q31).raw() == 265'121'436);
+    }
+
+    SECTION ("ties are rounded away from zero") {
+        REQUIRE((0.001953125_q8_8).raw() == 1);
+        REQUIRE((-0.001953125_q8_8).raw() == -1);
+    }
+
+    SECTION ("negative values") {
+        REQUIRE((-0.5_q15).raw() == -16'384);
+        REQUIRE((-1.25_q8_8).raw() == -320);
+        REQUIRE(-0.5_q15 < 0.25_q15);
+    }
+
+    SECTION ("literals are constant expressions") {
+        // Out of range or malformed literals, such as `1.0_q15`, `128_q8_8`,
+        // `1e-3_q15` or `0x10_q8_8`, do not compile.
+        static constexpr arche::Q15 coefficients[] = {
+            0.125_q15, -0.25_q15, 0.5_q15, -0.25_q15, 0.125_q15,
+        };
+        static_assert(coefficients[2].raw() == 16'384);
+        static_assert(-coefficients[1] == 0.25_q15);
+        REQUIRE(coefficients[0].raw() == 4'096);
+    }
+}
+
+TEST_CASE ("arche::Fixed - arithmetic", "[unit][Fixed]") {
+    using namespace arche::fixed_literals;
+    using Wrapping_Q15 = arche::Fixed<
+        1,
+        15,
+        std::int16_t,
+        arche::Overflow_Mode::wrap
+    >;
+
+    SECTION ("addition and subtraction") {
+        REQUIRE(0.25_q15 + 0.5_q15 == 0.75_q15);
+        REQUIRE(0.25_q15 - 0.5_q15 == -0.25_q15);
+        REQUIRE(1.5_q8_8 - 2.25_q8_8 == -0.75_q8_8);
+
+        auto value = 1.5_q16_16;
+        value += 2.25_q16_16;
+        REQUIRE(value == 3.75_q16_16);
+        value -= 4_q16_16;
+        REQUIRE(value == -0.25_q16_16);
+    }
+
+    SECTION ("addition and subtraction saturate") {
+        REQUIRE(0.75_q15 + 0.5_q15 == arche::Q15::max());
+        REQUIRE(-0.75_q15 - 0.5_q15 == arche::Q15::lowest());
+        REQUIRE(-arche::Q15::lowest() == arche::Q15::max());
+        REQUIRE(arche::Fixed<4, 5>::max() + arche::Fixed<4, 5>::epsilon()
+            == arche::Fixed<4, 5>::max());
+    }
+
+    SECTION ("addition and subtraction wrap") {
+        auto const big = Wrapping_Q15::from_raw(24'576);
+        REQUIRE((big + big).raw() == -16'384);
+        REQUIRE((-big - big).raw() == 16'384);
+        REQUIRE(-Wrapping_Q15::lowest() == Wrapping_Q15::lowest());
+
+        using Narrow = arche::Fixed<
+            4,
+            5,
+            std::int16_t,
+            arche::Overflow_Mode::wrap
+        >;
+        REQUIRE((Narrow::max() + Narrow::epsilon()) == Narrow::lowest());
+    }
+
+    SECTION ("64-bit addition and subtraction") {
+        using Q32_32 = arche::Fixed<32, 32>;
+        REQUIRE(std::is_same_v<Q32_32::Rep, std::int64_t>);
+        REQUIRE(Q32_32::max() + Q32_32::epsilon() == Q32_32::max());
+        REQUIRE(Q32_32::lowest() - Q32_32::epsilon() == Q32_32::lowest());
+        REQUIRE(-Q32_32::lowest() == Q32_32::max());
+        REQUIRE((Q32_32::from_raw(3) - Q32_32::from_raw(5)).raw() == -2);
+    }
+
+    SECTION ("multiplication rounds to nearest") {
+        REQUIRE(0.5_q15 * 0.5_q15 == 0.25_q15);
+        REQUIRE(-0.5_q15 * 0.5_q15 == -0.25_q15);
+        REQUIRE(1.5_q8_8 * -2.25_q8_8 == -3.375_q8_8);
+        REQUIRE(3.75_q16_16 * 2.5_q16_16 == 9.375_q16_16);
+
+        // 3 * 3 / 2^15 = 0.000275, which rounds to 0 units of 2^-15; ties
+        // round toward positive infinity, like a rounding right shift.
+        auto const three = arche::Q15::from_raw(3);
+        REQUIRE((three * three).raw() == 0);
+        REQUIRE((arche::Q15::from_raw(128) * arche::Q15::from_raw(192)).raw()
+            == 1);
+        REQUIRE((arche::Q15::from_raw(-128) * arche::Q15::from_raw(128)).raw()
+            == 0);
+        REQUIRE((arche::Q15::from_raw(-128) * arche::Q15::from_raw(384)).raw()
+            == -1);
+
+        auto value = 0.5_q15;
+        value *= 0.5_q15;
+        REQUIRE(value == 0.25_q15);
+    }
+
+    SECTION ("multiplication saturates") {
+        REQUIRE(arche::Q15::lowest() * arche::Q15::lowest()
+            == arche::Q15::max());
+        REQUIRE(100_q8_8 * -2_q8_8 == arche::Q8_8::lowest());
+    }
+
+    SECTION ("multiplication wraps") {
+        REQUIRE(Wrapping_Q15::lowest() * Wrapping_Q15::lowest()
+            == Wrapping_Q15::lowest());
+    }
+
+    SECTION ("multiplication of 32-bit formats") {
+        REQUIRE(0.5_q31 * 0.5_q31 == 0.25_q31);
+        REQUIRE(arche::Q31::lowest() * arche::Q31::lowest()
+            == arche::Q31::max());
+        REQUIRE(-0.5_q31 * arche::Q31::lowest() == 0.5_q31);
+    }
+}
+
+TEST_CASE ("arche::Fixed - integers", "[unit][Fixed]") {
+    using namespace arche::fixed_literals;
+    using namespace arche::int_literals;
+
+    SECTION ("integers which always fit convert implicitly") {
+        REQUIRE(std::is_convertible_v<std::int8_t, arche::Q8_8>);
+        REQUIRE(std::is_convertible_v<std::uint8_t, arche::Q16_16>);
+        REQUIRE(std::is_convertible_v<std::int16_t, arche::Q16_16>);
+        REQUIRE(not std::is_convertible_v<std::uint8_t, arche::Q8_8>);
+        REQUIRE(not std::is_convertible_v<std::int32_t, arche::Q16_16>);
+        REQUIRE(not std::is_convertible_v<std::int8_t, arche::Q15>);
+        REQUIRE(not std::is_convertible_v<bool, arche::Q16_16>);
+
+        arche::Q16_16 const value = -300_i16;
+        REQUIRE(value == -300_q16_16);
+        REQUIRE(1.5_q8_8 + 2_i8 == 3.5_q8_8);
+        REQUIRE(arche::Q8_8{std::int8_t{-128}} == arche::Q8_8::lowest());
+    }
+
+    SECTION ("multiplication by integers") {
+        REQUIRE(1.25_q8_8 * 3_i8 == 3.75_q8_8);
+        REQUIRE(3_u8 * 1.25_q8_8 == 3.75_q8_8);
+        REQUIRE(0.25_q15 * -3 == -0.75_q15);
+        REQUIRE(0.25_q15 * 5_u32 == arche::Q15::max());
+    }
+}
+
+TEST_CASE ("arche::Fixed - conversions", "[unit][Fixed]") {
+    using namespace arche::fixed_literals;
+
+    SECTION ("between formats") {
+        REQUIRE(arche::Q31{0.75_q15} == 0.75_q31);
+        REQUIRE(arche::Q15{0.75_q31} == 0.75_q15);
+        REQUIRE(arche::Q16_16{-1.5_q8_8} == -1.5_q16_16);
+        REQUIRE(arche::Q8_8{-1.5_q16_16} == -1.5_q8_8);
+    }
+
+    SECTION ("narrowing rounds to nearest") {
+        REQUIRE(arche::Q7{0.1_q15}.raw() == 13);
+        REQUIRE(arche::Q7{arche::Q15::from_raw(128)}.raw() == 1);
+        REQUIRE(arche::Q7{arche::Q15::from_raw(-128)}.raw() == 0);
+        REQUIRE(arche::Q7{arche::Q15::from_raw(-129)}.raw() == -1);
+    }
+
+    SECTION ("out of range values saturate") {
+        REQUIRE(arche::Q15{1.5_q8_8} == arche::Q15::max());
+        REQUIRE(arche::Q15{-1.5_q8_8} == arche::Q15::lowest());
+        REQUIRE(arche::Q8_8{300_q16_16} == arche::Q8_8::max());
+        REQUIRE(arche::Q8_8{-300_q16_16} == arche::Q8_8::lowest());
+    }
+
+    SECTION ("out of range values wrap") {
+        using Wrapping_Q8_8 = arche::Fixed<
+            8,
+            8,
+            std::int16_t,
+            arche::Overflow_Mode::wrap
+        >;
+        REQUIRE(Wrapping_Q8_8{300_q16_16} == Wrapping_Q8_8{44_q16_16});
+        REQUIRE(Wrapping_Q8_8{arche::Q15::lowest()}.raw() == -256);
+    }
+
+    SECTION ("floating-point values") {
+        REQUIRE(arche::Q15{0.5} == 0.5_q15);
+        REQUIRE(arche::Q15{-0.25f} == -0.25_q15);
+        REQUIRE(arche::Q15{0.1}.raw() == 3'277);
+        REQUIRE(arche::Q15{-0.1}.raw() == -3'277);
+        REQUIRE(arche::Q15{2.0} == arche::Q15::max());
+        REQUIRE(arche::Q15{-2.0} == arche::Q15::lowest());
+        REQUIRE(static_cast<double>(1.25_q8_8) == 1.25);
+        REQUIRE(static_cast<float>(-0.5_q31) == -0.5f);
+    }
+}
+
+TEST_CASE ("arche::Fixed - reciprocal and square root", "[unit][Fixed]") {
+    using namespace arche::fixed_literals;
+
+    SECTION ("reciprocal") {
+        REQUIRE(arche::reciprocal(2_q16_16) == 0.5_q16_16);
+        REQUIRE(arche::reciprocal(0.25_q16_16) == 4_q16_16);
+        REQUIRE(arche::reciprocal(-4_q8_8) == -0.25_q8_8);
+        REQUIRE(arche::reciprocal(1_q16_16) == 1_q16_16);
+    }
+
+    SECTION ("reciprocal saturates") {
+        REQUIRE(arche::reciprocal(0.5_q15) == arche::Q15::max());
+        REQUIRE(arche::reciprocal(-0.5_q15) == arche::Q15::lowest());
+        REQUIRE(arche::reciprocal(arche::Q16_16{}) == arche::Q16_16::max());
+        REQUIRE(arche::reciprocal(arche::Q8_8::epsilon())
+            == arche::Q8_8::max());
+    }
+
+    SECTION ("reciprocal is within one unit in the last place") {
+        for (std::int32_t raw = 1; raw < 0x7800'0000; raw += 0xf'0f1) {
+            auto const value = arche::Q16_16::from_raw(raw);
+            auto const exact = 65'536.0 * 65'536.0 / raw;
+            auto const actual = arche::reciprocal(value).raw();
+            if (exact < 0x7fff'ffff) {
+                REQUIRE(actual == Approx(exact).margin(1.0));
+                REQUIRE(arche::reciprocal(-value).raw() == -actual);
+            } else {
+                REQUIRE(actual == 0x7fff'ffff);
+            }
+        }
+    }
+
+    SECTION ("square root") {
+        REQUIRE(arche::sqrt(4_q16_16) == 2_q16_16);
+        REQUIRE(arche::sqrt(0.25_q15) == 0.5_q15);
+        REQUIRE(arche::sqrt(2.25_q8_8) == 1.5_q8_8);
+        REQUIRE(arche::sqrt(0.25_q31) == 0.5_q31);
+        REQUIRE(arche::sqrt(arche::Q15{}) == arche::Q15{});
+        REQUIRE(arche::sqrt(-0.25_q15) == arche::Q15{});
+        REQUIRE(arche::sqrt(arche::Q7::epsilon()).raw() == 11);
+    }
+
+    SECTION ("square root is within a few units in the last place") {
+        for (std::int32_t raw = 1; raw < 0x7800'0000; raw += 0xf'0f1) {
+            auto const exact_16 = 256.0 * __builtin_sqrt(double(raw));
+            REQUIRE(arche::sqrt(arche::Q16_16::from_raw(raw)).raw()
+                == Approx(exact_16).margin(1.0));
+
+            auto const exact_31 = 46'340.950001051984 * __builtin_sqrt(
+                double(raw)
+            );
+            REQUIRE(arche::sqrt(arche::Q31::from_raw(raw)).raw()
+                == Approx(exact_31).margin(4.0));
+        }
+    }
+
+    SECTION ("constant evaluation") {
+        static_assert(arche::sqrt(4_q16_16) == 2_q16_16);
+        static_assert(arche::reciprocal(4_q16_16) == 0.25_q16_16);
+    }
+}
@@ -0,0 +1,37 @@
+// Probes of the code generated for arche::Register, checked by the assembly
+// test. Each ASSEMBLY comment lists the expected instruction counts of the
+// function below it (see tools/check_assembly.py).
+#include "arche/Register.hpp"
+
+#include <cstdint>
+
+namespace {
+using Control_Register = arche::Register<
+    std::uintptr_t{0x4000'0000u},
+    std::uint32_t
+>;
+using Bitset = Control_Register::Bitset;
+}  // namespace
+
+extern "C" {
+// ASSEMBLY probe_register_set_bits: loads=1 or=1 stores=1 calls=0
+void probe_register_set_bits () {
+    Control_Register::set_bits(Bitset::bit<3>());
+}
+
+// ASSEMBLY probe_register_clear_bits: loads=1 and=1 stores=1 calls=0
+void probe_register_clear_bits () {
+    Control_Register::clear_bits(Bitset::bit<3>());
+}
+
+// The mask is folded into a single immediate store.
+// ASSEMBLY probe_register_set: instructions=1 loads=0 stores=1 calls=0
+void probe_register_set () {
+    Control_Register::set(Bitset::bit<3>() | Bitset::bit<5>());
+}
+
+// ASSEMBLY probe_register_get_test: loads=1 stores=0 calls=0
+bool probe_register_get_test () {
+    return Control_Register::get().test(3);
+}
+}
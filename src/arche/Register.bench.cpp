@@ -0,0 +1,54 @@
+#include "arche/Register.hpp"
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "arche/testing/Mock_Register.hpp"
+
+namespace {
+// The mock register is a volatile access to a plain variable, so these
+// measure the code generated around the access: the read-modify-write of the
+// bit operations and the Bitset conversions.
+using Mock_Register = arche::testing::Mock_Register;
+using Bitset = Mock_Register::Bitset;
+
+void register_set (benchmark::State& state) {
+    std::uint16_t value = 0x5a5au;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        Mock_Register::set(Bitset{value});
+    }
+}
+BENCHMARK(register_set);
+
+void register_get (benchmark::State& state) {
+    arche::testing::mock_register_value = 0x1234u;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Mock_Register::get().value());
+    }
+}
+BENCHMARK(register_get);
+
+void register_set_bits (benchmark::State& state) {
+    std::uint16_t mask = 0x0101u;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mask);
+        Mock_Register::set_bits(Bitset{mask});
+    }
+}
+BENCHMARK(register_set_bits);
+
+void register_clear_bits (benchmark::State& state) {
+    std::uint16_t mask = 0x0101u;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mask);
+        Mock_Register::clear_bits(Bitset{mask});
+    }
+}
+BENCHMARK(register_clear_bits);
+}  // namespace
@@ -0,0 +1,32 @@
+// Instantiations of each operation of arche::Register, measured by the
+// code_size target. The register is never accessed, so its address only has
+// to be a plausible peripheral address.
+#include "arche/Register.hpp"
+
+#include <cstdint>
+
+namespace {
+using Control_Register = arche::Register<
+    std::uintptr_t{0x4000'0000u},
+    std::uint32_t
+>;
+using Bitset = Control_Register::Bitset;
+}  // namespace
+
+extern "C" {
+void code_size_register_set (std::uint32_t value) {
+    Control_Register::set(Bitset{value});
+}
+
+std::uint32_t code_size_register_get () {
+    return Control_Register::get().value();
+}
+
+void code_size_register_set_bits (std::uint32_t mask) {
+    Control_Register::set_bits(Bitset{mask});
+}
+
+void code_size_register_clear_bits (std::uint32_t mask) {
+    Control_Register::clear_bits(Bitset{mask});
+}
+}
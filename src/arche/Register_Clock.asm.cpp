@@ -0,0 +1,28 @@
+// Probes of the code generated for arche::Register_Clock, checked by the
+// assembly test (see tools/check_assembly.py).
+#include "arche/Register_Clock.hpp"
+
+#include <cstdint>
+
+#include "arche/Register.hpp"
+
+namespace {
+using Timer_Counter = arche::Register<
+    std::uintptr_t{0x4000'0024u},
+    std::uint16_t
+>;
+using Clock = arche::Register_Clock<Timer_Counter, std::uint32_t>;
+}  // namespace
+
+extern "C" {
+// One load of the hardware counter and one of the software extension.
+// ASSEMBLY probe_register_clock_now: loads=2 stores=0 calls=0 instructions<=3
+std::uint32_t probe_register_clock_now (Clock& clock) {
+    return clock.now();
+}
+
+// ASSEMBLY probe_register_clock_on_register_overflow: loads=1 stores=1 calls=0
+void probe_register_clock_on_register_overflow (Clock& clock) {
+    clock.on_register_overflow();
+}
+}
@@ -0,0 +1,34 @@
+#include "arche/Register_Clock.hpp"
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "arche/testing/Mock_Register.hpp"
+
+namespace {
+using Register_Clock = arche::Register_Clock<
+    arche::testing::Mock_Register,
+    std::uint32_t
+>;
+
+void register_clock_now (benchmark::State& state) {
+    Register_Clock clock{};
+    arche::testing::mock_register_value = 0x0400u;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(clock.now());
+    }
+}
+BENCHMARK(register_clock_now);
+
+void register_clock_on_register_overflow (benchmark::State& state) {
+    Register_Clock clock{};
+
+    for (auto _ : state) {
+        clock.on_register_overflow();
+        benchmark::DoNotOptimize(clock);
+    }
+}
+BENCHMARK(register_clock_on_register_overflow);
+}  // namespace
@@ -0,0 +1,25 @@
+// Instantiations of each operation of arche::Register_Clock extending a
+// 16-bit timer counter to 32 bits, measured by the code_size target.
+#include "arche/Register_Clock.hpp"
+
+#include <cstdint>
+
+#include "arche/Register.hpp"
+
+namespace {
+using Timer_Counter = arche::Register<
+    std::uintptr_t{0x4000'0024u},
+    std::uint16_t
+>;
+using Clock = arche::Register_Clock<Timer_Counter, std::uint32_t>;
+}  // namespace
+
+extern "C" {
+std::uint32_t code_size_register_clock_now (Clock& clock) {
+    return clock.now();
+}
+
+void code_size_register_clock_on_register_overflow (Clock& clock) {
+    clock.on_register_overflow();
+}
+}
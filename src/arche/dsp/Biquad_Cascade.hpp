@@ -0,0 +1,176 @@
+#ifndef ARCHE_DSP_BIQUAD_CASCADE_HPP_
+#define ARCHE_DSP_BIQUAD_CASCADE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "arche/Fixed.hpp"
+
+namespace arche::dsp {
+/**
+ * The coefficients of a second-order section, with the transfer function
+ *
+ *     H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ *
+ * that is, @c y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2].
+ * Note the sign of @c a1 and @c a2, which some filter design tools negate.
+ *
+ * The denominator coefficients of a stable section are in (-2, 2), so a
+ * format with two integer bits, such as @c Q2_14, holds them all.
+ *
+ * @tparam T_Coefficient The fixed-point format of the coefficients.
+ */
+template <typename T_Coefficient>
+struct Biquad {
+    T_Coefficient b0;
+    T_Coefficient b1;
+    T_Coefficient b2;
+    T_Coefficient a1;
+    T_Coefficient a2;
+};
+
+/**
+ * An infinite impulse response filter made of a cascade of second-order
+ * sections with compile-time coefficients, in direct form I.
+ *
+ * Each section sums its five products exactly in 64 bits, then rounds the
+ * sum to the sample format, saturating (or wrapping) according to it. Direct
+ * form I keeps the last inputs and outputs of each section rather than
+ * internal states, so no intermediate value can overflow.
+ *
+ * @code
+ * using namespace arche::fixed_literals;
+ * // A 2nd-order Butterworth low-pass filter at a tenth of the sample rate.
+ * static constexpr arche::dsp::Biquad<arche::Q2_14> low_pass[] = {{
+ *     .b0 = 0.0675_q2_14, .b1 = 0.1349_q2_14, .b2 = 0.0675_q2_14,
+ *     .a1 = -1.1430_q2_14, .a2 = 0.4128_q2_14,
+ * }};
+ * arche::dsp::Biquad_Cascade<low_pass, arche::Q15> filter;
+ * @endcode
+ *
+ * The recursion of each section depends on its previous output, so the block
+ * API does not vectorize across samples; it runs each section over the whole
+ * block in turn, which keeps the coefficients and states of a section in
+ * registers.
+ *
+ * @tparam t_sections A constant array of @c Biquad coefficients, such as a
+ *     @c static @c constexpr array.
+ * @tparam T_Sample The fixed-point format of the samples. Together with the
+ *     coefficients it must be at most 60 bits wide, so that the five products
+ *     of a section sum in 64 bits.
+ */
+template <auto const& t_sections, typename T_Sample>
+class Biquad_Cascade {
+  public:
+    /**
+     * The fixed-point format of the samples.
+     */
+    using Sample = T_Sample;
+
+    /**
+     * The fixed-point format of the coefficients.
+     */
+    using Coefficient = std::remove_cvref_t<decltype(t_sections[0].b0)>;
+
+    /**
+     * The number of second-order sections.
+     */
+    static constexpr std::size_t section_count = std::size(t_sections);
+
+    static_assert(section_count > 0u, "A cascade needs at least one section.");
+    static_assert(
+        Coefficient::width + Sample::width <= 60,
+        "The products of a section must sum in 64 bits."
+    );
+
+    /**
+     * Filter the next input @p sample and return the next output.
+     */
+    constexpr Sample process (Sample sample) noexcept {
+        for (std::size_t section = 0u; section < section_count; ++section) {
+            sample = step(t_sections[section], states_[section], sample);
+        }
+        return sample;
+    }
+
+    /**
+     * Filter the inputs in [@p first, @p last) and write the outputs starting
+     * at @p out, which may be @p first. Returns the end of the outputs.
+     */
+    constexpr Sample* process (
+        Sample const* first,
+        Sample const* last,
+        Sample* out
+    ) noexcept {
+        auto const count = last - first;
+        for (std::size_t section = 0u; section < section_count; ++section) {
+            // A local copy of the state cannot alias the outputs, so that it
+            // stays in registers.
+            auto const* in = section == 0u ? first : out;
+            auto state = states_[section];
+            for (std::ptrdiff_t i = 0; i < count; ++i) {
+                out[i] = step(t_sections[section], state, in[i]);
+            }
+            states_[section] = state;
+        }
+        return out + count;
+    }
+
+    /**
+     * Reset the filter to its initial state, as if all the past inputs were
+     * zero.
+     */
+    constexpr void reset () noexcept {
+        for (auto& state : states_) {
+            state = State{};
+        }
+    }
+
+  private:
+    // The format of the exact sum of the products of a section.
+    using Accumulator = Fixed<
+        64 - Coefficient::frac_bits - Sample::frac_bits,
+        Coefficient::frac_bits + Sample::frac_bits,
+        std::int64_t,
+        Overflow_Mode::wrap
+    >;
+
+    // The last two inputs and outputs of a section.
+    struct State {
+        Sample x1;
+        Sample x2;
+        Sample y1;
+        Sample y2;
+    };
+
+    static constexpr std::int64_t product (
+        Coefficient coefficient,
+        Sample sample
+    ) noexcept {
+        return static_cast<std::int64_t>(coefficient.raw()) * sample.raw();
+    }
+
+    static constexpr Sample step (
+        Biquad<Coefficient> const& c,
+        State& state,
+        Sample input
+    ) noexcept {
+        auto const sum =
+            product(c.b0, input)
+            + product(c.b1, state.x1)
+            + product(c.b2, state.x2)
+            - product(c.a1, state.y1)
+            - product(c.a2, state.y2);
+        auto const output = Sample{Accumulator::from_raw(sum)};
+
+        state = {input, state.x1, output, state.y1};
+        return output;
+    }
+
+    State states_[section_count]{};
+};
+}  // namespace arche::dsp
+
+#endif  // ARCHE_DSP_BIQUAD_CASCADE_HPP_
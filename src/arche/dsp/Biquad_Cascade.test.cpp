@@ -0,0 +1,160 @@
+#include "arche/dsp/Biquad_Cascade.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include "arche/Fixed.hpp"
+
+namespace {
+using namespace arche::fixed_literals;
+using arche::dsp::Biquad;
+
+// y[n] = x[n] + 0.5 y[n-1]
+constexpr Biquad<arche::Q2_14> decay[] = {{
+    .b0 = 1_q2_14, .b1 = 0_q2_14, .b2 = 0_q2_14,
+    .a1 = -0.5_q2_14, .a2 = 0_q2_14,
+}};
+
+// A 4th-order Butterworth low-pass filter at a tenth of the sample rate, as
+// two sections.
+constexpr double low_pass_coefficients[2][5] = {
+    {0.004824343357716, 0.009648686715432, 0.004824343357716,
+        -1.048599576000000, 0.296140267000000},
+    {1.0, 2.0, 1.0, -1.320913206000000, 0.632284530000000},
+};
+
+constexpr Biquad<arche::Q2_14> low_pass[] = {
+    {
+        .b0 = 0.004824343357716_q2_14,
+        .b1 = 0.009648686715432_q2_14,
+        .b2 = 0.004824343357716_q2_14,
+        .a1 = -1.048599576_q2_14,
+        .a2 = 0.296140267_q2_14,
+    },
+    {
+        .b0 = 1_q2_14, .b1 = 1.99993896484375_q2_14, .b2 = 1_q2_14,
+        .a1 = -1.320913206_q2_14, .a2 = 0.63228453_q2_14,
+    },
+};
+
+constexpr Biquad<arche::Q2_14> boost[] = {{
+    .b0 = 1.75_q2_14, .b1 = 0_q2_14, .b2 = 0_q2_14,
+    .a1 = 0_q2_14, .a2 = 0_q2_14,
+}};
+}  // namespace
+
+TEST_CASE (
+    "arche::dsp::Biquad_Cascade - members",
+    "[unit][dsp][Biquad_Cascade]"
+) {
+    using Filter = arche::dsp::Biquad_Cascade<low_pass, arche::Q15>;
+    REQUIRE(std::is_same_v<Filter::Sample, arche::Q15>);
+    REQUIRE(std::is_same_v<Filter::Coefficient, arche::Q2_14>);
+    REQUIRE(Filter::section_count == 2u);
+}
+
+TEST_CASE (
+    "arche::dsp::Biquad_Cascade - impulse response",
+    "[unit][dsp][Biquad_Cascade]"
+) {
+    arche::dsp::Biquad_Cascade<decay, arche::Q15> filter;
+
+    REQUIRE(filter.process(0.5_q15) == 0.5_q15);
+    auto expected = 0.5_q15;
+    for (int n = 1; n < 15; ++n) {
+        expected = expected * 0.5_q15;
+        REQUIRE(filter.process(arche::Q15{}) == expected);
+    }
+}
+
+TEST_CASE (
+    "arche::dsp::Biquad_Cascade - follows the floating-point filter",
+    "[unit][dsp][Biquad_Cascade]"
+) {
+    arche::dsp::Biquad_Cascade<low_pass, arche::Q15> filter;
+    double states[2][4] = {};
+
+    for (int n = 0; n < 400; ++n) {
+        // A low sine, which passes, plus a high one, which is filtered out.
+        auto const input = 0.4 * std::sin(0.05 * n) + 0.4 * std::sin(2.5 * n);
+
+        double expected = input;
+        for (int s = 0; s < 2; ++s) {
+            auto const* c = low_pass_coefficients[s];
+            auto* state = states[s];
+            auto const output = c[0] * expected + c[1] * state[0]
+                + c[2] * state[1] - c[3] * state[2] - c[4] * state[3];
+            state[1] = state[0];
+            state[0] = expected;
+            state[3] = state[2];
+            state[2] = output;
+            expected = output;
+        }
+
+        auto const actual = filter.process(arche::Q15{input});
+        REQUIRE(static_cast<double>(actual) == Approx(expected).margin(0.01));
+    }
+}
+
+TEST_CASE (
+    "arche::dsp::Biquad_Cascade - blocks",
+    "[unit][dsp][Biquad_Cascade]"
+) {
+    arche::Q15 inputs[100];
+    for (std::size_t n = 0u; n < std::size(inputs); ++n) {
+        inputs[n] = arche::Q15::from_raw(
+            static_cast<std::int16_t>((n * 7'919u) % 65'536u - 32'768)
+        );
+    }
+
+    arche::dsp::Biquad_Cascade<low_pass, arche::Q15> single;
+    arche::Q15 expected[100];
+    for (std::size_t n = 0u; n < std::size(inputs); ++n) {
+        expected[n] = single.process(inputs[n]);
+    }
+
+    SECTION ("blocks give the same outputs as single samples") {
+        arche::dsp::Biquad_Cascade<low_pass, arche::Q15> filter;
+        arche::Q15 outputs[100];
+        auto* out = outputs;
+        for (std::size_t n = 0u; n < std::size(inputs); n += 10u) {
+            out = filter.process(inputs + n, inputs + n + 10u, out);
+        }
+        REQUIRE(out == std::end(outputs));
+        REQUIRE(std::equal(outputs, out, expected));
+    }
+
+    SECTION ("outputs can overwrite the inputs") {
+        arche::dsp::Biquad_Cascade<low_pass, arche::Q15> filter;
+        arche::Q15 samples[100];
+        std::copy(std::begin(inputs), std::end(inputs), samples);
+        filter.process(samples, std::end(samples), samples);
+        REQUIRE(std::equal(samples, std::end(samples), expected));
+    }
+
+    SECTION ("reset clears the states") {
+        arche::dsp::Biquad_Cascade<low_pass, arche::Q15> filter;
+        arche::Q15 outputs[100];
+        filter.process(inputs, std::end(inputs), outputs);
+        filter.reset();
+        filter.process(inputs, std::end(inputs), outputs);
+        REQUIRE(std::equal(outputs, std::end(outputs), expected));
+    }
+}
+
+TEST_CASE (
+    "arche::dsp::Biquad_Cascade - saturation",
+    "[unit][dsp][Biquad_Cascade]"
+) {
+    arche::dsp::Biquad_Cascade<boost, arche::Q15> filter;
+    REQUIRE(filter.process(0.5_q15) == 0.875_q15);
+    REQUIRE(filter.process(0.75_q15) == arche::Q15::max());
+    REQUIRE(filter.process(-0.75_q15) == arche::Q15::lowest());
+}
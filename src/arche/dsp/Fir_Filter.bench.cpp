@@ -0,0 +1,88 @@
+#include "arche/dsp/Fir_Filter.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "arche/Fixed.hpp"
+
+namespace {
+// Throughput of the filters in input samples per second, for several tap
+// counts, over blocks of 1024 Q15 samples.
+
+// Reproducible coefficients whose magnitudes sum to less than one, so that
+// the outputs do not saturate.
+template <std::size_t t_count>
+struct Taps {
+    arche::Q15 values[t_count];
+};
+
+template <std::size_t t_count>
+constexpr Taps<t_count> make_taps () {
+    Taps<t_count> taps{};
+    std::uint32_t seed = 1u;
+    for (auto& tap : taps.values) {
+        seed = seed * 1'664'525u + 1'013'904'223u;
+        tap = arche::Q15::from_raw(static_cast<std::int16_t>(
+            static_cast<int>(seed >> 16) % (32'768 / t_count)
+        ));
+    }
+    return taps;
+}
+
+template <std::size_t t_count>
+constexpr Taps<t_count> taps = make_taps<t_count>();
+
+constexpr std::size_t block_size = 1024u;
+
+std::vector<arche::Q15> make_block () {
+    std::vector<arche::Q15> block;
+    std::uint32_t seed = 2u;
+    for (std::size_t i = 0u; i < block_size; ++i) {
+        seed = seed * 1'664'525u + 1'013'904'223u;
+        block.push_back(
+            arche::Q15::from_raw(static_cast<std::int16_t>(seed >> 16))
+        );
+    }
+    return block;
+}
+
+template <typename Filter>
+void run_filter (benchmark::State& state) {
+    auto const in = make_block();
+    std::vector<arche::Q15> out(block_size);
+    Filter filter;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            filter.process(in.data(), in.data() + block_size, out.data())
+        );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * block_size);
+    state.counters["taps"] = Filter::tap_count;
+}
+
+template <std::size_t t_count>
+void fir_filter (benchmark::State& state) {
+    run_filter<arche::dsp::Fir_Filter<taps<t_count>.values>>(state);
+}
+BENCHMARK_TEMPLATE(fir_filter, 8);
+BENCHMARK_TEMPLATE(fir_filter, 32);
+BENCHMARK_TEMPLATE(fir_filter, 128);
+
+// Decimating by 4 computes a quarter of the outputs, so it should process
+// inputs about 4 times as fast as the direct form with the same taps.
+template <std::size_t t_count>
+void decimating_fir_filter (benchmark::State& state) {
+    run_filter<
+        arche::dsp::Decimating_Fir_Filter<taps<t_count>.values, 4u>
+    >(state);
+}
+BENCHMARK_TEMPLATE(decimating_fir_filter, 8);
+BENCHMARK_TEMPLATE(decimating_fir_filter, 32);
+BENCHMARK_TEMPLATE(decimating_fir_filter, 128);
+}  // namespace
@@ -0,0 +1,362 @@
+#ifndef ARCHE_DSP_FIR_FILTER_HPP_
+#define ARCHE_DSP_FIR_FILTER_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "arche/Fixed.hpp"
+#include "arche/fixed_kernels.hpp"
+
+namespace arche::dsp {
+namespace __detail {
+/**
+ * The value type of the compile-time coefficient array @p t_coefficients.
+ */
+template <auto const& t_coefficients>
+using __coefficient_t = std::remove_cvref_t<decltype(t_coefficients[0])>;
+
+/**
+ * The number of samples a @c __sample_history takes between moves of its
+ * window back to the start of its buffer.
+ */
+inline constexpr std::size_t __history_block_size = 32u;
+
+/**
+ * The last samples of a stream, kept in time order in contiguous memory so
+ * that windows of @p t_size of them can be passed to the @c arche::dot()
+ * kernel.
+ *
+ * Samples are appended to a linear buffer with room for
+ * @c __history_block_size more than the window; when it is full, the last
+ * @p t_size - 1 samples are moved back to its start. A block of new samples
+ * can then be stored together before any window of them is read, which
+ * keeps the vector loads of the windows from waiting on the scalar stores of
+ * the samples they overlap.
+ */
+template <typename T_Sample, std::size_t t_size>
+class __sample_history {
+  public:
+    /**
+     * Move the window back to the start of the buffer if it is full, and
+     * return the number of samples which can then be pushed without moving
+     * it again, at least one.
+     */
+    constexpr std::size_t make_room () noexcept {
+        if (end_ == capacity) {
+            for (std::size_t i = 0u; i + 1u < t_size; ++i) {
+                samples_[i] = samples_[capacity - t_size + 1u + i];
+            }
+            end_ = t_size - 1u;
+        }
+        return capacity - end_;
+    }
+
+    /**
+     * Append @p sample, dropping the oldest sample from the window.
+     */
+    constexpr void push (T_Sample sample) noexcept {
+        make_room();
+        samples_[end_++] = sample;
+    }
+
+    /**
+     * The @p t_size samples which were the last ones @p age pushes ago,
+     * oldest first. The window is valid for @p age less than the number of
+     * pushes since the last call to @c make_room() which returned at least
+     * that many.
+     */
+    constexpr T_Sample const* window (std::size_t age = 0u) const noexcept {
+        return samples_ + (end_ - t_size - age);
+    }
+
+    /**
+     * Reset all the samples to zero.
+     */
+    constexpr void clear () noexcept {
+        for (auto& sample : samples_) {
+            sample = T_Sample{};
+        }
+        end_ = t_size - 1u;
+    }
+
+  private:
+    static constexpr std::size_t capacity = t_size - 1u + __history_block_size;
+
+    T_Sample samples_[capacity]{};
+    std::size_t end_ = t_size - 1u;
+};
+}  // namespace __detail
+
+/**
+ * A finite impulse response filter with compile-time coefficients, in direct
+ * form.
+ *
+ * Each output is the sum of the products of the coefficients and the last
+ * inputs, @c y[n] = sum(t_taps[k] * x[n-k]), computed exactly by
+ * @c arche::dot() and then rounded and saturated (or wrapped) to the sample
+ * format. On x86 hosts, 16-bit formats such as @c Q15 use its SSE2 or AVX2
+ * kernel; otherwise the compiler is free to vectorize its scalar loop.
+ *
+ * @code
+ * using namespace arche::fixed_literals;
+ * constexpr arche::Q15 smoothing[] = {0.25_q15, 0.5_q15, 0.25_q15};
+ * arche::dsp::Fir_Filter<smoothing> filter;
+ * auto const output = filter.process(adc_sample);
+ * @endcode
+ *
+ * @tparam t_taps A constant array of the coefficients, such as a
+ *     @c static @c constexpr array of @c arche::Fixed at most 16 bits wide,
+ *     as @c arche::dot() takes. The samples have the same format as the
+ *     coefficients.
+ */
+template <auto const& t_taps>
+class Fir_Filter {
+  public:
+    /**
+     * The fixed-point format of the samples and coefficients.
+     */
+    using Sample = __detail::__coefficient_t<t_taps>;
+
+    /**
+     * The number of coefficients.
+     */
+    static constexpr std::size_t tap_count = std::size(t_taps);
+
+    static_assert(tap_count > 0u, "A filter needs at least one tap.");
+
+    /**
+     * Filter the next input @p sample and return the next output.
+     */
+    constexpr Sample process (Sample sample) noexcept {
+        history_.push(sample);
+        return output(0u);
+    }
+
+    /**
+     * Filter the inputs in [@p first, @p last) and write the outputs starting
+     * at @p out, which may be @p first. Returns the end of the outputs.
+     *
+     * This is faster than filtering each input in turn: the inputs are
+     * appended to the history in groups, and then the outputs are computed
+     * from them.
+     */
+    constexpr Sample* process (
+        Sample const* first,
+        Sample const* last,
+        Sample* out
+    ) noexcept {
+        while (first != last) {
+            auto count = history_.make_room();
+            if (static_cast<std::size_t>(last - first) < count) {
+                count = static_cast<std::size_t>(last - first);
+            }
+            for (std::size_t i = 0u; i < count; ++i) {
+                history_.push(first[i]);
+            }
+            first += count;
+            while (count > 0u) {
+                *out++ = output(--count);
+            }
+        }
+        return out;
+    }
+
+    /**
+     * Reset the filter to its initial state, as if all the past inputs were
+     * zero.
+     */
+    constexpr void reset () noexcept {
+        history_.clear();
+    }
+
+  private:
+    struct Taps {
+        Sample values[tap_count];
+    };
+
+    // The history is kept oldest first, so the coefficients are reversed to
+    // match it.
+    static constexpr Taps reversed_taps_ = [] {
+        Taps taps{};
+        for (std::size_t k = 0u; k < tap_count; ++k) {
+            taps.values[k] = t_taps[tap_count - 1u - k];
+        }
+        return taps;
+    }();
+
+    // The output for the input pushed age inputs ago.
+    constexpr Sample output (std::size_t age) const noexcept {
+        return Sample{arche::dot(
+            reversed_taps_.values,
+            reversed_taps_.values + tap_count,
+            history_.window(age)
+        )};
+    }
+
+    __detail::__sample_history<Sample, tap_count> history_;
+};
+
+/**
+ * A finite impulse response filter which keeps one output of every
+ * @p t_factor, with compile-time coefficients, in polyphase form.
+ *
+ * Its outputs are those of a @c Fir_Filter with the same coefficients at
+ * every @p t_factor-th input (the @p t_factor-th, the 2 @p t_factor-th, and so
+ * on), but it computes no discarded outputs: the coefficients are split into
+ * @p t_factor phases, each applied to its own history of the inputs at one
+ * offset within each group of @p t_factor inputs. Each output then takes
+ * about @c tap_count multiplications, that is @c tap_count / @p t_factor per
+ * input, and each history is shorter than the full one by @p t_factor.
+ *
+ * Inputs can be filtered one at a time, as they arrive, or in blocks, which
+ * is faster; the two can be mixed.
+ *
+ * @tparam t_taps A constant array of the coefficients, as for @c Fir_Filter.
+ * @tparam t_factor The decimation factor: the number of inputs per output.
+ */
+template <auto const& t_taps, std::size_t t_factor>
+class Decimating_Fir_Filter {
+  public:
+    /**
+     * The fixed-point format of the samples and coefficients.
+     */
+    using Sample = __detail::__coefficient_t<t_taps>;
+
+    /**
+     * The number of coefficients.
+     */
+    static constexpr std::size_t tap_count = std::size(t_taps);
+
+    /**
+     * The number of inputs per output.
+     */
+    static constexpr std::size_t factor = t_factor;
+
+    static_assert(tap_count > 0u, "A filter needs at least one tap.");
+    static_assert(t_factor > 0u, "The decimation factor cannot be zero.");
+
+    /**
+     * Filter the next input @p sample. If it completes a group of @c factor
+     * inputs, write the output to @p output and return @c true; otherwise
+     * leave @p output unchanged and return @c false.
+     */
+    constexpr bool process (Sample sample, Sample& output) noexcept {
+        return push(sample, &output) != &output;
+    }
+
+    /**
+     * Filter the inputs in [@p first, @p last) and write an output for each
+     * @c factor inputs starting at @p out, which may be @p first. Returns the
+     * end of the outputs.
+     *
+     * The inputs do not need to be a multiple of @c factor: a partial group
+     * of inputs is completed by the next call.
+     */
+    constexpr Sample* process (
+        Sample const* first,
+        Sample const* last,
+        Sample* out
+    ) noexcept {
+        // Complete the group in progress. There is none with a factor of
+        // one, which the compiler cannot tell on its own.
+        while (t_factor > 1u and offset_ != 0u and first != last) {
+            out = push(*first++, out);
+        }
+
+        // Distribute whole groups among the phases, then compute their
+        // outputs. The histories all hold the same number of samples here.
+        while (static_cast<std::size_t>(last - first) >= t_factor) {
+            auto count = static_cast<std::size_t>(last - first) / t_factor;
+            for (auto& history : histories_) {
+                auto const room = history.make_room();
+                if (room < count) {
+                    count = room;
+                }
+            }
+            for (std::size_t phase = 0u; phase < t_factor; ++phase) {
+                for (std::size_t i = 0u; i < count; ++i) {
+                    histories_[phase].push(
+                        first[i * t_factor + t_factor - 1u - phase]
+                    );
+                }
+            }
+            first += count * t_factor;
+            while (count > 0u) {
+                *out++ = output(--count);
+            }
+        }
+
+        // Start the next group.
+        while (first != last) {
+            out = push(*first++, out);
+        }
+        return out;
+    }
+
+    /**
+     * Reset the filter to its initial state, as if all the past inputs were
+     * zero, at the start of a group of inputs.
+     */
+    constexpr void reset () noexcept {
+        for (auto& history : histories_) {
+            history.clear();
+        }
+        offset_ = 0u;
+    }
+
+  private:
+    // The number of coefficients of each phase, padded with zeros.
+    static constexpr std::size_t phase_length =
+        (tap_count + t_factor - 1u) / t_factor;
+
+    struct Phase_Taps {
+        Sample values[t_factor][phase_length];
+    };
+
+    // The coefficients of each phase, t_taps[phase + j factor], reversed to
+    // match the histories, which are kept oldest first.
+    static constexpr Phase_Taps phase_taps_ = [] {
+        Phase_Taps taps{};
+        for (std::size_t phase = 0u; phase < t_factor; ++phase) {
+            for (std::size_t j = 0u; j < phase_length; ++j) {
+                auto const k = phase + j * t_factor;
+                if (k < tap_count) {
+                    taps.values[phase][phase_length - 1u - j] = t_taps[k];
+                }
+            }
+        }
+        return taps;
+    }();
+
+    // The input at offset i of its group is multiplied by the coefficients
+    // of phase factor - 1 - i. Writes the output if it completes the group,
+    // and returns the end of the outputs.
+    constexpr Sample* push (Sample sample, Sample* out) noexcept {
+        histories_[t_factor - 1u - offset_].push(sample);
+        if (++offset_ == t_factor) {
+            offset_ = 0u;
+            *out++ = output(0u);
+        }
+        return out;
+    }
+
+    // The output for the group which ended age groups ago.
+    constexpr Sample output (std::size_t age) const noexcept {
+        auto sum = arche::dot_product_t<Sample>{};
+        for (std::size_t phase = 0u; phase < t_factor; ++phase) {
+            sum = sum + arche::dot(
+                phase_taps_.values[phase],
+                phase_taps_.values[phase] + phase_length,
+                histories_[phase].window(age)
+            );
+        }
+        return Sample{sum};
+    }
+
+    __detail::__sample_history<Sample, phase_length> histories_[t_factor];
+    std::size_t offset_ = 0u;
+};
+}  // namespace arche::dsp
+
+#endif  // ARCHE_DSP_FIR_FILTER_HPP_
@@ -0,0 +1,267 @@
+#include "arche/dsp/Fir_Filter.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include "arche/Fixed.hpp"
+#include "arche/fixed_kernels.hpp"
+
+namespace {
+using namespace arche::fixed_literals;
+
+constexpr arche::Q15 smoothing[] = {0.25_q15, 0.5_q15, 0.25_q15};
+
+// 21 taps, so that the history is longer than the vectors of the dot
+// product kernel and is not a multiple of the decimation factors.
+constexpr arche::Q15 low_pass[] = {
+    -0.0078_q15, -0.0121_q15, -0.0089_q15, 0.0112_q15, 0.0489_q15,
+    0.0975_q15, 0.1431_q15, 0.1732_q15, 0.1838_q15, 0.1732_q15,
+    0.1431_q15, 0.0975_q15, 0.0489_q15, 0.0112_q15, -0.0089_q15,
+    -0.0121_q15, -0.0078_q15, 0.0031_q15, 0.0064_q15, 0.0042_q15,
+    -0.0019_q15,
+};
+
+constexpr arche::Q8_8 gains[] = {1.5_q8_8, -0.75_q8_8, 2_q8_8, 0.125_q8_8};
+
+constexpr arche::Q7 short_taps[] = {0.5_q7, 0.25_q7};
+
+// A reproducible signal which includes the extremes of the format.
+template <typename T, std::size_t N>
+void fill (T (&samples)[N]) {
+    std::uint32_t seed = 7u;
+    for (std::size_t i = 0u; i < N; ++i) {
+        seed = seed * 1'664'525u + 1'013'904'223u;
+        if (i % 17u == 3u) {
+            samples[i] = T::lowest();
+        } else if (i % 13u == 5u) {
+            samples[i] = T::max();
+        } else {
+            samples[i] = T::from_raw(static_cast<typename T::Rep>(
+                static_cast<std::int32_t>(seed >> 16) - 32'768
+                    >> (16 - T::width)
+            ));
+        }
+    }
+}
+
+// The output of the filter with the given taps at input n, computed
+// directly from the definition.
+template <typename T, std::size_t N, std::size_t M>
+T convolve (T const (&taps)[N], T const (&inputs)[M], std::size_t n) {
+    std::int64_t sum = 0;
+    for (std::size_t k = 0u; k < N and k <= n; ++k) {
+        sum += std::int64_t{taps[k].raw()} * inputs[n - k].raw();
+    }
+    return T{arche::dot_product_t<T>::from_raw(sum)};
+}
+}  // namespace
+
+TEST_CASE ("arche::dsp::Fir_Filter - members", "[unit][dsp][Fir_Filter]") {
+    using Filter = arche::dsp::Fir_Filter<low_pass>;
+    REQUIRE(std::is_same_v<Filter::Sample, arche::Q15>);
+    REQUIRE(Filter::tap_count == 21u);
+}
+
+TEST_CASE (
+    "arche::dsp::Fir_Filter - impulse response",
+    "[unit][dsp][Fir_Filter]"
+) {
+    arche::dsp::Fir_Filter<low_pass> filter;
+
+    REQUIRE(filter.process(arche::Q15::max()) == arche::Q15{
+        arche::dot_product_t<arche::Q15>::from_raw(
+            std::int64_t{low_pass[0].raw()} * arche::Q15::raw_max
+        )
+    });
+    for (std::size_t k = 1u; k < std::size(low_pass); ++k) {
+        REQUIRE(filter.process(arche::Q15{}) == arche::Q15{
+            arche::dot_product_t<arche::Q15>::from_raw(
+                std::int64_t{low_pass[k].raw()} * arche::Q15::raw_max
+            )
+        });
+    }
+    REQUIRE(filter.process(arche::Q15{}) == arche::Q15{});
+}
+
+TEMPLATE_TEST_CASE_SIG (
+    "arche::dsp::Fir_Filter - outputs",
+    "[unit][dsp][Fir_Filter]",
+    ((auto const& t_taps), t_taps),
+    smoothing,
+    low_pass,
+    gains,
+    short_taps
+) {
+    using Filter = arche::dsp::Fir_Filter<t_taps>;
+    using Sample = typename Filter::Sample;
+
+    Sample inputs[100];
+    fill(inputs);
+
+    SECTION ("each output is the sum of products of the taps and inputs") {
+        Filter filter;
+        for (std::size_t n = 0u; n < std::size(inputs); ++n) {
+            REQUIRE(filter.process(inputs[n]) == convolve(t_taps, inputs, n));
+        }
+    }
+
+    SECTION ("blocks give the same outputs as single samples") {
+        Filter single;
+        Sample expected[100];
+        for (std::size_t n = 0u; n < std::size(inputs); ++n) {
+            expected[n] = single.process(inputs[n]);
+        }
+
+        Filter block;
+        Sample outputs[100];
+        auto* out = outputs;
+        for (std::size_t n = 0u; n < std::size(inputs); n += 7u) {
+            auto const* const last =
+                inputs + std::min(n + 7u, std::size(inputs));
+            out = block.process(inputs + n, last, out);
+        }
+        REQUIRE(out == std::end(outputs));
+        REQUIRE(std::equal(outputs, out, expected));
+
+        Filter in_place;
+        std::copy(std::begin(inputs), std::end(inputs), outputs);
+        in_place.process(outputs, std::end(outputs), outputs);
+        REQUIRE(std::equal(outputs, out, expected));
+    }
+
+    SECTION ("reset clears the history") {
+        Filter filter;
+        Sample first[100];
+        filter.process(inputs, std::end(inputs), first);
+        filter.reset();
+        for (std::size_t n = 0u; n < std::size(inputs); ++n) {
+            REQUIRE(filter.process(inputs[n]) == first[n]);
+        }
+    }
+}
+
+TEST_CASE ("arche::dsp::Fir_Filter - saturation", "[unit][dsp][Fir_Filter]") {
+    static constexpr arche::Q15 boost[] = {0.75_q15, 0.75_q15};
+    arche::dsp::Fir_Filter<boost> filter;
+    filter.process(arche::Q15::max());
+    REQUIRE(filter.process(arche::Q15::max()) == arche::Q15::max());
+    filter.process(arche::Q15::lowest());
+    REQUIRE(filter.process(arche::Q15::lowest()) == arche::Q15::lowest());
+}
+
+TEST_CASE (
+    "arche::dsp::Fir_Filter - constant evaluation",
+    "[unit][dsp][Fir_Filter]"
+) {
+    constexpr auto output = [] {
+        arche::dsp::Fir_Filter<smoothing> filter;
+        filter.process(0.5_q15);
+        return filter.process(0.5_q15);
+    }();
+    static_assert(output == 0.375_q15);
+}
+
+TEMPLATE_TEST_CASE_SIG (
+    "arche::dsp::Decimating_Fir_Filter",
+    "[unit][dsp][Decimating_Fir_Filter]",
+    ((std::size_t t_factor), t_factor),
+    1u,
+    2u,
+    3u,
+    4u,
+    8u,
+    25u
+) {
+    using Filter = arche::dsp::Decimating_Fir_Filter<low_pass, t_factor>;
+    REQUIRE(std::is_same_v<typename Filter::Sample, arche::Q15>);
+    REQUIRE(Filter::tap_count == 21u);
+    REQUIRE(Filter::factor == t_factor);
+
+    arche::Q15 inputs[200];
+    fill(inputs);
+
+    // Every factor-th output of the full-rate filter.
+    arche::dsp::Fir_Filter<low_pass> full_rate;
+    arche::Q15 expected[200];
+    std::size_t expected_count = 0u;
+    for (std::size_t n = 0u; n < std::size(inputs); ++n) {
+        auto const output = full_rate.process(inputs[n]);
+        if ((n + 1u) % t_factor == 0u) {
+            expected[expected_count++] = output;
+        }
+    }
+
+    SECTION ("outputs are those of the full-rate filter") {
+        Filter filter;
+        arche::Q15 outputs[200];
+        auto const end = filter.process(inputs, std::end(inputs), outputs);
+        REQUIRE(end - outputs == static_cast<std::ptrdiff_t>(expected_count));
+        REQUIRE(std::equal(outputs, end, expected));
+    }
+
+    SECTION ("groups of inputs can span blocks") {
+        Filter filter;
+        arche::Q15 outputs[200];
+        auto* out = outputs;
+        for (std::size_t n = 0u; n < std::size(inputs); n += 5u) {
+            out = filter.process(inputs + n, inputs + n + 5u, out);
+        }
+        REQUIRE(out - outputs == static_cast<std::ptrdiff_t>(expected_count));
+        REQUIRE(std::equal(outputs, out, expected));
+    }
+
+    SECTION ("single samples give the same outputs as blocks") {
+        Filter filter;
+        std::size_t count = 0u;
+        for (std::size_t n = 0u; n < std::size(inputs); ++n) {
+            auto output = arche::Q15::max();
+            auto const produced = filter.process(inputs[n], output);
+            REQUIRE(produced == ((n + 1u) % t_factor == 0u));
+            if (produced) {
+                REQUIRE(output == expected[count++]);
+            } else {
+                REQUIRE(output == arche::Q15::max());
+            }
+        }
+        REQUIRE(count == expected_count);
+    }
+
+    SECTION ("single samples and blocks can be mixed") {
+        Filter filter;
+        arche::Q15 outputs[200];
+        auto* out = outputs;
+        for (std::size_t n = 0u; n < std::size(inputs); n += 10u) {
+            for (std::size_t i = n; i < n + 3u; ++i) {
+                if (filter.process(inputs[i], *out)) {
+                    ++out;
+                }
+            }
+            out = filter.process(inputs + n + 3u, inputs + n + 10u, out);
+        }
+        REQUIRE(out - outputs == static_cast<std::ptrdiff_t>(expected_count));
+        REQUIRE(std::equal(outputs, out, expected));
+    }
+
+    SECTION ("outputs can overwrite the inputs") {
+        Filter filter;
+        arche::Q15 samples[200];
+        std::copy(std::begin(inputs), std::end(inputs), samples);
+        auto const end = filter.process(samples, std::end(samples), samples);
+        REQUIRE(std::equal(samples, end, expected));
+    }
+
+    SECTION ("reset clears the history and the group in progress") {
+        Filter filter;
+        arche::Q15 outputs[200];
+        filter.process(inputs, inputs + 10, outputs);
+        filter.reset();
+        auto const end = filter.process(inputs, std::end(inputs), outputs);
+        REQUIRE(std::equal(outputs, end, expected));
+    }
+}
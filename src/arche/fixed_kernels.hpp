@@ -0,0 +1,248 @@
+#ifndef ARCHE_FIXED_KERNELS_HPP_
+#define ARCHE_FIXED_KERNELS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "arche/Fixed.hpp"
+#include "exfs/utility/simd.hpp"
+
+namespace arche {
+namespace __detail {
+#if defined(__AVX2__) or defined(__SSE2__)
+// Sixteen-bit fixed-point values, multiplied lane by lane, and the 64-bit
+// sums of their products. The products are formed in 32 bits by the
+// multiply-add and multiply-high instructions, then widened or narrowed.
+using __i16_vector = exfs::__detail::__simd_vector<std::int16_t>;
+using __i64_accumulator = exfs::__detail::__simd_vector<std::int64_t>;
+
+// Adds the products of a and b to acc. Adjacent products are summed in 32
+// bits first; such a sum is in [-2^31 + 2^16, 2^31], so that only 2^31
+// wraps, to -2^31, and is sign extended as if it were unsigned.
+inline __i64_accumulator __multiply_accumulate (
+    __i64_accumulator acc,
+    __i16_vector a,
+    __i16_vector b
+) noexcept {
+#if defined(__AVX2__)
+    auto const sums = _mm256_madd_epi16(a.values, b.values);
+    auto const wrapped = _mm256_cmpeq_epi32(
+        sums,
+        _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min())
+    );
+    auto const signs = _mm256_andnot_si256(
+        wrapped,
+        _mm256_srai_epi32(sums, 31)
+    );
+    acc.values = _mm256_add_epi64(
+        acc.values,
+        _mm256_unpacklo_epi32(sums, signs)
+    );
+    acc.values = _mm256_add_epi64(
+        acc.values,
+        _mm256_unpackhi_epi32(sums, signs)
+    );
+#else
+    auto const sums = _mm_madd_epi16(a.values, b.values);
+    auto const wrapped = _mm_cmpeq_epi32(
+        sums,
+        _mm_set1_epi32(std::numeric_limits<std::int32_t>::min())
+    );
+    auto const signs = _mm_andnot_si128(wrapped, _mm_srai_epi32(sums, 31));
+    acc.values = _mm_add_epi64(acc.values, _mm_unpacklo_epi32(sums, signs));
+    acc.values = _mm_add_epi64(acc.values, _mm_unpackhi_epi32(sums, signs));
+#endif
+    return acc;
+}
+
+// Returns the sum of the lanes of acc.
+inline std::int64_t __sum (__i64_accumulator acc) noexcept {
+    std::int64_t lanes[__i64_accumulator::width];
+    acc.store(lanes);
+    std::int64_t sum = 0;
+    for (auto const lane : lanes) {
+        sum += lane;
+    }
+    return sum;
+}
+
+// Returns the products of a and b shifted right by t_shift bits with
+// rounding, then saturated or wrapped to 16 bits. The unpacks and the pack
+// work within each 128-bit lane, so the values end up in their original
+// order.
+template <int t_shift, bool t_saturate>
+__i16_vector __multiply_round_shift (__i16_vector a, __i16_vector b) noexcept {
+#if defined(__AVX2__)
+    auto const low = _mm256_mullo_epi16(a.values, b.values);
+    auto const high = _mm256_mulhi_epi16(a.values, b.values);
+    auto const rounding = _mm256_set1_epi32(
+        t_shift > 0 ? 1 << (t_shift - 1) : 0
+    );
+    auto const narrow = [&] (__m256i products) {
+        products = _mm256_srai_epi32(
+            _mm256_add_epi32(products, rounding),
+            t_shift
+        );
+        if constexpr (not t_saturate) {
+            products = _mm256_srai_epi32(_mm256_slli_epi32(products, 16), 16);
+        }
+        return products;
+    };
+    return {_mm256_packs_epi32(
+        narrow(_mm256_unpacklo_epi16(low, high)),
+        narrow(_mm256_unpackhi_epi16(low, high))
+    )};
+#else
+    auto const low = _mm_mullo_epi16(a.values, b.values);
+    auto const high = _mm_mulhi_epi16(a.values, b.values);
+    auto const rounding = _mm_set1_epi32(
+        t_shift > 0 ? 1 << (t_shift - 1) : 0
+    );
+    auto const narrow = [&] (__m128i products) {
+        products = _mm_srai_epi32(
+            _mm_add_epi32(products, rounding),
+            t_shift
+        );
+        if constexpr (not t_saturate) {
+            products = _mm_srai_epi32(_mm_slli_epi32(products, 16), 16);
+        }
+        return products;
+    };
+    return {_mm_packs_epi32(
+        narrow(_mm_unpacklo_epi16(low, high)),
+        narrow(_mm_unpackhi_epi16(low, high))
+    )};
+#endif
+}
+#endif
+}  // namespace __detail
+
+/**
+ * The format of the exact sum of products of values of the fixed-point type
+ * @p T_Fixed, as computed by @c dot().
+ *
+ * It has twice the fractional bits of @p T_Fixed in 64 bits, and wraps: the
+ * sum cannot overflow for fewer than 2^(65 - 2 width) products, over 8 billion
+ * for 16-bit formats. Converting it to a narrower format, such as
+ * @c Q15{dot(...)}, rounds and saturates according to that format.
+ */
+template <typename T_Fixed>
+using dot_product_t = Fixed<
+    64 - 2 * T_Fixed::frac_bits,
+    2 * T_Fixed::frac_bits,
+    std::int64_t,
+    Overflow_Mode::wrap
+>;
+
+/**
+ * @name Fixed-point array kernels
+ *
+ * Kernels over contiguous arrays of fixed-point values, such as a block of
+ * samples and a table of filter coefficients. Formats stored in 16 bits are
+ * multiplied 8 or 16 at a time when the host is x86 with SSE2 or AVX2. The
+ * vector loops leave any remainder, and any other format or target, to a
+ * plain loop over the raw values, which is also what runs in constant
+ * expressions; the results are bit-for-bit the same either way.
+ *
+ * @{
+ */
+
+/**
+ * Returns the exact sum of the products of the values in [@p lhs_first,
+ * @p lhs_last) and the values of the same count starting at @p rhs_first.
+ */
+template <
+    int t_int_bits,
+    int t_frac_bits,
+    typename T_Rep,
+    Overflow_Mode t_overflow
+>
+    requires (t_int_bits + t_frac_bits <= 16)
+constexpr auto dot (
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> const* lhs_first,
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> const* lhs_last,
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> const* rhs_first
+) noexcept {
+    using Result = dot_product_t<
+        Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow>
+    >;
+
+    std::int64_t sum = 0;
+#if defined(__AVX2__) or defined(__SSE2__)
+    if constexpr (std::is_same_v<T_Rep, std::int16_t>) {
+        if (not std::is_constant_evaluated()) {
+            using __detail::__i16_vector;
+            auto acc = __detail::__i64_accumulator::zero();
+            for (; lhs_last - lhs_first >= __i16_vector::width;
+                lhs_first += __i16_vector::width,
+                rhs_first += __i16_vector::width
+            ) {
+                acc = __detail::__multiply_accumulate(
+                    acc,
+                    __i16_vector::load(lhs_first),
+                    __i16_vector::load(rhs_first)
+                );
+            }
+            sum = __detail::__sum(acc);
+        }
+    }
+#endif
+    for (; lhs_first != lhs_last; ++lhs_first, ++rhs_first) {
+        sum += static_cast<std::int64_t>(lhs_first->raw()) * rhs_first->raw();
+    }
+    return Result::from_raw(sum);
+}
+
+/**
+ * Multiplies each value in [@p first, @p last) by @p factor, as with
+ * @c operator*, and writes the products starting at @p out. Returns the end
+ * of the products.
+ */
+template <
+    int t_int_bits,
+    int t_frac_bits,
+    typename T_Rep,
+    Overflow_Mode t_overflow
+>
+    requires (t_int_bits + t_frac_bits <= 32)
+constexpr Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow>* scale (
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> const* first,
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> const* last,
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow>* out,
+    Fixed<t_int_bits, t_frac_bits, T_Rep, t_overflow> factor
+) noexcept {
+#if defined(__AVX2__) or defined(__SSE2__)
+    // The vectors saturate and wrap to 16 bits, so this needs all of them.
+    if constexpr (
+        std::is_same_v<T_Rep, std::int16_t> and
+        t_int_bits + t_frac_bits == 16
+    ) {
+        if (not std::is_constant_evaluated()) {
+            using __detail::__i16_vector;
+            auto const factors = __i16_vector::splat(factor.raw());
+            for (; last - first >= __i16_vector::width;
+                first += __i16_vector::width,
+                out += __i16_vector::width
+            ) {
+                __detail::__multiply_round_shift<
+                    t_frac_bits,
+                    t_overflow == Overflow_Mode::saturate
+                >(__i16_vector::load(first), factors).store(out);
+            }
+        }
+    }
+#endif
+    for (; first != last; ++first, ++out) {
+        *out = *first * factor;
+    }
+    return out;
+}
+
+/**
+ * @}
+ */
+}  // namespace arche
+
+#endif  // ARCHE_FIXED_KERNELS_HPP_
@@ -0,0 +1,143 @@
+#include "arche/fixed_kernels.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include "arche/Fixed.hpp"
+
+namespace {
+using Wrapping_Q15 = arche::Fixed<
+    1,
+    15,
+    std::int16_t,
+    arche::Overflow_Mode::wrap
+>;
+
+// Fills the array with a reproducible mix of values which includes the
+// extremes of the format, so that the vectorized kernels meet the products
+// which overflow.
+template <typename T, std::size_t N>
+void fill (T (&values)[N], unsigned seed) {
+    for (std::size_t i = 0u; i < N; ++i) {
+        seed = seed * 1'103'515'245u + 12'345u;
+        switch ((seed >> 16) % 4u) {
+            case 0u: values[i] = T::lowest(); break;
+            case 1u: values[i] = T::max(); break;
+            default:
+                values[i] = T::from_raw(static_cast<typename T::Rep>(
+                    static_cast<std::int64_t>(seed >> 8)
+                        % (std::int64_t{T::raw_max} + 1)
+                        * (seed % 2u == 0u ? 1 : -1)
+                ));
+        }
+    }
+}
+}  // namespace
+
+TEMPLATE_TEST_CASE (
+    "arche::dot",
+    "[unit][fixed_kernels]",
+    arche::Q15,
+    Wrapping_Q15,
+    arche::Q8_8,
+    (arche::Fixed<4, 5>),
+    arche::Q7
+) {
+    TestType lhs[67];
+    TestType rhs[67];
+    fill(lhs, 1u);
+    fill(rhs, 2u);
+
+    SECTION ("the result has twice the fractional bits") {
+        using Result = decltype(arche::dot(lhs, lhs, rhs));
+        REQUIRE(std::is_same_v<Result, arche::dot_product_t<TestType>>);
+        REQUIRE(Result::frac_bits == 2 * TestType::frac_bits);
+        REQUIRE(std::is_same_v<typename Result::Rep, std::int64_t>);
+    }
+
+    SECTION ("the result is the exact sum of products for every length") {
+        for (std::size_t count = 0u; count <= std::size(lhs); ++count) {
+            std::int64_t expected = 0;
+            for (std::size_t i = 0u; i < count; ++i) {
+                expected += std::int64_t{lhs[i].raw()} * rhs[i].raw();
+            }
+            REQUIRE(arche::dot(lhs, lhs + count, rhs).raw() == expected);
+        }
+    }
+
+    SECTION ("products of the most negative value are positive") {
+        TestType lowest[32];
+        for (auto& value : lowest) {
+            value = TestType::lowest();
+        }
+        std::int64_t const square =
+            std::int64_t{TestType::raw_min} * TestType::raw_min;
+        REQUIRE(arche::dot(lowest, lowest + 32, lowest).raw() == 32 * square);
+    }
+}
+
+TEST_CASE ("arche::dot - converting the result", "[unit][fixed_kernels]") {
+    using namespace arche::fixed_literals;
+
+    arche::Q15 const lhs[] = {0.5_q15, 0.25_q15, -0.5_q15};
+    arche::Q15 const rhs[] = {0.5_q15, 0.5_q15, 0.25_q15};
+    REQUIRE(arche::Q15{arche::dot(lhs, lhs + 3, rhs)} == 0.25_q15);
+
+    arche::Q15 const large[] = {0.75_q15, 0.75_q15};
+    REQUIRE(arche::Q15{arche::dot(large, large + 2, large)}
+        == arche::Q15::max());
+
+    static constexpr arche::Q15 taps[] = {0.5_q15, -0.25_q15};
+    static_assert(arche::dot(taps, taps + 2, taps).raw() == 335'544'320);
+}
+
+TEMPLATE_TEST_CASE (
+    "arche::scale",
+    "[unit][fixed_kernels]",
+    arche::Q15,
+    Wrapping_Q15,
+    arche::Q8_8,
+    (arche::Fixed<4, 5>),
+    arche::Q7,
+    arche::Q16_16
+) {
+    TestType values[67];
+    TestType factors[4];
+    fill(values, 3u);
+    fill(factors, 4u);
+    factors[0] = TestType::lowest();
+    factors[1] = TestType::max();
+
+    SECTION ("each value is multiplied as by operator*") {
+        for (auto const factor : factors) {
+            for (std::size_t count = 0u; count <= std::size(values); ++count) {
+                TestType out[67];
+                auto const end = arche::scale(
+                    values,
+                    values + count,
+                    out,
+                    factor
+                );
+                REQUIRE(end == out + count);
+                for (std::size_t i = 0u; i < count; ++i) {
+                    REQUIRE(out[i] == values[i] * factor);
+                }
+            }
+        }
+    }
+
+    SECTION ("the output can be the input") {
+        TestType copy[67];
+        std::copy(std::begin(values), std::end(values), copy);
+        arche::scale(copy, copy + 67, copy, factors[2]);
+        for (std::size_t i = 0u; i < 67u; ++i) {
+            REQUIRE(copy[i] == values[i] * factors[2]);
+        }
+    }
+}
@@ -1,12 +1,45 @@
 #ifndef ARCHE_INT_LITERALS_HPP_
 #define ARCHE_INT_LITERALS_HPP_
 
+#include <concepts>
 #include <cstdint>
+#include <limits>
 
-namespace arche::int_literals {
+namespace arche {
+namespace __detail {
+// Deliberately not constexpr: a literal whose value does not fit its type
+// calls this, which makes the literal ill-formed, and the compiler's error
+// names this function.
+inline void __integer_literal_out_of_range () {}
+
+/**
+ * Convert the value of an integer literal to @p T, rejecting the literal at
+ * compile time if @p T cannot represent its value.
+ */
+template <std::integral T>
+consteval T __checked_int_literal (unsigned long long int value) {
+    using Limits = std::numeric_limits<T>;
+    if (value > static_cast<unsigned long long int>(Limits::max())) {
+        __integer_literal_out_of_range();
+    }
+    return static_cast<T>(value);
+}
+}  // namespace __detail
+
+/**
+ * Literals for the fixed-width integer types, such as @c 300_u16.
+ *
+ * The literals are evaluated at compile time and are ill-formed if the type
+ * cannot represent their value, so @c 300_u8 does not compile instead of
+ * silently truncating to 44. As with the built-in literals, a minus sign is a
+ * separate operator applied to the (non-negative) literal, so the most
+ * negative value of each signed type, such as @c -128 for @c _i8, cannot be
+ * written with these literals.
+ */
+namespace int_literals {
 #define INT_LITERAL(TYPE, SUFFIX) \
-inline TYPE operator "" SUFFIX(unsigned long long int value) { \
-    return static_cast<TYPE>(value); \
+consteval TYPE operator "" SUFFIX(unsigned long long int value) { \
+    return __detail::__checked_int_literal<TYPE>(value); \
 }
 
 INT_LITERAL(std::int8_t, _i8)
@@ -20,6 +53,7 @@ INT_LITERAL(std::uint32_t, _u32)
 INT_LITERAL(std::uint64_t, _u64)
 
 #undef INT_LITERAL
-}  // namespace arche::int_literals
+}  // namespace int_literals
+}  // namespace arche
 
 #endif  // ARCHE_INT_LITERALS_HPP_
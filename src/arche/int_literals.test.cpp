@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include <limits>
 #include <type_traits>
 
 #include <catch2/catch.hpp>
@@ -43,3 +44,31 @@ TEST_CASE ("arche::int_literals", "[unit][int_literals]") {
         REQUIRE(3_u64 == 3);
     }
 }
+
+TEST_CASE (
+    "arche::int_literals - compile-time range checks",
+    "[unit][int_literals]"
+) {
+    using namespace arche::int_literals;
+
+    // Out of range literals, such as `128_i8` or `256_u8`, do not compile.
+    REQUIRE(127_i8 == std::numeric_limits<std::int8_t>::max());
+    REQUIRE(32'767_i16 == std::numeric_limits<std::int16_t>::max());
+    REQUIRE(2'147'483'647_i32 == std::numeric_limits<std::int32_t>::max());
+    REQUIRE(
+        9'223'372'036'854'775'807_i64
+            == std::numeric_limits<std::int64_t>::max()
+    );
+
+    REQUIRE(255_u8 == std::numeric_limits<std::uint8_t>::max());
+    REQUIRE(65'535_u16 == std::numeric_limits<std::uint16_t>::max());
+    REQUIRE(4'294'967'295_u32 == std::numeric_limits<std::uint32_t>::max());
+    REQUIRE(
+        18'446'744'073'709'551'615_u64
+            == std::numeric_limits<std::uint64_t>::max()
+    );
+
+    REQUIRE(0x7f_i8 == 127);
+    REQUIRE(0b1111'1111_u8 == 255u);
+    REQUIRE(-127_i8 == -127);
+}
@@ -0,0 +1,178 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/algorithm/compare.hpp"
+#include "exfs/algorithm/copy.hpp"
+#include "exfs/algorithm/fill.hpp"
+#include "exfs/algorithm/find.hpp"
+#include "exfs/iterator/reverse_iterator.hpp"
+
+namespace {
+// Each algorithm is run on plain pointers, which take the memory builtin fast
+// path, and on the same pointers wrapped twice in reverse_iterator. The double
+// reversal visits the elements in the same order, but is not a contiguous
+// iterator, so the algorithm falls back to its element loop.
+template <typename T>
+using element_iterator = exfs::iterator::reverse_iterator<
+    exfs::iterator::reverse_iterator<T*>
+>;
+
+template <typename T>
+element_iterator<T> element_iter (T* ptr) {
+    using inner = exfs::iterator::reverse_iterator<T*>;
+    return element_iterator<T>{inner{ptr}};
+}
+
+template <typename T>
+void copy_bitwise (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<T> source(size, T{1});
+    std::vector<T> dest(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(source.data());
+        exfs::algorithm::copy(
+            source.data(),
+            source.data() + size,
+            dest.data()
+        );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+}
+BENCHMARK_TEMPLATE(copy_bitwise, std::uint8_t)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(copy_bitwise, std::uint32_t)->Arg(64)->Arg(4096);
+
+template <typename T>
+void copy_elementwise (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<T> source(size, T{1});
+    std::vector<T> dest(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(source.data());
+        exfs::algorithm::copy(
+            element_iter(source.data()),
+            element_iter(source.data() + size),
+            element_iter(dest.data())
+        );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+}
+BENCHMARK_TEMPLATE(copy_elementwise, std::uint8_t)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(copy_elementwise, std::uint32_t)->Arg(64)->Arg(4096);
+
+void fill_bitwise (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint8_t> dest(size);
+    std::uint8_t value = 0x5au;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        exfs::algorithm::fill(dest.data(), dest.data() + size, value);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(fill_bitwise)->Arg(64)->Arg(4096);
+
+void fill_elementwise (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint8_t> dest(size);
+    std::uint8_t value = 0x5au;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        exfs::algorithm::fill(
+            element_iter(dest.data()),
+            element_iter(dest.data() + size),
+            value
+        );
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(fill_elementwise)->Arg(64)->Arg(4096);
+
+// The searched byte is only at the end of the range.
+void find_bitwise (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<char> haystack(size, 'a');
+    haystack.back() = 'z';
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack.data());
+        benchmark::DoNotOptimize(exfs::algorithm::find(
+            haystack.data(),
+            haystack.data() + size,
+            'z'
+        ));
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(find_bitwise)->Arg(64)->Arg(4096);
+
+void find_elementwise (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<char> haystack(size, 'a');
+    haystack.back() = 'z';
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack.data());
+        benchmark::DoNotOptimize(exfs::algorithm::find(
+            element_iter(haystack.data()),
+            element_iter(haystack.data() + size),
+            'z'
+        ));
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(find_elementwise)->Arg(64)->Arg(4096);
+
+// The ranges differ only in their last element.
+void equal_bitwise (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint32_t> lhs(size, 7u);
+    std::vector<std::uint32_t> rhs(size, 7u);
+    rhs.back() = 8u;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(exfs::algorithm::equal(
+            lhs.data(), lhs.data() + size,
+            rhs.data(), rhs.data() + size
+        ));
+    }
+
+    state.SetBytesProcessed(state.iterations() * size * 4u);
+}
+BENCHMARK(equal_bitwise)->Arg(64)->Arg(4096);
+
+void equal_elementwise (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint32_t> lhs(size, 7u);
+    std::vector<std::uint32_t> rhs(size, 7u);
+    rhs.back() = 8u;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(exfs::algorithm::equal(
+            element_iter(lhs.data()), element_iter(lhs.data() + size),
+            element_iter(rhs.data()), element_iter(rhs.data() + size)
+        ));
+    }
+
+    state.SetBytesProcessed(state.iterations() * size * 4u);
+}
+BENCHMARK(equal_elementwise)->Arg(64)->Arg(4096);
+}  // namespace
@@ -0,0 +1,120 @@
+#ifndef EXFS_ALGORITHM_BITWISE_HPP_
+#define EXFS_ALGORITHM_BITWISE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/move_iterator.hpp"
+#include "exfs/iterator/traits.hpp"
+
+namespace exfs::algorithm::__detail {
+// Concepts deciding when an algorithm may operate on the object
+// representation of a range with the memory builtins instead of visiting
+// each element. All of them require contiguous iterators so that the
+// elements can be addressed through a pointer.
+
+template <typename I>
+using __element_t = std::remove_reference_t<iterator::iter_reference_t<I>>;
+
+// Elements of I can be copied to O by copying bytes.
+template <typename I, typename O>
+concept __bitwise_copyable =
+    iterator::contiguous_iterator<I> and
+    iterator::contiguous_iterator<O> and
+    std::same_as<
+        std::remove_const_t<__element_t<I>>,
+        __element_t<O>
+    > and
+    std::is_trivially_copyable_v<__element_t<O>> and
+    not std::is_volatile_v<__element_t<O>>;
+
+// Equality of T is equality of its object representation.
+template <typename T>
+concept __bitwise_equality =
+    std::is_integral_v<T> or
+    std::is_enum_v<T> or
+    std::is_pointer_v<T>;
+
+// Elements of I1 and I2 can be compared for equality by comparing bytes.
+template <typename I1, typename I2>
+concept __bitwise_comparable =
+    iterator::contiguous_iterator<I1> and
+    iterator::contiguous_iterator<I2> and
+    std::same_as<
+        std::remove_cv_t<__element_t<I1>>,
+        std::remove_cv_t<__element_t<I2>>
+    > and
+    __bitwise_equality<std::remove_cv_t<__element_t<I1>>> and
+    not std::is_volatile_v<__element_t<I1>> and
+    not std::is_volatile_v<__element_t<I2>>;
+
+// T is a single byte whose ordering is that of unsigned char, which is how
+// memcmp orders bytes.
+template <typename T>
+concept __unsigned_byte =
+    std::same_as<T, unsigned char> or
+    std::same_as<T, std::byte> or
+    std::same_as<T, char8_t> or
+    (std::same_as<T, char> and not std::is_signed_v<char>);
+
+// T is a single byte whose equality is that of its object representation,
+// which memchr can search for.
+template <typename T>
+concept __byte_sized_integral =
+    sizeof(T) == 1u and
+    (std::is_integral_v<T> or std::is_enum_v<T>);
+
+// Searching a range of I for a T can be done on its bytes, with memchr or
+// the byte search kernels.
+template <typename I, typename T>
+concept __memchr_searchable =
+    iterator::contiguous_iterator<I> and
+    __byte_sized_integral<std::remove_cv_t<__element_t<I>>> and
+    not std::is_volatile_v<__element_t<I>> and
+    std::same_as<std::remove_cv_t<T>, std::remove_cv_t<__element_t<I>>>;
+
+template <iterator::contiguous_iterator I>
+constexpr auto* __address (I const& it) noexcept {
+    return std::to_address(it);
+}
+
+// The address of a single-byte element, as expected by the byte search
+// kernels.
+template <iterator::contiguous_iterator I>
+unsigned char const* __byte_address (I const& it) noexcept {
+    return reinterpret_cast<unsigned char const*>(std::to_address(it));
+}
+
+// Moving a trivially copyable object is copying it, so a move_iterator over
+// a contiguous range is unwrapped to reach the same fast paths as a copy.
+template <typename I>
+struct __unwrap_move {
+    using type = I;
+
+    static constexpr I const& unwrap (I const& it) noexcept { return it; }
+};
+
+template <typename I>
+requires std::is_trivially_copyable_v<iterator::iter_value_t<I>>
+struct __unwrap_move<iterator::move_iterator<I>> {
+    using type = I;
+
+    static constexpr I const& unwrap (
+        iterator::move_iterator<I> const& it
+    ) noexcept {
+        return it.base();
+    }
+};
+
+template <typename I>
+using __unwrap_move_t = typename __unwrap_move<I>::type;
+
+template <typename I>
+constexpr __unwrap_move_t<I> const& __unwrap (I const& it) noexcept {
+    return __unwrap_move<I>::unwrap(it);
+}
+}  // namespace exfs::algorithm::__detail
+
+#endif  // EXFS_ALGORITHM_BITWISE_HPP_
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/algorithm/byte_search.hpp"
+
+namespace {
+// Each kernel scans a buffer of payload bytes for delimiters which only
+// appear at its end, as when looking for the end of a long frame, and is
+// compared with the scalar loop it replaces. Throughput is reported in
+// bytes per second.
+std::vector<unsigned char> make_frame (std::size_t size) {
+    std::vector<unsigned char> frame(size);
+    for (std::size_t i = 0u; i < size; ++i) {
+        frame[i] = static_cast<unsigned char>('a' + i % 26u);
+    }
+    frame.back() = '\n';
+    return frame;
+}
+
+constexpr unsigned char delimiters[] = {'\r', '\n', '|', ';', '\t'};
+
+template <typename Search>
+void run (benchmark::State& state, Search search) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const frame = make_frame(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frame.data());
+        benchmark::DoNotOptimize(search(frame.data(), frame.data() + size));
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+void find_byte_scalar (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        while (first != last and *first != '\n') {
+            ++first;
+        }
+        return first;
+    });
+}
+BENCHMARK(find_byte_scalar)->Arg(64)->Arg(1500)->Arg(65536);
+
+void find_byte_memchr (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        return std::memchr(first, '\n', static_cast<std::size_t>(last - first));
+    });
+}
+BENCHMARK(find_byte_memchr)->Arg(64)->Arg(1500)->Arg(65536);
+
+void find_byte_kernel (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        return exfs::algorithm::find_byte(first, last, '\n');
+    });
+}
+BENCHMARK(find_byte_kernel)->Arg(64)->Arg(1500)->Arg(65536);
+
+void find_byte3_scalar (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        while (
+            first != last and
+            *first != '\r' and
+            *first != '\n' and
+            *first != '|'
+        ) {
+            ++first;
+        }
+        return first;
+    });
+}
+BENCHMARK(find_byte3_scalar)->Arg(64)->Arg(1500)->Arg(65536);
+
+void find_byte3_kernel (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        return exfs::algorithm::find_byte3(first, last, '\r', '\n', '|');
+    });
+}
+BENCHMARK(find_byte3_kernel)->Arg(64)->Arg(1500)->Arg(65536);
+
+void find_first_of_scalar (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        return std::find_first_of(
+            first,
+            last,
+            std::begin(delimiters),
+            std::end(delimiters)
+        );
+    });
+}
+BENCHMARK(find_first_of_scalar)->Arg(64)->Arg(1500)->Arg(65536);
+
+void find_first_of_kernel (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        return exfs::algorithm::find_first_byte_of(
+            first,
+            last,
+            std::begin(delimiters),
+            std::end(delimiters)
+        );
+    });
+}
+BENCHMARK(find_first_of_kernel)->Arg(64)->Arg(1500)->Arg(65536);
+
+void count_byte_scalar (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        return std::count(first, last, 'e');
+    });
+}
+BENCHMARK(count_byte_scalar)->Arg(64)->Arg(1500)->Arg(65536);
+
+void count_byte_kernel (benchmark::State& state) {
+    run(state, [] (unsigned char const* first, unsigned char const* last) {
+        return exfs::algorithm::count_byte(first, last, 'e');
+    });
+}
+BENCHMARK(count_byte_kernel)->Arg(64)->Arg(1500)->Arg(65536);
+}  // namespace
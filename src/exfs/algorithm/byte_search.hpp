@@ -0,0 +1,283 @@
+#ifndef EXFS_ALGORITHM_BYTE_SEARCH_HPP_
+#define EXFS_ALGORITHM_BYTE_SEARCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "exfs/utility/integer_sequence.hpp"
+#include "exfs/utility/simd.hpp"
+
+namespace exfs::algorithm {
+namespace __detail {
+#if defined(__AVX2__) or defined(__SSE2__)
+// Sixteen or thirty-two bytes of a buffer, compared with the searched bytes
+// all at once. A comparison sets each byte of its result to 0xff or 0, so
+// the results can be combined with a bitwise or, summed into counts, and
+// reduced to a bit mask for a search.
+using __byte_vector = exfs::__detail::__simd_vector<unsigned char>;
+
+// Returns a vector whose bytes are 0xff where a and b are equal.
+inline __byte_vector __equal (__byte_vector a, __byte_vector b) noexcept {
+#if defined(__AVX2__)
+    return {_mm256_cmpeq_epi8(a.values, b.values)};
+#else
+    return {_mm_cmpeq_epi8(a.values, b.values)};
+#endif
+}
+
+inline __byte_vector __either (__byte_vector a, __byte_vector b) noexcept {
+#if defined(__AVX2__)
+    return {_mm256_or_si256(a.values, b.values)};
+#else
+    return {_mm_or_si128(a.values, b.values)};
+#endif
+}
+
+// Subtracting the result of a comparison, whose bytes are 0 or -1, counts
+// the matches in each byte.
+inline __byte_vector __subtract (__byte_vector a, __byte_vector b) noexcept {
+#if defined(__AVX2__)
+    return {_mm256_sub_epi8(a.values, b.values)};
+#else
+    return {_mm_sub_epi8(a.values, b.values)};
+#endif
+}
+
+// Returns the sum of the bytes, as unsigned integers.
+inline std::size_t __sum (__byte_vector bytes) noexcept {
+#if defined(__AVX2__)
+    auto const sums = _mm256_sad_epu8(bytes.values, _mm256_setzero_si256());
+    auto const half = _mm_add_epi64(
+        _mm256_castsi256_si128(sums),
+        _mm256_extracti128_si256(sums, 1)
+    );
+#else
+    auto const half = _mm_sad_epu8(bytes.values, _mm_setzero_si128());
+#endif
+    return static_cast<std::size_t>(_mm_cvtsi128_si32(
+        _mm_add_epi64(half, _mm_srli_si128(half, 8))
+    ));
+}
+
+// Returns a bit mask of the bytes whose most significant bit is set.
+inline std::uint32_t __mask (__byte_vector bytes) noexcept {
+#if defined(__AVX2__)
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes.values));
+#else
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes.values));
+#endif
+}
+#endif
+
+// The largest set of bytes searched for by comparing with each of them.
+// Larger sets are searched through a lookup table.
+inline constexpr std::size_t __max_compared_set = 16u;
+
+// Returns the first byte in [first, last) which is equal to one of the N
+// needles.
+template <std::size_t N>
+constexpr unsigned char const* __find_any_of (
+    unsigned char const* first,
+    unsigned char const* last,
+    unsigned char const (&needles)[N]
+) noexcept {
+#if defined(__AVX2__) or defined(__SSE2__)
+    if (not std::is_constant_evaluated()) {
+        __byte_vector splats[N];
+        for (std::size_t i = 0u; i < N; ++i) {
+            splats[i] = __byte_vector::splat(needles[i]);
+        }
+        for (; last - first >= __byte_vector::width;
+            first += __byte_vector::width
+        ) {
+            auto const bytes = __byte_vector::load(first);
+            auto const matches = [&]<std::size_t... Is> (
+                index_sequence<0u, Is...>
+            ) {
+                auto found = __equal(bytes, splats[0]);
+                ((found = __either(found, __equal(bytes, splats[Is]))), ...);
+                return found;
+            }(make_index_sequence<N>{});
+            if (auto const mask = __mask(matches); mask != 0u) {
+                return first + __builtin_ctz(mask);
+            }
+        }
+    }
+#endif
+    for (; first != last; ++first) {
+        for (unsigned char const needle : needles) {
+            if (*first == needle) {
+                return first;
+            }
+        }
+    }
+    return last;
+}
+}  // namespace __detail
+
+/**
+ * @name Byte search kernels
+ *
+ * Searches a contiguous buffer of bytes, such as a received frame, for
+ * delimiters. On x86 targets compiled with SSE2 or AVX2, 16 or 32 bytes are
+ * compared at a time; other targets, and constant evaluation, use a scalar
+ * loop.
+ *
+ * The algorithms @c find_first_of and @c count use these kernels for
+ * contiguous ranges of single-byte integers. (@c find uses @c memchr, which
+ * hosted C libraries already vectorize.)
+ *
+ * @{
+ */
+
+/**
+ * Returns a pointer to the first byte in [@p first, @p last) equal to
+ * @p byte, or @p last if there is none.
+ */
+constexpr unsigned char const* find_byte (
+    unsigned char const* first,
+    unsigned char const* last,
+    unsigned char byte
+) noexcept {
+    unsigned char const needles[] = {byte};
+    return __detail::__find_any_of(first, last, needles);
+}
+
+/**
+ * Returns a pointer to the first byte in [@p first, @p last) equal to either
+ * @p byte_1 or @p byte_2, or @p last if there is none.
+ */
+constexpr unsigned char const* find_byte2 (
+    unsigned char const* first,
+    unsigned char const* last,
+    unsigned char byte_1,
+    unsigned char byte_2
+) noexcept {
+    unsigned char const needles[] = {byte_1, byte_2};
+    return __detail::__find_any_of(first, last, needles);
+}
+
+/**
+ * Returns a pointer to the first byte in [@p first, @p last) equal to one of
+ * @p byte_1, @p byte_2 or @p byte_3, or @p last if there is none.
+ */
+constexpr unsigned char const* find_byte3 (
+    unsigned char const* first,
+    unsigned char const* last,
+    unsigned char byte_1,
+    unsigned char byte_2,
+    unsigned char byte_3
+) noexcept {
+    unsigned char const needles[] = {byte_1, byte_2, byte_3};
+    return __detail::__find_any_of(first, last, needles);
+}
+
+/**
+ * Returns a pointer to the first byte in [@p first, @p last) equal to one of
+ * the bytes in [@p set_first, @p set_last), or @p last if there is none.
+ *
+ * Sets of up to 16 bytes are compared with each byte of the buffer in
+ * parallel. Larger sets are looked up in a table, one byte at a time.
+ */
+constexpr unsigned char const* find_first_byte_of (
+    unsigned char const* first,
+    unsigned char const* last,
+    unsigned char const* set_first,
+    unsigned char const* set_last
+) noexcept {
+    auto const set_size = static_cast<std::size_t>(set_last - set_first);
+    if (set_size <= 3u) {
+        switch (set_size) {
+            case 0u: return last;
+            case 1u: return find_byte(first, last, set_first[0]);
+            case 2u:
+                return find_byte2(first, last, set_first[0], set_first[1]);
+            default:
+                return find_byte3(
+                    first,
+                    last,
+                    set_first[0],
+                    set_first[1],
+                    set_first[2]
+                );
+        }
+    }
+
+    // Pad the set to a fixed size with repeats of its first byte, so that
+    // the comparisons are unrolled.
+    auto const find_padded = [&]<std::size_t N> (
+        std::integral_constant<std::size_t, N>
+    ) {
+        unsigned char needles[N]{};
+        for (std::size_t i = 0u; i < N; ++i) {
+            needles[i] = i < set_size ? set_first[i] : set_first[0];
+        }
+        return __detail::__find_any_of(first, last, needles);
+    };
+    if (set_size <= __detail::__max_compared_set / 2u) {
+        return find_padded(std::integral_constant<
+            std::size_t,
+            __detail::__max_compared_set / 2u
+        >{});
+    }
+    if (set_size <= __detail::__max_compared_set) {
+        return find_padded(std::integral_constant<
+            std::size_t,
+            __detail::__max_compared_set
+        >{});
+    }
+
+    bool in_set[256]{};
+    for (; set_first != set_last; ++set_first) {
+        in_set[*set_first] = true;
+    }
+    for (; first != last; ++first) {
+        if (in_set[*first]) {
+            break;
+        }
+    }
+    return first;
+}
+
+/**
+ * Returns the number of bytes in [@p first, @p last) equal to @p byte.
+ */
+constexpr std::size_t count_byte (
+    unsigned char const* first,
+    unsigned char const* last,
+    unsigned char byte
+) noexcept {
+    std::size_t count = 0u;
+#if defined(__AVX2__) or defined(__SSE2__)
+    if (not std::is_constant_evaluated()) {
+        using __detail::__byte_vector;
+        auto const splat = __byte_vector::splat(byte);
+        while (last - first >= __byte_vector::width) {
+            // Each byte of the counts holds at most 255 matches.
+            auto counts = __byte_vector::zero();
+            for (int i = 0;
+                i < 255 and last - first >= __byte_vector::width;
+                ++i, first += __byte_vector::width
+            ) {
+                counts = __detail::__subtract(
+                    counts,
+                    __detail::__equal(__byte_vector::load(first), splat)
+                );
+            }
+            count += __detail::__sum(counts);
+        }
+    }
+#endif
+    for (; first != last; ++first) {
+        count += *first == byte ? 1u : 0u;
+    }
+    return count;
+}
+
+/**
+ * @}
+ */
+}  // namespace exfs::algorithm
+
+#endif  // EXFS_ALGORITHM_BYTE_SEARCH_HPP_
@@ -0,0 +1,141 @@
+#include "exfs/algorithm/byte_search.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+namespace algorithm = exfs::algorithm;
+
+using Bytes = std::vector<unsigned char>;
+
+constexpr unsigned char const frame[] = "id=7;len=12\r\n";
+constexpr unsigned char const* const frame_end = frame + sizeof(frame) - 1u;
+
+static_assert(algorithm::find_byte(frame, frame_end, ';') == frame + 4);
+static_assert(algorithm::find_byte2(frame, frame_end, '\n', '=') == frame + 2);
+static_assert(
+    algorithm::find_byte3(frame, frame_end, '\r', '\n', 'x') == frame + 11
+);
+static_assert(algorithm::count_byte(frame, frame_end, '=') == 2u);
+
+// The buffers are longer than two vectors of the widest instruction set, and
+// every match position and length is tried so that the matches land in the
+// vector loop, in the scalar tail and on the boundary between them.
+constexpr std::size_t max_size = 80u;
+
+Bytes make_buffer (std::size_t size) {
+    Bytes buffer(size);
+    for (std::size_t i = 0u; i < size; ++i) {
+        buffer[i] = static_cast<unsigned char>('a' + i % 26u);
+    }
+    return buffer;
+}
+
+unsigned char const* naive_find_first_of (
+    Bytes const& buffer,
+    Bytes const& set
+) {
+    return std::find_first_of(
+        buffer.data(),
+        buffer.data() + buffer.size(),
+        set.data(),
+        set.data() + set.size()
+    );
+}
+}  // namespace
+
+SCENARIO (
+    "exfs::algorithm byte search kernels - agree with scalar searches",
+    "[unit][algorithm]"
+) {
+    GIVEN ("buffers of every size with a delimiter at every position") {
+        THEN ("find_byte finds the delimiter") {
+            for (std::size_t size = 0u; size <= max_size; ++size) {
+                for (std::size_t pos = 0u; pos <= size; ++pos) {
+                    auto buffer = make_buffer(size);
+                    if (pos < size) {
+                        buffer[pos] = '\n';
+                    }
+                    auto const* const first = buffer.data();
+                    auto const* const last = first + size;
+                    CHECK(algorithm::find_byte(first, last, '\n')
+                        == first + pos);
+                }
+            }
+        }
+
+        THEN ("find_byte2 and find_byte3 find the first of the delimiters") {
+            for (std::size_t size = 2u; size <= max_size; ++size) {
+                for (std::size_t pos = 0u; pos + 1u < size; ++pos) {
+                    auto buffer = make_buffer(size);
+                    buffer[size - 1u] = '\r';
+                    buffer[pos] = '\n';
+                    auto const* const first = buffer.data();
+                    auto const* const last = first + size;
+                    CHECK(algorithm::find_byte2(first, last, '\r', '\n')
+                        == first + pos);
+                    CHECK(algorithm::find_byte3(first, last, '\0', '\r', '\n')
+                        == first + pos);
+                    CHECK(algorithm::find_byte2(first, last, '\r', '\0')
+                        == last - 1);
+                }
+            }
+        }
+    }
+
+    GIVEN ("sets of delimiters of several sizes") {
+        Bytes const sets[] = {
+            {},
+            {'|'},
+            {'|', ','},
+            {'|', ',', ';'},
+            {'|', ',', ';', ':', '\t'},
+            {'0', '1', '2', '3', '4', '5', '6', '7',
+                '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'},
+            {'0', '1', '2', '3', '4', '5', '6', '7',
+                '8', '9', 'A', 'B', 'C', 'D', 'E', 'F', 'G'},
+        };
+
+        THEN ("find_first_byte_of agrees with std::find_first_of") {
+            for (auto const& set : sets) {
+                for (std::size_t size = 0u; size <= max_size; ++size) {
+                    for (std::size_t pos = 0u; pos <= size; ++pos) {
+                        auto buffer = make_buffer(size);
+                        if (pos < size and not set.empty()) {
+                            buffer[pos] = set[pos % set.size()];
+                        }
+                        auto const* const first = buffer.data();
+                        CHECK(algorithm::find_first_byte_of(
+                            first,
+                            first + size,
+                            set.data(),
+                            set.data() + set.size()
+                        ) == naive_find_first_of(buffer, set));
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN ("buffers with many occurrences of a byte") {
+        THEN ("count_byte counts all of them") {
+            for (std::size_t size = 0u; size <= max_size; ++size) {
+                Bytes buffer(size, 0xffu);
+                for (std::size_t i = 0u; i < size; i += 3u) {
+                    buffer[i] = 0x7eu;
+                }
+                auto const* const first = buffer.data();
+                auto const* const last = first + size;
+                CHECK(algorithm::count_byte(first, last, 0x7eu)
+                    == static_cast<std::size_t>(std::count(first, last, 0x7e)));
+                CHECK(algorithm::count_byte(first, last, 0xffu)
+                    == static_cast<std::size_t>(
+                        std::count(first, last, 0xffu)
+                    ));
+            }
+        }
+    }
+}
@@ -0,0 +1,217 @@
+#ifndef EXFS_ALGORITHM_COMPARE_HPP_
+#define EXFS_ALGORITHM_COMPARE_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "exfs/algorithm/bitwise.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/pair.hpp"
+
+namespace exfs::algorithm {
+namespace __detail {
+template <typename I1, typename I2>
+concept __indirectly_equality_comparable = requires (
+    iterator::iter_reference_t<I1> a,
+    iterator::iter_reference_t<I2> b
+) {
+    { a == b } -> std::convertible_to<bool>;
+};
+
+template <typename I1, typename I2>
+concept __indirectly_less_comparable = requires (
+    iterator::iter_reference_t<I1> a,
+    iterator::iter_reference_t<I2> b
+) {
+    { a < b } -> std::convertible_to<bool>;
+    { b < a } -> std::convertible_to<bool>;
+};
+
+template <typename I1, typename I2>
+int __memcmp_n (I1 first_1, I2 first_2, std::size_t count) {
+    if (count == 0u) {
+        return 0;
+    }
+    return __builtin_memcmp(
+        __address(first_1),
+        __address(first_2),
+        count * sizeof(__element_t<I1>)
+    );
+}
+}  // namespace __detail
+
+/**
+ * Finds the first position where the ranges [@p first_1, @p last_1) and
+ * [@p first_2, @p last_2) differ. Iteration stops at the end of the shorter
+ * range.
+ *
+ * @return The iterators to the first mismatching elements (or the ends of the
+ *     ranges).
+ */
+template <
+    iterator::input_iterator I1,
+    iterator::sentinel_for<I1> S1,
+    iterator::input_iterator I2,
+    iterator::sentinel_for<I2> S2
+>
+requires __detail::__indirectly_equality_comparable<I1, I2>
+constexpr utility::pair<I1, I2> mismatch (
+    I1 first_1,
+    S1 last_1,
+    I2 first_2,
+    S2 last_2
+) {
+    while (first_1 != last_1 and first_2 != last_2 and *first_1 == *first_2) {
+        ++first_1;
+        ++first_2;
+    }
+    return {exfs::move(first_1), exfs::move(first_2)};
+}
+
+/**
+ * @overload mismatch()
+ *
+ * @warning It is undefined behavior if the second range is shorter than the
+ *     first.
+ */
+template <
+    iterator::input_iterator I1,
+    iterator::sentinel_for<I1> S1,
+    iterator::input_iterator I2
+>
+requires __detail::__indirectly_equality_comparable<I1, I2>
+constexpr utility::pair<I1, I2> mismatch (I1 first_1, S1 last_1, I2 first_2) {
+    while (first_1 != last_1 and *first_1 == *first_2) {
+        ++first_1;
+        ++first_2;
+    }
+    return {exfs::move(first_1), exfs::move(first_2)};
+}
+
+/**
+ * Checks if the ranges [@p first_1, @p last_1) and [@p first_2, @p last_2)
+ * have the same length and equal elements.
+ *
+ * When both ranges are contiguous, their sizes are known in constant time and
+ * the elements are integers, enumerations or pointers of the same type, the
+ * ranges are compared with @c memcmp (except in constant evaluation).
+ */
+template <
+    iterator::input_iterator I1,
+    iterator::sentinel_for<I1> S1,
+    iterator::input_iterator I2,
+    iterator::sentinel_for<I2> S2
+>
+requires __detail::__indirectly_equality_comparable<I1, I2>
+constexpr bool equal (I1 first_1, S1 last_1, I2 first_2, S2 last_2) {
+    if constexpr (
+        iterator::sized_sentinel_for<S1, I1> and
+        iterator::sized_sentinel_for<S2, I2>
+    ) {
+        auto const count = last_1 - first_1;
+        if (count != last_2 - first_2) {
+            return false;
+        }
+        if constexpr (__detail::__bitwise_comparable<I1, I2>) {
+            if (not std::is_constant_evaluated()) {
+                auto const size = static_cast<std::size_t>(count);
+                return __detail::__memcmp_n(first_1, first_2, size) == 0;
+            }
+        }
+    }
+
+    auto const [end_1, end_2] = algorithm::mismatch(
+        exfs::move(first_1),
+        last_1,
+        exfs::move(first_2),
+        last_2
+    );
+    return end_1 == last_1 and end_2 == last_2;
+}
+
+/**
+ * @overload equal()
+ *
+ * @warning It is undefined behavior if the second range is shorter than the
+ *     first.
+ */
+template <
+    iterator::input_iterator I1,
+    iterator::sentinel_for<I1> S1,
+    iterator::input_iterator I2
+>
+requires __detail::__indirectly_equality_comparable<I1, I2>
+constexpr bool equal (I1 first_1, S1 last_1, I2 first_2) {
+    if constexpr (
+        iterator::sized_sentinel_for<S1, I1> and
+        __detail::__bitwise_comparable<I1, I2>
+    ) {
+        if (not std::is_constant_evaluated()) {
+            auto const size = static_cast<std::size_t>(last_1 - first_1);
+            return __detail::__memcmp_n(first_1, first_2, size) == 0;
+        }
+    }
+
+    return algorithm::mismatch(
+        exfs::move(first_1),
+        last_1,
+        exfs::move(first_2)
+    ).first == last_1;
+}
+
+/**
+ * Checks if the range [@p first_1, @p last_1) is lexicographically less than
+ * the range [@p first_2, @p last_2): the first mismatching element decides,
+ * and otherwise a proper prefix is less than the longer range.
+ *
+ * Contiguous ranges of unsigned bytes whose sizes are known in constant time
+ * are compared with @c memcmp (except in constant evaluation).
+ */
+template <
+    iterator::input_iterator I1,
+    iterator::sentinel_for<I1> S1,
+    iterator::input_iterator I2,
+    iterator::sentinel_for<I2> S2
+>
+requires __detail::__indirectly_less_comparable<I1, I2>
+constexpr bool lexicographical_compare (
+    I1 first_1,
+    S1 last_1,
+    I2 first_2,
+    S2 last_2
+) {
+    if constexpr (
+        iterator::sized_sentinel_for<S1, I1> and
+        iterator::sized_sentinel_for<S2, I2> and
+        __detail::__bitwise_comparable<I1, I2> and
+        __detail::__unsigned_byte<
+            std::remove_cv_t<__detail::__element_t<I1>>
+        >
+    ) {
+        if (not std::is_constant_evaluated()) {
+            auto const count_1 = last_1 - first_1;
+            auto const count_2 = last_2 - first_2;
+            auto const size = static_cast<std::size_t>(
+                count_1 < count_2 ? count_1 : count_2
+            );
+            int const result = __detail::__memcmp_n(first_1, first_2, size);
+            return result != 0 ? result < 0 : count_1 < count_2;
+        }
+    }
+
+    for (; first_2 != last_2; ++first_1, ++first_2) {
+        if (first_1 == last_1 or *first_1 < *first_2) {
+            return true;
+        }
+        if (*first_2 < *first_1) {
+            return false;
+        }
+    }
+    return false;
+}
+}  // namespace exfs::algorithm
+
+#endif  // EXFS_ALGORITHM_COMPARE_HPP_
@@ -0,0 +1,153 @@
+#include "exfs/algorithm/compare.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+constexpr int a[]{1, 2, 3};
+constexpr int b[]{1, 2, 4};
+static_assert(exfs::algorithm::equal(a, a + 3, a, a + 3));
+static_assert(not exfs::algorithm::equal(a, a + 3, b));
+static_assert(exfs::algorithm::mismatch(a, a + 3, b).first == a + 2);
+static_assert(exfs::algorithm::lexicographical_compare(a, a + 3, b, b + 3));
+static_assert(not exfs::algorithm::lexicographical_compare(a, a + 3, a, a + 2));
+
+constexpr unsigned char bytes[]{1, 2, 200};
+static_assert(
+    exfs::algorithm::lexicographical_compare(bytes, bytes + 2, bytes, bytes + 3)
+);
+}  // namespace
+
+TEMPLATE_TEST_CASE (
+    "exfs::algorithm::equal - matches std::equal",
+    "[unit][std-parity][algorithm]",
+    (std::vector<int>),
+    (std::vector<unsigned char>),
+    (std::list<int>)
+) {
+    GIVEN ("pairs of ranges") {
+        auto const [lhs, rhs] = GENERATE(table<
+            std::vector<int>,
+            std::vector<int>
+        >({
+            {{}, {}},
+            {{1, 2, 3}, {1, 2, 3}},
+            {{1, 2, 3}, {1, 2, 4}},
+            {{1, 2, 3}, {1, 2}},
+            {{1, 2}, {1, 2, 3}},
+            {{3}, {250}},
+        }));
+        TestType const first(lhs.begin(), lhs.end());
+        TestType const second(rhs.begin(), rhs.end());
+
+        THEN ("the four-iterator forms agree with std") {
+            CHECK(
+                exfs::algorithm::equal(
+                    first.begin(), first.end(),
+                    second.begin(), second.end()
+                ) == std::equal(
+                    first.begin(), first.end(),
+                    second.begin(), second.end()
+                )
+            );
+            CHECK(
+                exfs::algorithm::lexicographical_compare(
+                    first.begin(), first.end(),
+                    second.begin(), second.end()
+                ) == std::lexicographical_compare(
+                    first.begin(), first.end(),
+                    second.begin(), second.end()
+                )
+            );
+
+            auto const [it_1, it_2] = exfs::algorithm::mismatch(
+                first.begin(), first.end(),
+                second.begin(), second.end()
+            );
+            auto const [std_1, std_2] = std::mismatch(
+                first.begin(), first.end(),
+                second.begin(), second.end()
+            );
+            CHECK(it_1 == std_1);
+            CHECK(it_2 == std_2);
+        }
+
+        THEN ("the three-iterator forms agree with std") {
+            if (first.size() <= second.size()) {
+                CHECK(
+                    exfs::algorithm::equal(
+                        first.begin(), first.end(),
+                        second.begin()
+                    ) == std::equal(
+                        first.begin(), first.end(),
+                        second.begin()
+                    )
+                );
+                CHECK(
+                    exfs::algorithm::mismatch(
+                        first.begin(), first.end(),
+                        second.begin()
+                    ).first == std::mismatch(
+                        first.begin(), first.end(),
+                        second.begin()
+                    ).first
+                );
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::algorithm::lexicographical_compare - byte ordering",
+    "[unit][algorithm]"
+) {
+    GIVEN ("byte ranges which differ in the high bit") {
+        std::vector<std::byte> const low{std::byte{0x01}};
+        std::vector<std::byte> const high{std::byte{0x80}};
+
+        THEN ("bytes are ordered as unsigned") {
+            CHECK(exfs::algorithm::lexicographical_compare(
+                low.begin(), low.end(),
+                high.begin(), high.end()
+            ));
+            CHECK(not exfs::algorithm::lexicographical_compare(
+                high.begin(), high.end(),
+                low.begin(), low.end()
+            ));
+        }
+    }
+
+    GIVEN ("strings of signed characters") {
+        std::string const plain = "abc";
+        std::string const accented = "ab\xe9";
+
+        THEN ("the result matches std::lexicographical_compare") {
+            CHECK(
+                exfs::algorithm::lexicographical_compare(
+                    plain.begin(), plain.end(),
+                    accented.begin(), accented.end()
+                ) == std::lexicographical_compare(
+                    plain.begin(), plain.end(),
+                    accented.begin(), accented.end()
+                )
+            );
+        }
+    }
+
+    GIVEN ("ranges of doubles containing signed zeros") {
+        std::vector<double> const positive{0.0, 1.0};
+        std::vector<double> const negative{-0.0, 1.0};
+
+        THEN ("they compare equal by value") {
+            CHECK(exfs::algorithm::equal(
+                positive.begin(), positive.end(),
+                negative.begin(), negative.end()
+            ));
+        }
+    }
+}
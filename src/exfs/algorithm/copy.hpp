@@ -0,0 +1,181 @@
+#ifndef EXFS_ALGORITHM_COPY_HPP_
+#define EXFS_ALGORITHM_COPY_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "exfs/algorithm/bitwise.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/iterator/traits.hpp"
+
+namespace exfs::algorithm {
+namespace __detail {
+// Copies `count` elements from `first` to `out` with memmove, which also
+// handles overlapping ranges. Nothing is copied if `count` is not positive.
+template <typename I, typename O>
+O __memmove_n (I first, iterator::iter_difference_t<I> count, O out) {
+    if (count <= 0) {
+        return out;
+    }
+    __builtin_memmove(
+        __address(out),
+        __address(first),
+        static_cast<std::size_t>(count) * sizeof(__element_t<O>)
+    );
+    return out + count;
+}
+}  // namespace __detail
+
+/**
+ * Copies the elements in the range [@p first, @p last) to the range beginning
+ * at @p out, in order from first to last.
+ *
+ * When both ranges are contiguous, the size of the input is known in constant
+ * time and the elements are trivially copyable, the elements are copied with a
+ * single @c memmove (except in constant evaluation). A range of
+ * @c move_iterator over such elements is copied the same way.
+ *
+ * @warning It is undefined behavior if @p out is in [@p first, @p last).
+ *
+ * @return An iterator one past the last element copied to.
+ */
+template <
+    iterator::input_iterator I,
+    iterator::sentinel_for<I> S,
+    iterator::weakly_incrementable O
+>
+requires iterator::indirectly_writable<O, iterator::iter_reference_t<I>>
+constexpr O copy (I first, S last, O out) {
+    if constexpr (
+        __detail::__bitwise_copyable<__detail::__unwrap_move_t<I>, O> and
+        iterator::sized_sentinel_for<S, I>
+    ) {
+        if (not std::is_constant_evaluated()) {
+            return __detail::__memmove_n(
+                __detail::__unwrap(first),
+                last - first,
+                out
+            );
+        }
+    }
+
+    for (; first != last; ++first, ++out) {
+        *out = *first;
+    }
+    return out;
+}
+
+/**
+ * Copies exactly @p count elements from the range beginning at @p first to the
+ * range beginning at @p out. Nothing is copied if @p count is not positive.
+ *
+ * Uses @c memmove under the same conditions as @c copy.
+ *
+ * @return An iterator one past the last element copied to.
+ */
+template <iterator::input_iterator I, iterator::weakly_incrementable O>
+requires iterator::indirectly_writable<O, iterator::iter_reference_t<I>>
+constexpr O copy_n (I first, iterator::iter_difference_t<I> count, O out) {
+    if constexpr (
+        __detail::__bitwise_copyable<__detail::__unwrap_move_t<I>, O>
+    ) {
+        if (not std::is_constant_evaluated()) {
+            return __detail::__memmove_n(
+                __detail::__unwrap(first),
+                count,
+                out
+            );
+        }
+    }
+
+    for (; count > 0; --count, ++first, ++out) {
+        *out = *first;
+    }
+    return out;
+}
+
+/**
+ * Moves the elements in the range [@p first, @p last) to the range beginning
+ * at @p out, in order from first to last. The elements of the input range are
+ * left in a valid but unspecified state.
+ *
+ * Uses @c memmove under the same conditions as @c copy.
+ *
+ * @warning It is undefined behavior if @p out is in [@p first, @p last).
+ *
+ * @return An iterator one past the last element moved to.
+ */
+template <
+    iterator::input_iterator I,
+    iterator::sentinel_for<I> S,
+    iterator::weakly_incrementable O
+>
+requires iterator::indirectly_writable<
+    O,
+    iterator::iter_rvalue_reference_t<I>
+>
+constexpr O move (I first, S last, O out) {
+    if constexpr (
+        __detail::__bitwise_copyable<I, O> and
+        iterator::sized_sentinel_for<S, I>
+    ) {
+        if (not std::is_constant_evaluated()) {
+            return __detail::__memmove_n(first, last - first, out);
+        }
+    }
+
+    for (; first != last; ++first, ++out) {
+        *out = iterator::iter_move(first);
+    }
+    return out;
+}
+
+/**
+ * Moves the elements in the range [@p first, @p last) to the range ending at
+ * @p out_last, in order from last to first. Unlike @c move, the ranges may
+ * overlap as long as @p out_last is not in (@p first, @p last].
+ *
+ * Uses @c memmove under the same conditions as @c copy.
+ *
+ * @return An iterator to the last element moved to, i.e. the first element
+ *     of the output range.
+ */
+template <
+    iterator::bidirectional_iterator I1,
+    iterator::sentinel_for<I1> S1,
+    iterator::bidirectional_iterator I2
+>
+requires iterator::indirectly_writable<
+    I2,
+    iterator::iter_rvalue_reference_t<I1>
+>
+constexpr I2 move_backward (I1 first, S1 last, I2 out_last) {
+    if constexpr (
+        __detail::__bitwise_copyable<I1, I2> and
+        iterator::sized_sentinel_for<S1, I1>
+    ) {
+        if (not std::is_constant_evaluated()) {
+            auto const count = last - first;
+            __detail::__memmove_n(first, count, out_last - count);
+            return out_last - count;
+        }
+    }
+
+    I1 it = first;
+    if constexpr (std::same_as<S1, I1>) {
+        it = last;
+    } else {
+        while (it != last) {
+            ++it;
+        }
+    }
+    while (it != first) {
+        *--out_last = iterator::iter_move(--it);
+    }
+    return out_last;
+}
+}  // namespace exfs::algorithm
+
+#endif  // EXFS_ALGORITHM_COPY_HPP_
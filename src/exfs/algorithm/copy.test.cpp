@@ -0,0 +1,272 @@
+#include "exfs/algorithm/copy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/move_iterator.hpp"
+
+namespace {
+constexpr int constexpr_copy () {
+    int source[4]{1, 2, 3, 4};
+    int dest[4]{};
+    exfs::algorithm::copy(source, source + 4, dest);
+    exfs::algorithm::move_backward(dest, dest + 3, dest + 4);
+    return dest[0] * 1000 + dest[1] * 100 + dest[2] * 10 + dest[3];
+}
+static_assert(constexpr_copy() == 1123);
+
+constexpr int constexpr_copy_n () {
+    std::array<int, 3> source{5, 6, 7};
+    std::array<int, 3> dest{};
+    auto const end = exfs::algorithm::copy_n(source.begin(), 2, dest.begin());
+    return static_cast<int>(end - dest.begin()) * 100 + dest[0] * 10 + dest[1];
+}
+static_assert(constexpr_copy_n() == 256);
+}  // namespace
+
+TEMPLATE_TEST_CASE (
+    "exfs::algorithm::copy - matches std::copy",
+    "[unit][std-parity][algorithm]",
+    (std::vector<int>),
+    (std::list<int>),
+    (std::vector<std::string>)
+) {
+    using value_type = typename TestType::value_type;
+
+    GIVEN ("a source range") {
+        TestType const source{
+            value_type{}, value_type{}, value_type{}, value_type{}
+        };
+        std::vector<value_type> expected(6);
+        std::vector<value_type> actual(6);
+
+        WHEN ("it is copied into the middle of a destination") {
+            auto const std_end = std::copy(
+                source.begin(),
+                source.end(),
+                expected.begin() + 1
+            );
+            auto const exfs_end = exfs::algorithm::copy(
+                source.begin(),
+                source.end(),
+                actual.begin() + 1
+            );
+
+            THEN ("the destinations and returned iterators agree") {
+                CHECK(actual == expected);
+                CHECK(exfs_end - actual.begin() == std_end - expected.begin());
+            }
+        }
+
+        WHEN ("a prefix is copied with copy_n") {
+            auto const exfs_end = exfs::algorithm::copy_n(
+                source.begin(),
+                3,
+                actual.begin()
+            );
+
+            THEN ("exactly that many elements are copied") {
+                CHECK(exfs_end == actual.begin() + 3);
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::algorithm::copy - trivially copyable ranges",
+    "[unit][algorithm]"
+) {
+    GIVEN ("a contiguous range of integers") {
+        std::vector<int> source{1, 2, 3, 4, 5};
+        std::vector<int> dest(5, 0);
+
+        WHEN ("it is copied") {
+            auto const end = exfs::algorithm::copy(
+                source.begin(),
+                source.end(),
+                dest.begin()
+            );
+
+            THEN ("the destination holds the same elements") {
+                CHECK(dest == source);
+                CHECK(end == dest.end());
+            }
+        }
+
+        WHEN ("an empty range is copied") {
+            auto const end = exfs::algorithm::copy(
+                source.begin(),
+                source.begin(),
+                dest.begin()
+            );
+
+            THEN ("nothing is written") {
+                CHECK(end == dest.begin());
+                CHECK(dest == std::vector<int>(5, 0));
+            }
+        }
+
+        WHEN ("a negative count is passed to copy_n") {
+            auto const end = exfs::algorithm::copy_n(
+                source.begin(),
+                -2,
+                dest.begin()
+            );
+
+            THEN ("nothing is written") {
+                CHECK(end == dest.begin());
+                CHECK(dest == std::vector<int>(5, 0));
+            }
+        }
+
+        WHEN ("const elements are copied into a raw array") {
+            int const* const begin = source.data();
+            int array[5]{};
+            auto const end = exfs::algorithm::copy(begin, begin + 5, array);
+
+            THEN ("the array holds the same elements") {
+                CHECK(end == array + 5);
+                CHECK(std::equal(array, array + 5, source.begin()));
+            }
+        }
+
+        WHEN ("it is copied to a list") {
+            std::list<int> list(5, 0);
+            exfs::algorithm::copy(source.begin(), source.end(), list.begin());
+
+            THEN ("the list holds the same elements") {
+                CHECK(std::equal(list.begin(), list.end(), source.begin()));
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::algorithm::move - moved elements",
+    "[unit][std-parity][algorithm]"
+) {
+    GIVEN ("a range of strings") {
+        std::vector<std::string> source{
+            std::string(40, 'a'),
+            std::string(40, 'b')
+        };
+        std::vector<std::string> dest(2);
+
+        WHEN ("it is moved") {
+            auto const end = exfs::algorithm::move(
+                source.begin(),
+                source.end(),
+                dest.begin()
+            );
+
+            THEN ("the elements are transferred") {
+                CHECK(end == dest.end());
+                CHECK(dest[0] == std::string(40, 'a'));
+                CHECK(dest[1] == std::string(40, 'b'));
+                CHECK(source[0].empty());
+            }
+        }
+    }
+
+    GIVEN ("overlapping ranges") {
+        std::vector<int> std_values{1, 2, 3, 4, 5, 6};
+        std::list<int> list_values{1, 2, 3, 4, 5, 6};
+        std::vector<int> values = std_values;
+
+        WHEN ("elements are moved backward onto their own tail") {
+            auto const std_first = std::move_backward(
+                std_values.begin(),
+                std_values.begin() + 4,
+                std_values.end()
+            );
+            auto const first = exfs::algorithm::move_backward(
+                values.begin(),
+                values.begin() + 4,
+                values.end()
+            );
+            exfs::algorithm::move_backward(
+                list_values.begin(),
+                std::next(list_values.begin(), 4),
+                list_values.end()
+            );
+
+            THEN ("the elements are shifted without being clobbered") {
+                CHECK(values == std_values);
+                CHECK(first - values.begin() == std_first - std_values.begin());
+                CHECK(std::equal(
+                    list_values.begin(),
+                    list_values.end(),
+                    std_values.begin()
+                ));
+            }
+        }
+
+        WHEN ("elements are moved forward onto their own head") {
+            auto const std_end = std::move(
+                std_values.begin() + 2,
+                std_values.end(),
+                std_values.begin()
+            );
+            auto const end = exfs::algorithm::move(
+                values.begin() + 2,
+                values.end(),
+                values.begin()
+            );
+
+            THEN ("the elements are shifted without being clobbered") {
+                CHECK(values == std_values);
+                CHECK(end - values.begin() == std_end - std_values.begin());
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::algorithm::copy - move iterators",
+    "[unit][algorithm]"
+) {
+    GIVEN ("a range of strings") {
+        std::vector<std::string> source{
+            std::string(40, 'a'),
+            std::string(40, 'b')
+        };
+        std::vector<std::string> dest(2);
+
+        WHEN ("it is copied through move iterators") {
+            exfs::algorithm::copy(
+                exfs::iterator::move_iterator{source.begin()},
+                exfs::iterator::move_iterator{source.end()},
+                dest.begin()
+            );
+
+            THEN ("the elements are moved") {
+                CHECK(dest[1] == std::string(40, 'b'));
+                CHECK(source[0].empty());
+                CHECK(source[1].empty());
+            }
+        }
+    }
+
+    GIVEN ("a contiguous range of integers") {
+        std::array<int, 5> const source{1, 2, 3, 4, 5};
+        std::array<int, 5> dest{};
+
+        WHEN ("it is copied through move iterators") {
+            auto const end = exfs::algorithm::copy_n(
+                exfs::iterator::move_iterator{source.data()},
+                4,
+                dest.data()
+            );
+
+            THEN ("the elements are copied") {
+                CHECK(end == dest.data() + 4);
+                CHECK(dest == std::array<int, 5>{1, 2, 3, 4, 0});
+            }
+        }
+    }
+}
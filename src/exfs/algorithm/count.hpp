@@ -0,0 +1,60 @@
+#ifndef EXFS_ALGORITHM_COUNT_HPP_
+#define EXFS_ALGORITHM_COUNT_HPP_
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/algorithm/bitwise.hpp"
+#include "exfs/algorithm/byte_search.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/traits.hpp"
+
+namespace exfs::algorithm {
+/**
+ * Counts the elements in the range [@p first, @p last) which are equal to
+ * @p value.
+ *
+ * Contiguous ranges of single-byte integers (or enumerations) whose size is
+ * known in constant time are counted with @c count_byte (except in constant
+ * evaluation).
+ *
+ * @return The number of elements equal to @p value.
+ */
+template <iterator::input_iterator I, iterator::sentinel_for<I> S, typename T>
+requires requires (iterator::iter_reference_t<I> ref, T const& value) {
+    { ref == value } -> std::convertible_to<bool>;
+}
+constexpr iterator::iter_difference_t<I> count (
+    I first,
+    S last,
+    T const& value
+) {
+    if constexpr (
+        __detail::__memchr_searchable<I, T> and
+        iterator::sized_sentinel_for<S, I>
+    ) {
+        if (not std::is_constant_evaluated()) {
+            auto const size = last - first;
+            if (size <= 0) {
+                return 0;
+            }
+            auto const* const begin = __detail::__byte_address(first);
+            return static_cast<iterator::iter_difference_t<I>>(count_byte(
+                begin,
+                begin + size,
+                static_cast<unsigned char>(value)
+            ));
+        }
+    }
+
+    iterator::iter_difference_t<I> count = 0;
+    for (; first != last; ++first) {
+        if (*first == value) {
+            ++count;
+        }
+    }
+    return count;
+}
+}  // namespace exfs::algorithm
+
+#endif  // EXFS_ALGORITHM_COUNT_HPP_
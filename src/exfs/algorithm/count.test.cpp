@@ -0,0 +1,77 @@
+#include "exfs/algorithm/count.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+constexpr char const text[] = "constant evaluation";
+static_assert(exfs::algorithm::count(text, text + sizeof(text), 'n') == 3);
+static_assert(exfs::algorithm::count(text, text + 5, 'z') == 0);
+}  // namespace
+
+TEMPLATE_TEST_CASE (
+    "exfs::algorithm::count - matches std::count",
+    "[unit][std-parity][algorithm]",
+    char,
+    signed char,
+    std::uint8_t,
+    std::byte,
+    int
+) {
+    GIVEN ("a long range with repeated values") {
+        std::vector<TestType> values;
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(static_cast<TestType>(i % 7 - 1));
+        }
+        std::list<TestType> const list(values.begin(), values.end());
+
+        THEN ("every value is counted like with std::count") {
+            for (int v : {-1, 0, 5, 9}) {
+                auto const value = static_cast<TestType>(v);
+                auto const expected = std::count(
+                    values.begin(),
+                    values.end(),
+                    value
+                );
+                CHECK(exfs::algorithm::count(
+                    values.begin(),
+                    values.end(),
+                    value
+                ) == expected);
+                CHECK(exfs::algorithm::count(
+                    list.begin(),
+                    list.end(),
+                    value
+                ) == expected);
+            }
+        }
+
+        THEN ("an empty range has no elements equal to any value") {
+            CHECK(exfs::algorithm::count(
+                values.end(),
+                values.end(),
+                TestType{}
+            ) == 0);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::algorithm::count - mixed value types",
+    "[unit][algorithm]"
+) {
+    GIVEN ("a string") {
+        std::string const text = "needle in a haystack";
+
+        THEN ("an int is compared with the characters") {
+            CHECK(exfs::algorithm::count(text.begin(), text.end(), int{'e'})
+                == 3);
+        }
+    }
+}
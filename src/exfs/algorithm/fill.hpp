@@ -0,0 +1,112 @@
+#ifndef EXFS_ALGORITHM_FILL_HPP_
+#define EXFS_ALGORITHM_FILL_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "exfs/algorithm/bitwise.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/traits.hpp"
+
+namespace exfs::algorithm {
+namespace __detail {
+// Filling a range of O with a T can be done with memset when the bytes of
+// every element are the same: for single-byte elements, or for a value with
+// an all-zero object representation.
+template <typename O, typename T>
+concept __memsettable =
+    iterator::contiguous_iterator<O> and
+    __bitwise_equality<__element_t<O>> and
+    not std::is_volatile_v<__element_t<O>> and
+    std::same_as<std::remove_cv_t<T>, __element_t<O>>;
+
+template <typename T>
+constexpr bool __uniform_bytes (T const& value) noexcept {
+    return sizeof(T) == 1u or value == T{};
+}
+
+template <typename O, typename T>
+O __memset_n (O first, iterator::iter_difference_t<O> count, T const& value) {
+    if (count <= 0) {
+        return first;
+    }
+    unsigned char byte = 0u;
+    if constexpr (sizeof(T) == 1u) {
+        byte = static_cast<unsigned char>(value);
+    }
+    __builtin_memset(
+        __address(first),
+        byte,
+        static_cast<std::size_t>(count) * sizeof(T)
+    );
+    return first + count;
+}
+}  // namespace __detail
+
+/**
+ * Assigns @p value to every element in the range [@p first, @p last).
+ *
+ * Contiguous ranges of integers, enumerations or pointers whose size is known
+ * in constant time are filled with @c memset (except in constant evaluation)
+ * when the elements are single bytes or @p value is zero.
+ *
+ * @return @p last, as an iterator.
+ */
+template <
+    typename T,
+    iterator::input_or_output_iterator O,
+    iterator::sentinel_for<O> S
+>
+requires iterator::indirectly_writable<O, T const&>
+constexpr O fill (O first, S last, T const& value) {
+    if constexpr (
+        __detail::__memsettable<O, T> and
+        iterator::sized_sentinel_for<S, O>
+    ) {
+        if (
+            not std::is_constant_evaluated() and
+            __detail::__uniform_bytes(value)
+        ) {
+            return __detail::__memset_n(first, last - first, value);
+        }
+    }
+
+    for (; first != last; ++first) {
+        *first = value;
+    }
+    return first;
+}
+
+/**
+ * Assigns @p value to the first @p count elements of the range beginning at
+ * @p first. Nothing is assigned if @p count is not positive.
+ *
+ * Uses @c memset under the same conditions as @c fill.
+ *
+ * @return An iterator one past the last element assigned.
+ */
+template <typename T, iterator::input_or_output_iterator O>
+requires iterator::indirectly_writable<O, T const&>
+constexpr O fill_n (
+    O first,
+    iterator::iter_difference_t<O> count,
+    T const& value
+) {
+    if constexpr (__detail::__memsettable<O, T>) {
+        if (
+            not std::is_constant_evaluated() and
+            __detail::__uniform_bytes(value)
+        ) {
+            return __detail::__memset_n(first, count, value);
+        }
+    }
+
+    for (; count > 0; --count, ++first) {
+        *first = value;
+    }
+    return first;
+}
+}  // namespace exfs::algorithm
+
+#endif  // EXFS_ALGORITHM_FILL_HPP_
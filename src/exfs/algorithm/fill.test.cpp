@@ -0,0 +1,112 @@
+#include "exfs/algorithm/fill.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+enum class Color : std::uint16_t { red, green = 0x0101 };
+
+constexpr int constexpr_fill () {
+    int values[4]{};
+    exfs::algorithm::fill(values, values + 4, 3);
+    exfs::algorithm::fill_n(values, 2, 0);
+    return values[0] + values[1] + values[2] + values[3];
+}
+static_assert(constexpr_fill() == 6);
+}  // namespace
+
+TEMPLATE_TEST_CASE (
+    "exfs::algorithm::fill - matches std::fill",
+    "[unit][std-parity][algorithm]",
+    char,
+    std::uint8_t,
+    int,
+    std::int64_t,
+    double,
+    std::byte,
+    Color
+) {
+    auto const check_value = [] (TestType const value) {
+        std::vector<TestType> expected(9, TestType{});
+        std::vector<TestType> actual(9, TestType{});
+
+        std::fill(expected.begin() + 1, expected.end() - 1, value);
+        auto const end = exfs::algorithm::fill(
+            actual.begin() + 1,
+            actual.end() - 1,
+            value
+        );
+        CHECK(actual == expected);
+        CHECK(end == actual.end() - 1);
+
+        std::fill_n(expected.begin(), 3, TestType{});
+        CHECK(exfs::algorithm::fill_n(actual.begin(), 3, TestType{})
+            == actual.begin() + 3);
+        CHECK(actual == expected);
+    };
+
+    GIVEN ("a zero value") {
+        THEN ("the range is filled with it") {
+            check_value(TestType{});
+        }
+    }
+
+    GIVEN ("a value with distinct bytes") {
+        THEN ("the range is filled with it") {
+            if constexpr (std::is_same_v<TestType, Color>) {
+                check_value(Color::green);
+            } else {
+                check_value(TestType{static_cast<TestType>(0x7f)});
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::algorithm::fill - edge cases",
+    "[unit][algorithm]"
+) {
+    GIVEN ("a range of pointers") {
+        int x = 0;
+        std::vector<int*> pointers(4, &x);
+
+        WHEN ("it is filled with null pointers") {
+            exfs::algorithm::fill(pointers.begin(), pointers.end(), nullptr);
+
+            THEN ("every element is null") {
+                CHECK(std::count(pointers.begin(), pointers.end(), nullptr)
+                    == 4);
+            }
+        }
+    }
+
+    GIVEN ("a non-contiguous range") {
+        std::list<int> values(4, 1);
+
+        WHEN ("it is filled") {
+            exfs::algorithm::fill(values.begin(), values.end(), 0);
+
+            THEN ("every element is assigned") {
+                CHECK(values == std::list<int>(4, 0));
+            }
+        }
+    }
+
+    GIVEN ("a contiguous range of integers") {
+        std::vector<int> values(4, 1);
+
+        WHEN ("fill_n is called with a negative count") {
+            auto const end = exfs::algorithm::fill_n(values.begin(), -1, 0);
+
+            THEN ("nothing is assigned") {
+                CHECK(end == values.begin());
+                CHECK(values == std::vector<int>(4, 1));
+            }
+        }
+    }
+}
@@ -0,0 +1,124 @@
+#ifndef EXFS_ALGORITHM_FIND_HPP_
+#define EXFS_ALGORITHM_FIND_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "exfs/algorithm/bitwise.hpp"
+#include "exfs/algorithm/byte_search.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/traits.hpp"
+
+namespace exfs::algorithm {
+/**
+ * Finds the first element in the range [@p first, @p last) which is equal to
+ * @p value.
+ *
+ * Contiguous ranges of single-byte integers (or enumerations) whose size is
+ * known in constant time are searched with @c memchr (except in constant
+ * evaluation).
+ *
+ * @return An iterator to the first element equal to @p value, or @p last (as
+ *     an iterator) if there is none.
+ */
+template <iterator::input_iterator I, iterator::sentinel_for<I> S, typename T>
+requires requires (iterator::iter_reference_t<I> ref, T const& value) {
+    { ref == value } -> std::convertible_to<bool>;
+}
+constexpr I find (I first, S last, T const& value) {
+    if constexpr (
+        __detail::__memchr_searchable<I, T> and
+        iterator::sized_sentinel_for<S, I>
+    ) {
+        if (not std::is_constant_evaluated()) {
+            auto const count = last - first;
+            if (count <= 0) {
+                return first;
+            }
+            auto const* const begin = __detail::__address(first);
+            auto const* const found = static_cast<decltype(begin)>(
+                __builtin_memchr(
+                    begin,
+                    static_cast<unsigned char>(value),
+                    static_cast<std::size_t>(count)
+                )
+            );
+            return first + (found ? found - begin : count);
+        }
+    }
+
+    for (; first != last; ++first) {
+        if (*first == value) {
+            break;
+        }
+    }
+    return first;
+}
+
+/**
+ * Finds the first element in the range [@p first, @p last) which is equal to
+ * any of the elements in [@p s_first, @p s_last).
+ *
+ * Contiguous ranges of single-byte integers (or enumerations) whose sizes are
+ * known in constant time are searched with @c find_first_byte_of (except in
+ * constant evaluation).
+ *
+ * @return An iterator to the first element equal to one of the searched
+ *     elements, or @p last (as an iterator) if there is none.
+ */
+template <
+    iterator::input_iterator I1,
+    iterator::sentinel_for<I1> S1,
+    iterator::forward_iterator I2,
+    iterator::sentinel_for<I2> S2
+>
+requires requires (
+    iterator::iter_reference_t<I1> ref,
+    iterator::iter_reference_t<I2> value
+) {
+    { ref == value } -> std::convertible_to<bool>;
+}
+constexpr I1 find_first_of (I1 first, S1 last, I2 s_first, S2 s_last) {
+    if constexpr (
+        __detail::__memchr_searchable<
+            I1,
+            std::remove_cv_t<__detail::__element_t<I2>>
+        > and
+        __detail::__memchr_searchable<
+            I2,
+            std::remove_cv_t<__detail::__element_t<I1>>
+        > and
+        iterator::sized_sentinel_for<S1, I1> and
+        iterator::sized_sentinel_for<S2, I2>
+    ) {
+        if (not std::is_constant_evaluated()) {
+            auto const count = last - first;
+            auto const set_size = s_last - s_first;
+            if (count <= 0 or set_size <= 0) {
+                return first + (count < 0 ? 0 : count);
+            }
+            auto const* const begin = __detail::__byte_address(first);
+            auto const* const set_begin = __detail::__byte_address(s_first);
+            auto const* const found = find_first_byte_of(
+                begin,
+                begin + count,
+                set_begin,
+                set_begin + set_size
+            );
+            return first + (found - begin);
+        }
+    }
+
+    for (; first != last; ++first) {
+        for (I2 it = s_first; it != s_last; ++it) {
+            if (*first == *it) {
+                return first;
+            }
+        }
+    }
+    return first;
+}
+}  // namespace exfs::algorithm
+
+#endif  // EXFS_ALGORITHM_FIND_HPP_
@@ -0,0 +1,148 @@
+#include "exfs/algorithm/find.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+constexpr char const text[] = "constant evaluation";
+static_assert(
+    exfs::algorithm::find(text, text + sizeof(text), 'e') == text + 9
+);
+static_assert(exfs::algorithm::find(text, text + 5, 'z') == text + 5);
+
+constexpr char const vowels[] = "aeiou";
+static_assert(
+    exfs::algorithm::find_first_of(text, text + 5, vowels, vowels + 5)
+        == text + 1
+);
+}  // namespace
+
+TEMPLATE_TEST_CASE (
+    "exfs::algorithm::find - matches std::find",
+    "[unit][std-parity][algorithm]",
+    char,
+    signed char,
+    std::uint8_t,
+    int
+) {
+    GIVEN ("a range with repeated and negative values") {
+        std::vector<TestType> const values{
+            TestType(5), TestType(-1), TestType(0), TestType(5), TestType(-1)
+        };
+        std::list<TestType> const list(values.begin(), values.end());
+
+        THEN ("every value is found at the same position as std::find") {
+            for (int v : {5, -1, 0, 7}) {
+                auto const value = static_cast<TestType>(v);
+                auto const expected = std::find(
+                    values.begin(),
+                    values.end(),
+                    value
+                );
+                auto const actual = exfs::algorithm::find(
+                    values.begin(),
+                    values.end(),
+                    value
+                );
+                auto const in_list = exfs::algorithm::find(
+                    list.begin(),
+                    list.end(),
+                    value
+                );
+                CHECK(actual == expected);
+                CHECK(std::distance(list.begin(), in_list)
+                    == expected - values.begin());
+            }
+        }
+
+        THEN ("an empty range yields its end") {
+            CHECK(exfs::algorithm::find(values.end(), values.end(), TestType{})
+                == values.end());
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::algorithm::find - mixed value types",
+    "[unit][algorithm]"
+) {
+    GIVEN ("a string") {
+        std::string const text = "needle in a haystack";
+
+        WHEN ("an int is searched for") {
+            auto const it = exfs::algorithm::find(
+                text.begin(),
+                text.end(),
+                int{'y'}
+            );
+
+            THEN ("it is compared with the characters") {
+                CHECK(it - text.begin() == 14);
+            }
+        }
+
+        WHEN ("a value outside the range of char is searched for") {
+            auto const it = exfs::algorithm::find(
+                text.begin(),
+                text.end(),
+                int{'y'} + 256
+            );
+
+            THEN ("it is not truncated to a char") {
+                CHECK(it == text.end());
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE (
+    "exfs::algorithm::find_first_of - matches std::find_first_of",
+    "[unit][std-parity][algorithm]",
+    char,
+    std::uint8_t,
+    int
+) {
+    GIVEN ("a long range and sets of several sizes") {
+        std::vector<TestType> values;
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(static_cast<TestType>(i % 50));
+        }
+        std::list<TestType> const list(values.begin(), values.end());
+
+        THEN ("the same element is found as with std::find_first_of") {
+            for (std::size_t size : {0u, 1u, 2u, 3u, 5u, 16u, 20u}) {
+                std::vector<TestType> set;
+                for (std::size_t i = 0u; i < size; ++i) {
+                    set.push_back(static_cast<TestType>(90 - 3 * int(i)));
+                }
+                auto const expected = std::find_first_of(
+                    values.begin(),
+                    values.end(),
+                    set.begin(),
+                    set.end()
+                );
+                auto const actual = exfs::algorithm::find_first_of(
+                    values.begin(),
+                    values.end(),
+                    set.begin(),
+                    set.end()
+                );
+                auto const in_list = exfs::algorithm::find_first_of(
+                    list.begin(),
+                    list.end(),
+                    set.begin(),
+                    set.end()
+                );
+                CHECK(actual == expected);
+                CHECK(std::distance(list.begin(), in_list)
+                    == expected - values.begin());
+            }
+        }
+    }
+}
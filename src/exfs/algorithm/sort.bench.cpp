@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/algorithm/sort.hpp"
+
+namespace {
+// Each iteration sorts a copy of one of a set of batches of random 12-bit
+// samples, like the readings of an ADC fed to a median filter. Cycling
+// through the batches keeps the branch predictor from learning a single one.
+constexpr std::size_t batch_count = 64u;
+
+template <std::size_t N>
+using Batch = std::array<std::uint16_t, N>;
+
+template <std::size_t N>
+std::array<Batch<N>, batch_count> make_batches () {
+    std::array<Batch<N>, batch_count> batches{};
+    std::uint32_t state = 0x2545f491u;
+    for (auto& batch : batches) {
+        for (auto& sample : batch) {
+            state = state * 1664525u + 1013904223u;
+            sample = static_cast<std::uint16_t>(state >> 20);
+        }
+    }
+    return batches;
+}
+
+template <std::size_t N, typename Sort>
+void run (benchmark::State& state, Sort sort) {
+    auto const batches = make_batches<N>();
+    std::size_t next = 0u;
+
+    for (auto _ : state) {
+        Batch<N> batch = batches[next];
+        next = (next + 1u) % batch_count;
+        benchmark::DoNotOptimize(batch.data());
+        sort(batch);
+        benchmark::DoNotOptimize(batch.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+template <std::size_t N>
+void sort_std (benchmark::State& state) {
+    run<N>(state, [] (Batch<N>& batch) {
+        std::sort(batch.begin(), batch.end());
+    });
+}
+
+// The size is only known at run time, so introsort is used.
+template <std::size_t N>
+void sort_introsort (benchmark::State& state) {
+    run<N>(state, [] (Batch<N>& batch) {
+        exfs::algorithm::sort(batch.begin(), batch.end());
+    });
+}
+
+// The size is a constant, so a sorting network is used up to 32 elements.
+template <std::size_t N>
+void sort_constant_size (benchmark::State& state) {
+    run<N>(state, [] (Batch<N>& batch) {
+        exfs::algorithm::sort(batch);
+    });
+}
+
+BENCHMARK_TEMPLATE(sort_std, 4);
+BENCHMARK_TEMPLATE(sort_introsort, 4);
+BENCHMARK_TEMPLATE(sort_constant_size, 4);
+BENCHMARK_TEMPLATE(sort_std, 8);
+BENCHMARK_TEMPLATE(sort_introsort, 8);
+BENCHMARK_TEMPLATE(sort_constant_size, 8);
+BENCHMARK_TEMPLATE(sort_std, 16);
+BENCHMARK_TEMPLATE(sort_introsort, 16);
+BENCHMARK_TEMPLATE(sort_constant_size, 16);
+BENCHMARK_TEMPLATE(sort_std, 32);
+BENCHMARK_TEMPLATE(sort_introsort, 32);
+BENCHMARK_TEMPLATE(sort_constant_size, 32);
+BENCHMARK_TEMPLATE(sort_std, 64);
+BENCHMARK_TEMPLATE(sort_introsort, 64);
+BENCHMARK_TEMPLATE(sort_constant_size, 64);
+}  // namespace
@@ -0,0 +1,371 @@
+#ifndef EXFS_ALGORITHM_SORT_HPP_
+#define EXFS_ALGORITHM_SORT_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/operations.hpp"
+#include "exfs/utility/comparison.hpp"
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/integer_sequence.hpp"
+
+namespace exfs::algorithm {
+namespace __detail {
+template <typename I, typename Comp>
+concept __sortable =
+    iterator::random_access_iterator<I> and
+    std::movable<iterator::iter_value_t<I>> and
+    std::constructible_from<
+        iterator::iter_value_t<I>,
+        iterator::iter_rvalue_reference_t<I>
+    > and
+    iterator::indirectly_writable<I, iterator::iter_value_t<I>> and
+    iterator::indirectly_writable<I, iterator::iter_rvalue_reference_t<I>> and
+    std::predicate<
+        Comp&,
+        iterator::iter_reference_t<I>,
+        iterator::iter_reference_t<I>
+    > and
+    std::predicate<
+        Comp&,
+        iterator::iter_value_t<I>&,
+        iterator::iter_reference_t<I>
+    >;
+
+// The largest size sorted with a sorting network.
+inline constexpr std::size_t __max_network_size = 32u;
+
+// Ranges shorter than this are sorted by insertion within introsort.
+inline constexpr std::ptrdiff_t __insertion_sort_threshold = 16;
+
+// Elements which are cheap to copy are compare-exchanged by selecting both
+// results from copies, which compiles to conditional moves or min/max
+// instructions instead of a branch on unpredictable data.
+template <typename I>
+concept __branchless_exchangeable =
+    std::is_lvalue_reference_v<iterator::iter_reference_t<I>> and
+    std::same_as<
+        std::remove_cvref_t<iterator::iter_reference_t<I>>,
+        iterator::iter_value_t<I>
+    > and
+    std::is_trivially_copyable_v<iterator::iter_value_t<I>> and
+    sizeof(iterator::iter_value_t<I>) <= 2u * sizeof(void*);
+
+// Orders the elements at a and b.
+template <typename I, typename Comp>
+constexpr void __compare_exchange (I a, I b, Comp& comp) {
+    if constexpr (__branchless_exchangeable<I>) {
+        auto const x = *a;
+        auto const y = *b;
+        bool const swap = comp(y, x);
+        *a = swap ? y : x;
+        *b = swap ? x : y;
+    } else {
+        if (comp(*b, *a)) {
+            iterator::iter_swap(a, b);
+        }
+    }
+}
+
+struct __comparator {
+    std::uint8_t lo;
+    std::uint8_t hi;
+};
+
+// Calls `fn(i, j)` for each comparator of Batcher's merge exchange network for
+// n elements (Knuth, TAOCP vol. 3, algorithm 5.2.2M).
+template <typename Fn>
+constexpr void __merge_exchange (std::size_t n, Fn&& fn) {
+    if (n < 2u) {
+        return;
+    }
+    std::size_t t = 0u;
+    while ((std::size_t{1} << t) < n) {
+        ++t;
+    }
+    for (std::size_t p = std::size_t{1} << (t - 1u); p > 0u; p >>= 1u) {
+        std::size_t q = std::size_t{1} << (t - 1u);
+        std::size_t r = 0u;
+        for (std::size_t d = p; d > 0u; d = q - p, q >>= 1u, r = p) {
+            for (std::size_t i = 0u; i + d < n; ++i) {
+                if ((i & p) == r) {
+                    fn(i, i + d);
+                }
+            }
+        }
+    }
+}
+
+template <std::size_t N>
+struct __sorting_network {
+    static constexpr std::size_t size = [] {
+        std::size_t count = 0u;
+        __detail::__merge_exchange(N, [&count] (std::size_t, std::size_t) {
+            ++count;
+        });
+        return count;
+    }();
+
+    // Never empty, so that the array is valid for N < 2.
+    __comparator comparators[size + 1u]{};
+};
+
+template <std::size_t N>
+inline constexpr __sorting_network<N> __network = [] {
+    __sorting_network<N> network;
+    std::size_t k = 0u;
+    __detail::__merge_exchange(N, [&] (std::size_t i, std::size_t j) {
+        network.comparators[k++] = {
+            static_cast<std::uint8_t>(i),
+            static_cast<std::uint8_t>(j)
+        };
+    });
+    return network;
+}();
+
+// Sorts the N elements from first with a fully unrolled sorting network.
+template <std::size_t N, typename I, typename Comp>
+constexpr void __network_sort (I first, Comp& comp) {
+    using difference_type = iterator::iter_difference_t<I>;
+    [&]<std::size_t... Ks> (index_sequence<Ks...>) {
+        (__detail::__compare_exchange(
+            first + static_cast<difference_type>(
+                __network<N>.comparators[Ks].lo
+            ),
+            first + static_cast<difference_type>(
+                __network<N>.comparators[Ks].hi
+            ),
+            comp
+        ), ...);
+    }(make_index_sequence<__sorting_network<N>::size>{});
+}
+
+template <typename I, typename Comp>
+constexpr void __insertion_sort (I first, I last, Comp& comp) {
+    if (first == last) {
+        return;
+    }
+    for (I next = first + 1; next != last; ++next) {
+        iterator::iter_value_t<I> value(iterator::iter_move(next));
+        I hole = next;
+        for (I prev = hole; hole != first and comp(value, *--prev); --hole) {
+            *hole = iterator::iter_move(prev);
+        }
+        *hole = exfs::move(value);
+    }
+}
+
+template <typename I, typename Comp>
+constexpr void __sift_down (
+    I first,
+    iterator::iter_difference_t<I> root,
+    iterator::iter_difference_t<I> size,
+    Comp& comp
+) {
+    for (auto child = 2 * root + 1; child < size; child = 2 * root + 1) {
+        if (child + 1 < size and comp(first[child], first[child + 1])) {
+            ++child;
+        }
+        if (not comp(first[root], first[child])) {
+            return;
+        }
+        iterator::iter_swap(first + root, first + child);
+        root = child;
+    }
+}
+
+template <typename I, typename Comp>
+constexpr void __heap_sort (I first, I last, Comp& comp) {
+    auto const size = last - first;
+    for (auto root = size / 2; root-- > 0;) {
+        __detail::__sift_down(first, root, size, comp);
+    }
+    for (auto end = size - 1; end > 0; --end) {
+        iterator::iter_swap(first, first + end);
+        __detail::__sift_down(first, decltype(end){0}, end, comp);
+    }
+}
+
+// Moves the median of the elements at a, b and c to result.
+template <typename I, typename Comp>
+constexpr void __move_median_to_first (I result, I a, I b, I c, Comp& comp) {
+    if (comp(*a, *b)) {
+        if (comp(*b, *c)) {
+            iterator::iter_swap(result, b);
+        } else if (comp(*a, *c)) {
+            iterator::iter_swap(result, c);
+        } else {
+            iterator::iter_swap(result, a);
+        }
+    } else if (comp(*a, *c)) {
+        iterator::iter_swap(result, a);
+    } else if (comp(*b, *c)) {
+        iterator::iter_swap(result, c);
+    } else {
+        iterator::iter_swap(result, b);
+    }
+}
+
+// Partitions [first + 1, last) around the pivot at first. The median of three
+// selection leaves an element on each side which stops the scans, so they do
+// not check the bounds.
+template <typename I, typename Comp>
+constexpr I __partition_around_first (I first, I last, Comp& comp) {
+    I lo = first + 1;
+    I hi = last;
+    while (true) {
+        while (comp(*lo, *first)) {
+            ++lo;
+        }
+        --hi;
+        while (comp(*first, *hi)) {
+            --hi;
+        }
+        if (not (lo < hi)) {
+            return lo;
+        }
+        iterator::iter_swap(lo, hi);
+        ++lo;
+    }
+}
+
+template <typename I, typename Comp>
+constexpr void __introsort (
+    I first,
+    I last,
+    iterator::iter_difference_t<I> depth_limit,
+    Comp& comp
+) {
+    while (last - first > __insertion_sort_threshold) {
+        if (depth_limit == 0) {
+            __detail::__heap_sort(first, last, comp);
+            return;
+        }
+        --depth_limit;
+        I const middle = first + (last - first) / 2;
+        __detail::__move_median_to_first(
+            first,
+            first + 1,
+            middle,
+            last - 1,
+            comp
+        );
+        I const cut = __partition_around_first(first, last, comp);
+        __detail::__introsort(cut, last, depth_limit, comp);
+        last = cut;
+    }
+    __detail::__insertion_sort(first, last, comp);
+}
+
+template <typename I, typename Comp>
+constexpr void __sort (I first, I last, Comp& comp) {
+    iterator::iter_difference_t<I> depth_limit = 0;
+    for (auto size = last - first; size > 1; size /= 2) {
+        depth_limit += 2;
+    }
+    __detail::__introsort(first, last, depth_limit, comp);
+}
+
+// The number of elements of R if it is a constant, or zero.
+template <typename R>
+inline constexpr std::size_t __static_extent = 0u;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t __static_extent<T[N]> = N;
+
+template <typename R>
+requires requires { std::tuple_size<R>::value; }
+inline constexpr std::size_t __static_extent<R> = std::tuple_size<R>::value;
+}  // namespace __detail
+
+/**
+ * @name Sorting
+ *
+ * Sorts a range in ascending order according to @p comp. The sort is not
+ * stable. All overloads are usable in constant expressions and allocate no
+ * memory.
+ *
+ * Ranges whose size is a compile-time constant of at most 32 are sorted with
+ * a fixed sorting network (Batcher's merge exchange), generated and unrolled
+ * at compile time. Elements which are cheap to copy are compare-exchanged
+ * without branches, so the time taken does not depend on the data. Other
+ * ranges are sorted with an introsort: quicksort with a median of three pivot,
+ * which falls back to heapsort when the recursion gets too deep and to
+ * insertion sort for short partitions, so it runs in O(n log n) in the worst
+ * case.
+ *
+ * @return An iterator to the end of the range.
+ *
+ * @{
+ */
+
+/**
+ * Sorts the range [@p first, @p last) with introsort.
+ */
+template <
+    iterator::random_access_iterator I,
+    iterator::sentinel_for<I> S,
+    typename Comp = exfs::less
+>
+requires __detail::__sortable<I, Comp>
+constexpr I sort (I first, S last, Comp comp = {}) {
+    I const end = ranges::next(first, exfs::move(last));
+    __detail::__sort(exfs::move(first), end, comp);
+    return end;
+}
+
+/**
+ * Sorts the @p N elements starting at @p first, with a sorting network if
+ * @p N is at most 32: `sort<8>(samples)`.
+ */
+template <
+    std::size_t N,
+    iterator::random_access_iterator I,
+    typename Comp = exfs::less
+>
+requires __detail::__sortable<I, Comp>
+constexpr I sort (I first, Comp comp = {}) {
+    auto const end = first + static_cast<iterator::iter_difference_t<I>>(N);
+    if constexpr (N <= __detail::__max_network_size) {
+        __detail::__network_sort<N>(first, comp);
+    } else {
+        __detail::__sort(first, end, comp);
+    }
+    return end;
+}
+
+/**
+ * Sorts the elements of @p r. Built-in arrays and ranges with a constant
+ * @c std::tuple_size, such as @c std::array, are sorted like with
+ * `sort<N>(first)`.
+ */
+template <ranges::random_access_range R, typename Comp = exfs::less>
+requires __detail::__sortable<ranges::iterator_t<R>, Comp>
+constexpr ranges::iterator_t<R> sort (R&& r, Comp comp = {}) {
+    constexpr std::size_t extent =
+        __detail::__static_extent<std::remove_cvref_t<R>>;
+    if constexpr (extent > 0u) {
+        return algorithm::sort<extent>(ranges::begin(r), exfs::move(comp));
+    } else {
+        return algorithm::sort(
+            ranges::begin(r),
+            ranges::end(r),
+            exfs::move(comp)
+        );
+    }
+}
+
+/**
+ * @}
+ */
+}  // namespace exfs::algorithm
+
+#endif  // EXFS_ALGORITHM_SORT_HPP_
@@ -0,0 +1,230 @@
+#include "exfs/algorithm/sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/utility/comparison.hpp"
+
+namespace {
+namespace algorithm = exfs::algorithm;
+
+constexpr int constexpr_network_sort () {
+    int values[] = {5, 1, 4, 2, 3};
+    algorithm::sort(values);
+    return values[0] * 10000 + values[1] * 1000 + values[2] * 100 +
+        values[3] * 10 + values[4];
+}
+static_assert(constexpr_network_sort() == 12345);
+
+constexpr bool constexpr_introsort () {
+    int values[64]{};
+    for (int i = 0; i < 64; ++i) {
+        values[i] = (i * 37) % 64;
+    }
+    algorithm::sort(values + 0, values + 64);
+    for (int i = 0; i < 64; ++i) {
+        if (values[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(constexpr_introsort());
+
+// The sizes of Batcher's merge exchange networks, which match the optimal
+// sizes up to 8 elements.
+static_assert(algorithm::__detail::__sorting_network<1>::size == 0u);
+static_assert(algorithm::__detail::__sorting_network<2>::size == 1u);
+static_assert(algorithm::__detail::__sorting_network<4>::size == 5u);
+static_assert(algorithm::__detail::__sorting_network<8>::size == 19u);
+static_assert(algorithm::__detail::__sorting_network<16>::size == 63u);
+
+static_assert(not std::is_invocable_v<
+    decltype([] (auto& r) -> decltype(algorithm::sort(r)) {}),
+    std::list<int>&
+>);
+
+std::vector<int> random_values (std::size_t size, int max) {
+    std::mt19937 engine{static_cast<std::mt19937::result_type>(size)};
+    std::uniform_int_distribution<int> distribution{0, max};
+    std::vector<int> values(size);
+    for (auto& value : values) {
+        value = distribution(engine);
+    }
+    return values;
+}
+
+// Checks that the network for N elements sorts every sequence of zeros and
+// ones, which by the 0-1 principle proves that it sorts any sequence, then
+// a few random sequences.
+template <std::size_t N>
+void check_network () {
+    if constexpr (N <= 14u) {
+        for (std::uint32_t bits = 0u; bits < (std::uint32_t{1} << N); ++bits) {
+            std::array<int, N> values{};
+            for (std::size_t i = 0u; i < N; ++i) {
+                values[i] = static_cast<int>((bits >> i) & 1u);
+            }
+            algorithm::sort<N>(values.begin());
+            if (not std::is_sorted(values.begin(), values.end())) {
+                FAIL("network of size " << N << " fails on " << bits);
+            }
+        }
+    }
+
+    for (int round = 0; round < 16; ++round) {
+        auto values = random_values(N + static_cast<std::size_t>(round), 99);
+        values.resize(N);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        auto const end = algorithm::sort<N>(values.begin());
+        CHECK(end == values.end());
+        CHECK(values == expected);
+    }
+}
+
+template <std::size_t... Ns>
+void check_networks (std::index_sequence<Ns...>) {
+    (check_network<Ns>(), ...);
+}
+}  // namespace
+
+SCENARIO (
+    "exfs::algorithm::sort - constant sizes",
+    "[unit][algorithm]"
+) {
+    GIVEN ("every size up to the largest sorting network") {
+        THEN ("the networks sort every input") {
+            check_networks(std::make_index_sequence<33u>{});
+        }
+    }
+
+    GIVEN ("a built-in array") {
+        int values[] = {9, 3, 7, 1, 8, 2, 6, 4, 5, 0};
+
+        WHEN ("it is sorted") {
+            auto const end = algorithm::sort(values);
+
+            THEN ("the elements are in order") {
+                CHECK(end == values + 10);
+                CHECK(std::is_sorted(values, values + 10));
+            }
+        }
+    }
+
+    GIVEN ("a std::array larger than the largest network") {
+        std::array<int, 40> values{};
+        auto const source = random_values(40u, 1000);
+        std::copy(source.begin(), source.end(), values.begin());
+
+        WHEN ("it is sorted") {
+            algorithm::sort(values);
+
+            THEN ("the elements are in order") {
+                CHECK(std::is_sorted(values.begin(), values.end()));
+            }
+        }
+    }
+
+    GIVEN ("an array of strings") {
+        std::string values[] = {"pear", "apple", "fig", "kiwi", "date"};
+
+        WHEN ("it is sorted in descending order") {
+            algorithm::sort(values, exfs::greater{});
+
+            THEN ("the elements are in reverse order") {
+                CHECK(values[0] == "pear");
+                CHECK(values[1] == "kiwi");
+                CHECK(values[2] == "fig");
+                CHECK(values[3] == "date");
+                CHECK(values[4] == "apple");
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::algorithm::sort - variable sizes",
+    "[unit][std-parity][algorithm]"
+) {
+    GIVEN ("random ranges of many sizes") {
+        THEN ("they are sorted like with std::sort") {
+            for (std::size_t size : {0u, 1u, 2u, 15u, 16u, 17u, 100u, 1000u}) {
+                for (int max : {1, 10, 100000}) {
+                    auto values = random_values(size, max);
+                    auto expected = values;
+                    std::sort(expected.begin(), expected.end());
+                    auto const end = algorithm::sort(values);
+                    CHECK(end == values.end());
+                    CHECK(values == expected);
+                }
+            }
+        }
+    }
+
+    GIVEN ("ranges which are already ordered") {
+        std::vector<int> ascending(500);
+        for (std::size_t i = 0u; i < ascending.size(); ++i) {
+            ascending[i] = static_cast<int>(i);
+        }
+        std::vector<int> descending(ascending.rbegin(), ascending.rend());
+        std::vector<int> organ_pipe(ascending.begin(), ascending.begin() + 250);
+        organ_pipe.insert(organ_pipe.end(), descending.begin() + 250,
+            descending.end());
+
+        THEN ("they are sorted") {
+            for (auto* values : {&ascending, &descending, &organ_pipe}) {
+                algorithm::sort(values->begin(), values->end());
+                CHECK(std::is_sorted(values->begin(), values->end()));
+            }
+        }
+    }
+
+    GIVEN ("a range sorted by a key") {
+        std::vector<std::pair<int, std::string>> values;
+        for (int i = 0; i < 100; ++i) {
+            values.emplace_back((i * 7) % 100, std::to_string(i));
+        }
+
+        WHEN ("it is sorted with a custom comparison") {
+            algorithm::sort(values, [] (auto const& a, auto const& b) {
+                return a.first > b.first;
+            });
+
+            THEN ("the elements are in order of their keys") {
+                for (std::size_t i = 0u; i < values.size(); ++i) {
+                    CHECK(values[i].first == 99 - static_cast<int>(i));
+                }
+            }
+        }
+    }
+
+    GIVEN ("a range to sort with heapsort") {
+        auto values = random_values(300u, 1000);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        WHEN ("the introsort depth limit is exhausted") {
+            exfs::less comp{};
+            algorithm::__detail::__introsort(
+                values.begin(),
+                values.end(),
+                std::ptrdiff_t{0},
+                comp
+            );
+
+            THEN ("the range is sorted") {
+                CHECK(values == expected);
+            }
+        }
+    }
+}
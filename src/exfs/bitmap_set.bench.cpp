@@ -0,0 +1,186 @@
+#include "exfs/bitmap_set.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/static_vector.hpp"
+
+namespace {
+constexpr std::size_t query_count = 256u;
+
+// Each fixture holds roughly a third of the universe and a pseudo-random
+// sequence of keys to look up.
+template <std::size_t Universe>
+struct Keys {
+    std::size_t members[Universe];
+    std::size_t member_count = 0u;
+    std::size_t queries[query_count];
+
+    Keys () {
+        std::uint32_t seed = 12345u;
+        for (std::size_t key = 0u; key < Universe; ++key) {
+            seed = seed * 1664525u + 1013904223u;
+            if ((seed >> 16u) % 3u == 0u) {
+                members[member_count++] = key;
+            }
+        }
+        for (auto& query : queries) {
+            seed = seed * 1664525u + 1013904223u;
+            query = (seed >> 8u) % Universe;
+        }
+    }
+};
+
+template <std::size_t Universe>
+void contains_bitmap_set (benchmark::State& state) {
+    static Keys<Universe> const keys{};
+    exfs::bitmap_set<Universe> set{};
+    for (std::size_t idx = 0u; idx < keys.member_count; ++idx) {
+        set.insert(keys.members[idx]);
+    }
+
+    for (auto _ : state) {
+        std::size_t found = 0u;
+        for (auto query : keys.queries) {
+            benchmark::DoNotOptimize(set);
+            found += set.contains(query);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * query_count);
+}
+BENCHMARK(contains_bitmap_set<32u>);
+BENCHMARK(contains_bitmap_set<256u>);
+
+template <std::size_t Universe>
+void contains_static_vector (benchmark::State& state) {
+    static Keys<Universe> const keys{};
+    exfs::static_vector<std::size_t, Universe> vec{};
+    for (std::size_t idx = 0u; idx < keys.member_count; ++idx) {
+        vec.push_back(keys.members[idx]);
+    }
+
+    for (auto _ : state) {
+        std::size_t found = 0u;
+        for (auto query : keys.queries) {
+            benchmark::DoNotOptimize(vec);
+            for (std::size_t idx = 0u; idx < vec.size(); ++idx) {
+                if (vec[idx] == query) {
+                    ++found;
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * query_count);
+}
+BENCHMARK(contains_static_vector<32u>);
+BENCHMARK(contains_static_vector<256u>);
+
+template <std::size_t Universe>
+void contains_std_set (benchmark::State& state) {
+    static Keys<Universe> const keys{};
+    std::set<std::size_t> set(keys.members, keys.members + keys.member_count);
+
+    for (auto _ : state) {
+        std::size_t found = 0u;
+        for (auto query : keys.queries) {
+            found += set.contains(query);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * query_count);
+}
+BENCHMARK(contains_std_set<32u>);
+BENCHMARK(contains_std_set<256u>);
+
+// Inserting and then erasing every queried key.
+template <std::size_t Universe>
+void insert_erase_bitmap_set (benchmark::State& state) {
+    static Keys<Universe> const keys{};
+    exfs::bitmap_set<Universe> set{};
+
+    for (auto _ : state) {
+        for (auto query : keys.queries) {
+            set.insert(query);
+        }
+        benchmark::DoNotOptimize(set);
+        for (auto query : keys.queries) {
+            set.erase(query);
+        }
+        benchmark::DoNotOptimize(set);
+    }
+
+    state.SetItemsProcessed(state.iterations() * query_count);
+}
+BENCHMARK(insert_erase_bitmap_set<256u>);
+
+template <std::size_t Universe>
+void insert_erase_std_set (benchmark::State& state) {
+    static Keys<Universe> const keys{};
+    std::set<std::size_t> set{};
+
+    for (auto _ : state) {
+        for (auto query : keys.queries) {
+            set.insert(query);
+        }
+        benchmark::DoNotOptimize(set);
+        for (auto query : keys.queries) {
+            set.erase(query);
+        }
+        benchmark::DoNotOptimize(set);
+    }
+
+    state.SetItemsProcessed(state.iterations() * query_count);
+}
+BENCHMARK(insert_erase_std_set<256u>);
+
+// Iterating over every member and intersecting two sets.
+template <std::size_t Universe>
+void iterate_intersection_bitmap_set (benchmark::State& state) {
+    static Keys<Universe> const keys{};
+    exfs::bitmap_set<Universe> a{};
+    exfs::bitmap_set<Universe> b{};
+    for (std::size_t idx = 0u; idx < keys.member_count; ++idx) {
+        a.insert(keys.members[idx]);
+    }
+    for (auto query : keys.queries) {
+        b.insert(query);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        std::size_t sum = 0u;
+        for (auto key : a & b) {
+            sum += key;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(iterate_intersection_bitmap_set<256u>);
+
+template <std::size_t Universe>
+void iterate_intersection_std_set (benchmark::State& state) {
+    static Keys<Universe> const keys{};
+    std::set<std::size_t> a(keys.members, keys.members + keys.member_count);
+    std::set<std::size_t> b(keys.queries, keys.queries + query_count);
+
+    for (auto _ : state) {
+        std::size_t sum = 0u;
+        for (auto key : a) {
+            if (b.contains(key)) {
+                sum += key;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(iterate_intersection_std_set<256u>);
+}  // namespace
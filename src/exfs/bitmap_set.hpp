@@ -0,0 +1,453 @@
+#ifndef EXFS_BITMAP_SET_HPP_
+#define EXFS_BITMAP_SET_HPP_
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#include "arche/Bitset.hpp"
+#include "exfs/iterator/category_tags.hpp"
+
+namespace exfs {
+namespace __detail {
+template <std::size_t universe>
+using __bitmap_word_t = std::conditional_t<
+    (universe <= 8u),
+    std::uint8_t,
+    std::conditional_t<
+        (universe <= 16u),
+        std::uint16_t,
+        std::conditional_t<(universe <= 32u), std::uint32_t, std::uint64_t>
+    >
+>;
+
+template <typename Key>
+concept __bitmap_key = std::integral<Key> or std::is_enum_v<Key>;
+}  // namespace __detail
+
+/**
+ * Associative container holding a set of unique keys from the small universe
+ * [0, @p Universe), such as channel numbers, pin IDs or interrupt numbers.
+ *
+ * Membership is stored as one bit per possible key in an array of @c
+ * arche::Bitset words. A universe of up to 64 keys fits in a single word of
+ * the smallest sufficient unsigned type; larger universes use as many 64-bit
+ * words as needed. Insertion, removal and lookup are a single bit operation,
+ * and the set algebra operators process a whole word at a time.
+ *
+ * Iteration visits the members in increasing order. Each step finds the next
+ * member with a count-trailing-zeros instruction rather than testing every
+ * bit, so it is proportional to the number of members plus the number of
+ * words.
+ *
+ * @tparam Universe The number of possible keys.
+ * @tparam Key The type of the keys. Integral and enumeration types are
+ *     supported; keys are converted to indices with @c static_cast.
+ */
+template <std::size_t Universe, __detail::__bitmap_key Key = std::size_t>
+requires (Universe > 0u)
+class bitmap_set {
+    using word_type_ = __detail::__bitmap_word_t<Universe>;
+
+    static constexpr std::size_t word_bits_ = sizeof(word_type_) * 8u;
+    static constexpr std::size_t word_count_ =
+        (Universe + word_bits_ - 1u) / word_bits_;
+
+    // A single word only uses the bits of the universe. With several words,
+    // only the unused bits of the last word need masking, which the
+    // complement does explicitly.
+    using word_ = arche::Bitset<
+        word_count_ == 1u ? Universe : word_bits_,
+        word_type_
+    >;
+
+    static constexpr word_ last_word_mask_ = [] {
+        if constexpr (Universe % word_bits_ == 0u) {
+            return ~word_{};
+        } else {
+            return word_{static_cast<word_type_>(
+                (word_type_{1} << (Universe % word_bits_)) - 1u
+            )};
+        }
+    }();
+
+  public:
+    using key_type   = Key;
+    using value_type = Key;
+    using size_type  = std::size_t;
+
+    /**
+     * The number of possible keys.
+     */
+    static constexpr size_type universe = Universe;
+
+    /**
+     * Iterator over the members of the set in increasing order.
+     *
+     * Dereferencing yields the key by value, so this is an input iterator in
+     * the legacy taxonomy but models @c forward_iterator.
+     */
+    class const_iterator {
+      public:
+        using iterator_concept  = exfs::iterator::forward_iterator_tag;
+        using iterator_category = exfs::iterator::input_iterator_tag;
+        using value_type        = Key;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = Key;
+
+        constexpr const_iterator () noexcept = default;
+
+        constexpr reference operator * () const noexcept {
+            return static_cast<Key>(
+                word_index_ * word_bits_ +
+                static_cast<size_type>(std::countr_zero(remaining_))
+            );
+        }
+
+        constexpr const_iterator& operator ++ () noexcept {
+            // Clear the lowest set bit, then skip over empty words.
+            remaining_ &= static_cast<word_type_>(remaining_ - 1u);
+            skip_empty_words_();
+            return *this;
+        }
+
+        constexpr const_iterator operator ++ (int) noexcept {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend constexpr bool
+        operator == (const_iterator const&, const_iterator const&) = default;
+
+      private:
+        friend class bitmap_set;
+
+        constexpr const_iterator (
+            bitmap_set const* set,
+            size_type word_index
+        ) noexcept
+              : set_{set},
+                word_index_{word_index},
+                remaining_{
+                    word_index < word_count_
+                        ? set->words_[word_index].value()
+                        : word_type_{0u}
+                } {
+            skip_empty_words_();
+        }
+
+        constexpr void skip_empty_words_ () noexcept {
+            while (remaining_ == 0u and word_index_ < word_count_) {
+                ++word_index_;
+                if (word_index_ < word_count_) {
+                    remaining_ = set_->words_[word_index_].value();
+                }
+            }
+        }
+
+        bitmap_set const* set_ = nullptr;
+        size_type word_index_ = word_count_;
+        word_type_ remaining_ = 0u;
+    };
+
+    using iterator = const_iterator;
+
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Default constructor. Constructs an empty set.
+     */
+    constexpr bitmap_set () noexcept = default;
+
+    /**
+     * Constructs the set with the keys in @p init.
+     *
+     * @warning It is undefined behavior if any key is outside the universe.
+     */
+    constexpr bitmap_set (std::initializer_list<Key> init) noexcept {
+        for (Key const key : init) {
+            insert(key);
+        }
+    }
+
+    /**
+     * Constructs the set holding every key of the universe.
+     */
+    static constexpr bitmap_set all () noexcept {
+        return bitmap_set{}.complement();
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Iterators
+     * @{
+     */
+
+    constexpr const_iterator begin () const noexcept {
+        return const_iterator{this, 0u};
+    }
+
+    constexpr const_iterator cbegin () const noexcept {
+        return begin();
+    }
+
+    constexpr const_iterator end () const noexcept {
+        return const_iterator{this, word_count_};
+    }
+
+    constexpr const_iterator cend () const noexcept {
+        return end();
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Size/Capacity
+     * @{
+     */
+
+    /**
+     * Checks if the set has no members.
+     */
+    [[nodiscard]] constexpr bool empty () const noexcept {
+        for (auto const word : words_) {
+            if (not word.none()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Returns the number of members, counted with a population count of
+     * every word.
+     */
+    [[nodiscard]] constexpr size_type size () const noexcept {
+        size_type result = 0u;
+        for (auto const word : words_) {
+            result += static_cast<size_type>(word.count());
+        }
+        return result;
+    }
+
+    /**
+     * Returns the maximum number of members, which is @p Universe.
+     */
+    static constexpr size_type max_size () noexcept { return Universe; }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Modifiers
+     * @{
+     */
+
+    /**
+     * Adds @p key to the set.
+     *
+     * @warning It is undefined behavior if @p key is outside the universe.
+     *
+     * @return @c true if @p key was not already a member, else @c false.
+     */
+    constexpr bool insert (Key key) noexcept {
+        auto const [word, bit] = locate_(key);
+        bool const inserted = not words_[word].test(bit);
+        words_[word] = words_[word] | word_::bit(bit);
+        return inserted;
+    }
+
+    /**
+     * Removes @p key from the set.
+     *
+     * @warning It is undefined behavior if @p key is outside the universe.
+     *
+     * @return The number of members removed (0 or 1).
+     */
+    constexpr size_type erase (Key key) noexcept {
+        auto const [word, bit] = locate_(key);
+        bool const erased = words_[word].test(bit);
+        words_[word] = words_[word] & ~word_::bit(bit);
+        return erased ? 1u : 0u;
+    }
+
+    /**
+     * Removes all members.
+     */
+    constexpr void clear () noexcept {
+        for (auto& word : words_) {
+            word = word_{};
+        }
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Lookup
+     * @{
+     */
+
+    /**
+     * Checks if @p key is a member of the set.
+     *
+     * @warning It is undefined behavior if @p key is outside the universe.
+     */
+    constexpr bool contains (Key key) const noexcept {
+        auto const [word, bit] = locate_(key);
+        return words_[word].test(bit);
+    }
+
+    /**
+     * Returns the number of members equal to @p key (0 or 1).
+     */
+    constexpr size_type count (Key key) const noexcept {
+        return contains(key) ? 1u : 0u;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Set Algebra
+     *
+     * Each operation processes one word of the bitmap at a time.
+     *
+     * @{
+     */
+
+    constexpr bitmap_set& operator |= (bitmap_set const& other) noexcept {
+        for (size_type idx = 0u; idx < word_count_; ++idx) {
+            words_[idx] = words_[idx] | other.words_[idx];
+        }
+        return *this;
+    }
+
+    constexpr bitmap_set& operator &= (bitmap_set const& other) noexcept {
+        for (size_type idx = 0u; idx < word_count_; ++idx) {
+            words_[idx] = words_[idx] & other.words_[idx];
+        }
+        return *this;
+    }
+
+    constexpr bitmap_set& operator -= (bitmap_set const& other) noexcept {
+        for (size_type idx = 0u; idx < word_count_; ++idx) {
+            words_[idx] = words_[idx] & ~other.words_[idx];
+        }
+        return *this;
+    }
+
+    constexpr bitmap_set& operator ^= (bitmap_set const& other) noexcept {
+        for (size_type idx = 0u; idx < word_count_; ++idx) {
+            words_[idx] = words_[idx] ^ other.words_[idx];
+        }
+        return *this;
+    }
+
+    /**
+     * Union: the keys in either set.
+     */
+    friend constexpr bitmap_set
+    operator | (bitmap_set lhs, bitmap_set const& rhs) noexcept {
+        return lhs |= rhs;
+    }
+
+    /**
+     * Intersection: the keys in both sets.
+     */
+    friend constexpr bitmap_set
+    operator & (bitmap_set lhs, bitmap_set const& rhs) noexcept {
+        return lhs &= rhs;
+    }
+
+    /**
+     * Difference: the keys in @p lhs but not in @p rhs.
+     */
+    friend constexpr bitmap_set
+    operator - (bitmap_set lhs, bitmap_set const& rhs) noexcept {
+        return lhs -= rhs;
+    }
+
+    /**
+     * Symmetric difference: the keys in exactly one of the sets.
+     */
+    friend constexpr bitmap_set
+    operator ^ (bitmap_set lhs, bitmap_set const& rhs) noexcept {
+        return lhs ^= rhs;
+    }
+
+    /**
+     * Returns the keys of the universe which are not members of this set.
+     */
+    constexpr bitmap_set complement () const noexcept {
+        bitmap_set result{};
+        for (size_type idx = 0u; idx < word_count_; ++idx) {
+            result.words_[idx] = ~words_[idx];
+        }
+        result.words_[word_count_ - 1u] =
+            result.words_[word_count_ - 1u] & last_word_mask_;
+        return result;
+    }
+
+    /**
+     * Checks if every member of this set is also a member of @p other.
+     */
+    constexpr bool is_subset_of (bitmap_set const& other) const noexcept {
+        for (size_type idx = 0u; idx < word_count_; ++idx) {
+            if (not (words_[idx] & ~other.words_[idx]).none()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Checks if this set and @p other have any members in common.
+     */
+    constexpr bool intersects (bitmap_set const& other) const noexcept {
+        for (size_type idx = 0u; idx < word_count_; ++idx) {
+            if (not (words_[idx] & other.words_[idx]).none()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    friend constexpr bool
+    operator == (bitmap_set const&, bitmap_set const&) = default;
+
+    /**
+     * @}
+     */
+
+  private:
+    struct location_ {
+        size_type word;
+        unsigned bit;
+    };
+
+    static constexpr location_ locate_ (Key key) noexcept {
+        auto const index = static_cast<size_type>(key);
+        return {index / word_bits_, static_cast<unsigned>(index % word_bits_)};
+    }
+
+    word_ words_[word_count_] = {};
+};
+}  // namespace exfs
+
+#endif  // EXFS_BITMAP_SET_HPP_
@@ -0,0 +1,187 @@
+#include "exfs/bitmap_set.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/concepts.hpp"
+
+namespace {
+enum class Irq : std::uint8_t {
+    systick = 0u,
+    uart0 = 5u,
+    uart1 = 6u,
+    dma = 11u,
+    usb = 15u,
+};
+
+template <typename Set>
+std::vector<std::size_t> members (Set const& set) {
+    std::vector<std::size_t> result;
+    for (auto key : set) {
+        result.push_back(static_cast<std::size_t>(key));
+    }
+    return result;
+}
+}  // namespace
+
+TEST_CASE (
+    "exfs::bitmap_set - size and iterator properties",
+    "[unit][bitmap_set]"
+) {
+    // One bit per key of the universe, in the smallest words which fit.
+    CHECK(sizeof(exfs::bitmap_set<5u>) == 1u);
+    CHECK(sizeof(exfs::bitmap_set<16u, Irq>) == 2u);
+    CHECK(sizeof(exfs::bitmap_set<32u>) == 4u);
+    CHECK(sizeof(exfs::bitmap_set<64u>) == 8u);
+    CHECK(sizeof(exfs::bitmap_set<65u>) == 16u);
+    CHECK(sizeof(exfs::bitmap_set<240u>) == 32u);
+    CHECK(std::is_trivially_copyable_v<exfs::bitmap_set<240u>>);
+
+    using Iterator = exfs::bitmap_set<100u>::const_iterator;
+    CHECK(exfs::iterator::forward_iterator<Iterator>);
+    CHECK(std::forward_iterator<Iterator>);
+    CHECK(std::is_same_v<std::iter_value_t<Iterator>, std::size_t>);
+
+    CHECK(exfs::bitmap_set<100u>::universe == 100u);
+    CHECK(exfs::bitmap_set<100u>::max_size() == 100u);
+}
+
+TEMPLATE_TEST_CASE_SIG (
+    "exfs::bitmap_set - basic usage matches std::set",
+    "[unit][std-parity][bitmap_set]",
+    ((std::size_t Universe), Universe),
+    7u, 32u, 64u, 65u, 200u
+) {
+    exfs::bitmap_set<Universe> set{};
+    std::set<std::size_t> reference{};
+
+    THEN ("a new set is empty") {
+        CHECK(set.empty());
+        CHECK(set.size() == 0u);
+        CHECK(set.begin() == set.end());
+    }
+
+    WHEN ("keys spread over the universe are inserted") {
+        for (std::size_t key = 0u; key < Universe; key += 3u) {
+            CHECK(set.insert(key) == reference.insert(key).second);
+        }
+        for (std::size_t key : {Universe - 1u, std::size_t{0u}}) {
+            CHECK(set.insert(key) == reference.insert(key).second);
+        }
+
+        THEN ("the set holds the same keys as std::set") {
+            CHECK(set.size() == reference.size());
+            CHECK(not set.empty());
+            CHECK(members(set) == std::vector<std::size_t>(
+                reference.begin(),
+                reference.end()
+            ));
+            for (std::size_t key = 0u; key < Universe; ++key) {
+                CHECK(set.contains(key) == reference.contains(key));
+                CHECK(set.count(key) == reference.count(key));
+            }
+        }
+
+        AND_WHEN ("keys are erased") {
+            for (std::size_t key = 0u; key < Universe; key += 2u) {
+                CHECK(set.erase(key) == reference.erase(key));
+            }
+
+            THEN ("the set holds the same keys as std::set") {
+                CHECK(set.size() == reference.size());
+                CHECK(members(set) == std::vector<std::size_t>(
+                    reference.begin(),
+                    reference.end()
+                ));
+            }
+        }
+
+        AND_WHEN ("the set is cleared") {
+            set.clear();
+
+            THEN ("it is empty") {
+                CHECK(set.empty());
+                CHECK(set.begin() == set.end());
+            }
+        }
+    }
+
+    WHEN ("every key is inserted") {
+        auto const all = exfs::bitmap_set<Universe>::all();
+
+        THEN ("the set holds the entire universe") {
+            CHECK(all.size() == Universe);
+            CHECK(all.contains(Universe - 1u));
+            CHECK(all.complement().empty());
+            CHECK(std::distance(all.begin(), all.end()) ==
+                static_cast<std::ptrdiff_t>(Universe));
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::bitmap_set - set algebra",
+    "[unit][bitmap_set]"
+) {
+    GIVEN ("two sets spanning several words") {
+        exfs::bitmap_set<130u> const a{1u, 5u, 64u, 100u, 129u};
+        exfs::bitmap_set<130u> const b{5u, 63u, 64u, 128u};
+
+        THEN ("union, intersection, difference and symmetric difference") {
+            CHECK(members(a | b) == std::vector<std::size_t>{
+                1u, 5u, 63u, 64u, 100u, 128u, 129u
+            });
+            CHECK(members(a & b) == std::vector<std::size_t>{5u, 64u});
+            CHECK(members(a - b) == std::vector<std::size_t>{1u, 100u, 129u});
+            CHECK(members(a ^ b) == std::vector<std::size_t>{
+                1u, 63u, 100u, 128u, 129u
+            });
+        }
+
+        THEN ("the complement stays within the universe") {
+            auto const complement = a.complement();
+            CHECK(complement.size() == 130u - a.size());
+            CHECK(not complement.contains(129u));
+            CHECK(complement.contains(127u));
+            CHECK((complement | a) == exfs::bitmap_set<130u>::all());
+        }
+
+        THEN ("subset and intersection predicates") {
+            CHECK((a & b).is_subset_of(a));
+            CHECK(not a.is_subset_of(b));
+            CHECK(a.intersects(b));
+            CHECK(not (a - b).intersects(b));
+        }
+    }
+
+    GIVEN ("sets of enumerators") {
+        exfs::bitmap_set<16u, Irq> enabled{Irq::uart0, Irq::dma, Irq::usb};
+        exfs::bitmap_set<16u, Irq> const pending{Irq::dma, Irq::systick};
+
+        WHEN ("combining them") {
+            auto const to_service = enabled & pending;
+
+            THEN ("the keys are enumerators") {
+                std::vector<Irq> result(to_service.begin(), to_service.end());
+                CHECK(result == std::vector<Irq>{Irq::dma});
+            }
+        }
+
+        WHEN ("a compound assignment is used") {
+            enabled -= pending;
+
+            THEN ("the set is updated in place") {
+                CHECK(enabled == exfs::bitmap_set<16u, Irq>{
+                    Irq::uart0,
+                    Irq::usb
+                });
+            }
+        }
+    }
+}
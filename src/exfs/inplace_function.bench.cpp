@@ -0,0 +1,91 @@
+#include "exfs/inplace_function.hpp"
+
+#include <cstddef>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+// Callbacks are called through an array so the compiler cannot see which
+// target is stored and devirtualize the call.
+constexpr std::size_t callback_count = 16u;
+
+int add_offset (int value) { return value + 3; }
+
+template <typename Callback>
+void fill_capturing (Callback (&callbacks)[callback_count], int* state) {
+    for (std::size_t idx = 0u; idx < callback_count; ++idx) {
+        callbacks[idx] = [state, idx] (int value) {
+            return value + *state + static_cast<int>(idx);
+        };
+    }
+}
+
+template <typename Callback>
+void invoke_all (
+    benchmark::State& state,
+    Callback (&callbacks)[callback_count]
+) {
+    int accumulator = 0;
+    for (auto _ : state) {
+        for (auto const& callback : callbacks) {
+            benchmark::DoNotOptimize(callbacks);
+            accumulator = callback(accumulator);
+        }
+    }
+    benchmark::DoNotOptimize(accumulator);
+
+    state.SetItemsProcessed(state.iterations() * callback_count);
+}
+
+void call_function_pointer (benchmark::State& state) {
+    int (*callbacks[callback_count])(int);
+    for (auto& callback : callbacks) {
+        callback = &add_offset;
+    }
+    invoke_all(state, callbacks);
+}
+BENCHMARK(call_function_pointer);
+
+void call_std_function (benchmark::State& state) {
+    std::function<int(int)> callbacks[callback_count];
+    int offset = 3;
+    fill_capturing(callbacks, &offset);
+    invoke_all(state, callbacks);
+}
+BENCHMARK(call_std_function);
+
+void call_inplace_function (benchmark::State& state) {
+    exfs::inplace_function<int(int)> callbacks[callback_count];
+    int offset = 3;
+    fill_capturing(callbacks, &offset);
+    invoke_all(state, callbacks);
+}
+BENCHMARK(call_inplace_function);
+
+void copy_std_function (benchmark::State& state) {
+    int offset = 3;
+    int const big[8] = {};
+    std::function<int(int)> const src = [&offset, big] (int value) {
+        return value + offset + big[0];
+    };
+    for (auto _ : state) {
+        std::function<int(int)> copy{src};
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(copy_std_function);
+
+void copy_inplace_function (benchmark::State& state) {
+    int offset = 3;
+    int const big[8] = {};
+    exfs::inplace_function<int(int), 48u> const src = [&offset, big] (int v) {
+        return v + offset + big[0];
+    };
+    for (auto _ : state) {
+        exfs::inplace_function<int(int), 48u> copy{src};
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(copy_inplace_function);
+}  // namespace
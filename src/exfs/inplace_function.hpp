@@ -0,0 +1,357 @@
+#ifndef EXFS_INPLACE_FUNCTION_HPP_
+#define EXFS_INPLACE_FUNCTION_HPP_
+
+#include <cstddef>
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/memory/storage.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs {
+namespace __detail {
+template <typename F, typename R, typename... Args>
+concept __callable_r = requires (F& f, Args&&... args) {
+    { f(exfs::forward<Args>(args)...) } -> std::convertible_to<R>;
+} or (
+    std::is_void_v<R> and
+    requires (F& f, Args&&... args) { f(exfs::forward<Args>(args)...); }
+);
+
+template <typename T>
+inline constexpr bool __is_inplace_function = false;
+}  // namespace __detail
+
+/**
+ * General purpose polymorphic function wrapper which never allocates.
+ *
+ * Like @c std::function, an @c inplace_function can store, copy, and invoke
+ * any copy constructible callable target whose call signature is compatible
+ * with @p Signature. Unlike @c std::function, the target is always stored in
+ * a fixed-size buffer inside the wrapper. A callable which does not fit in
+ * the buffer is rejected at compile time.
+ *
+ * Callables which are trivially copyable and trivially destructible (such as
+ * function pointers and lambdas capturing only pointers and integers) are
+ * managed with a single invoke pointer and copied bitwise. Other callables
+ * additionally use a small table of lifetime management functions.
+ *
+ * Stored callables must be nothrow move constructible, so @c inplace_function
+ * is always nothrow movable. Moving from an @c inplace_function leaves it
+ * empty.
+ *
+ * @tparam Signature The call signature, `R(Args...)`.
+ * @tparam Capacity The size in bytes of the buffer for the callable.
+ * @tparam Alignment The alignment of the buffer for the callable.
+ */
+template <
+    typename Signature,
+    std::size_t Capacity = 4u * sizeof(void*),
+    std::size_t Alignment = alignof(std::max_align_t)
+>
+class inplace_function;
+
+template <
+    typename R,
+    typename... Args,
+    std::size_t Capacity,
+    std::size_t Alignment
+>
+class inplace_function<R(Args...), Capacity, Alignment> {
+    using invoke_fn_ = R (*)(void*, Args&&...);
+
+    struct vtable_ {
+        void (*copy)(void* dst, void const* src);
+        void (*relocate)(void* dst, void* src) noexcept;
+        void (*destroy)(void* obj) noexcept;
+    };
+
+    template <typename F>
+    static constexpr bool fits_ =
+        sizeof(F) <= Capacity and
+        Alignment % alignof(F) == 0u and
+        std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    static constexpr bool is_trivial_ =
+        std::is_trivially_copyable_v<F> and
+        std::is_trivially_destructible_v<F>;
+
+  public:
+    using result_type = R;
+
+    /**
+     * The size in bytes of the buffer available for the callable.
+     */
+    static constexpr std::size_t capacity = Capacity;
+
+    /**
+     * The alignment of the buffer available for the callable.
+     */
+    static constexpr std::size_t alignment = Alignment;
+
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Creates an empty function.
+     */
+    constexpr inplace_function () noexcept = default;
+
+    /**
+     * @overload inplace_function()
+     */
+    constexpr inplace_function (std::nullptr_t) noexcept {}
+
+    /**
+     * Stores a copy of the callable @p f.
+     *
+     * This constructor only participates in overload resolution if @p F is
+     * invocable with @p Args... returning something convertible to @p R, is
+     * copy constructible and nothrow move constructible, and fits in the
+     * buffer with the required alignment.
+     *
+     * If @p f is a null function pointer, the function is empty.
+     *
+     * @param[in] f The callable to store.
+     */
+    template <typename F, typename D = std::decay_t<F>>
+    requires (
+        not std::same_as<D, inplace_function> and
+        not __detail::__is_inplace_function<D> and
+        __detail::__callable_r<D, R, Args...> and
+        std::copy_constructible<D> and
+        fits_<D>
+    )
+    inplace_function (F&& f) noexcept(std::is_nothrow_constructible_v<D, F>) {
+        if constexpr (std::is_pointer_v<D>) {
+            if (f == nullptr) {
+                return;
+            }
+        }
+
+        emplace_<D>(exfs::forward<F>(f));
+    }
+
+    /**
+     * Copies the target of @p other, if any.
+     *
+     * @param[in] other The function to copy from.
+     */
+    inplace_function (inplace_function const& other) {
+        copy_from_(other);
+    }
+
+    /**
+     * Moves the target of @p other, if any. After the move, @p other is empty.
+     *
+     * @param[in] other The function to move from.
+     */
+    inplace_function (inplace_function&& other) noexcept {
+        move_from_(other);
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Destroys the stored target, if any.
+     */
+    ~inplace_function () {
+        reset_();
+    }
+
+    /**
+     * @name Assignment
+     * @{
+     */
+
+    /**
+     * Replaces the target with a copy of the target of @p other.
+     *
+     * If copying the target throws, this function is left empty.
+     *
+     * @param[in] other The function to copy from.
+     * @return A reference to this function.
+     */
+    inplace_function& operator = (inplace_function const& other) {
+        if (this != &other) {
+            reset_();
+            copy_from_(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Replaces the target with the target of @p other. After the move, @p
+     * other is empty.
+     *
+     * @param[in] other The function to move from.
+     * @return A reference to this function.
+     */
+    inplace_function& operator = (inplace_function&& other) noexcept {
+        if (this != &other) {
+            reset_();
+            move_from_(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Destroys the target, leaving this function empty.
+     * @return A reference to this function.
+     */
+    inplace_function& operator = (std::nullptr_t) noexcept {
+        reset_();
+        return *this;
+    }
+
+    /**
+     * Replaces the target with @p f.
+     *
+     * @param[in] f The callable to store.
+     * @return A reference to this function.
+     */
+    template <typename F>
+    requires (std::constructible_from<inplace_function, F> and
+        not std::same_as<std::remove_cvref_t<F>, inplace_function>)
+    inplace_function& operator = (F&& f) {
+        return *this = inplace_function{exfs::forward<F>(f)};
+    }
+
+    /**
+     * Exchanges the targets of @c *this and @p other.
+     */
+    void swap (inplace_function& other) noexcept {
+        inplace_function tmp{exfs::move(other)};
+        other = exfs::move(*this);
+        *this = exfs::move(tmp);
+    }
+
+    /**
+     * @overload swap()
+     */
+    friend void swap (inplace_function& a, inplace_function& b) noexcept {
+        a.swap(b);
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Checks whether this function stores a callable target.
+     * @return @c true if a target is stored, else @c false.
+     */
+    explicit operator bool () const noexcept {
+        return invoke_ != nullptr;
+    }
+
+    /**
+     * Compares the function with @c nullptr. The compiler also generates the
+     * reversed and negated comparisons.
+     * @return @c true if @p f is empty, else @c false.
+     */
+    friend bool operator == (inplace_function const& f, std::nullptr_t)
+    noexcept {
+        return not f;
+    }
+
+    /**
+     * Invokes the stored target with @p args....
+     *
+     * @warning It is undefined behavior to invoke an empty function.
+     *
+     * @param[in] args... Arguments to forward to the target.
+     * @return The result of the target, converted to @p R.
+     */
+    R operator () (Args... args) const {
+        return invoke_(buffer_, exfs::forward<Args>(args)...);
+    }
+
+  private:
+    template <typename F>
+    static constexpr vtable_ vtable_for_ {
+        [] (void* dst, void const* src) {
+            static_cast<memory::storage<F>*>(dst)->construct(
+                static_cast<memory::storage<F> const*>(src)->object()
+            );
+        },
+        [] (void* dst, void* src) noexcept {
+            auto* const from = static_cast<memory::storage<F>*>(src);
+            static_cast<memory::storage<F>*>(dst)->construct(
+                exfs::move(*from).object()
+            );
+            from->destroy();
+        },
+        [] (void* obj) noexcept {
+            static_cast<memory::storage<F>*>(obj)->destroy();
+        },
+    };
+
+    template <typename F>
+    static R invoke_target_ (void* obj, Args&&... args) {
+        auto& target = static_cast<memory::storage<F>*>(obj)->object();
+        if constexpr (std::is_void_v<R>) {
+            target(exfs::forward<Args>(args)...);
+        } else {
+            return target(exfs::forward<Args>(args)...);
+        }
+    }
+
+    template <typename F, typename... Init>
+    void emplace_ (Init&&... init) {
+        static_cast<memory::storage<F>*>(static_cast<void*>(buffer_))
+            ->construct(exfs::forward<Init>(init)...);
+        invoke_ = &invoke_target_<F>;
+        if constexpr (not is_trivial_<F>) {
+            vtable_ptr_ = &vtable_for_<F>;
+        }
+    }
+
+    void copy_from_ (inplace_function const& other) {
+        if (other.vtable_ptr_ != nullptr) {
+            other.vtable_ptr_->copy(buffer_, other.buffer_);
+        } else if (other.invoke_ != nullptr) {
+            __builtin_memcpy(buffer_, other.buffer_, Capacity);
+        }
+        invoke_ = other.invoke_;
+        vtable_ptr_ = other.vtable_ptr_;
+    }
+
+    void move_from_ (inplace_function& other) noexcept {
+        if (other.vtable_ptr_ != nullptr) {
+            other.vtable_ptr_->relocate(buffer_, other.buffer_);
+        } else if (other.invoke_ != nullptr) {
+            __builtin_memcpy(buffer_, other.buffer_, Capacity);
+        }
+        invoke_ = exfs::exchange(other.invoke_, nullptr);
+        vtable_ptr_ = exfs::exchange(other.vtable_ptr_, nullptr);
+    }
+
+    void reset_ () noexcept {
+        if (vtable_ptr_ != nullptr) {
+            vtable_ptr_->destroy(buffer_);
+        }
+        invoke_ = nullptr;
+        vtable_ptr_ = nullptr;
+    }
+
+    invoke_fn_ invoke_ = nullptr;
+    vtable_ const* vtable_ptr_ = nullptr;
+    alignas(Alignment) mutable std::byte buffer_[Capacity];
+};
+
+namespace __detail {
+template <typename Signature, std::size_t Capacity, std::size_t Alignment>
+inline constexpr bool __is_inplace_function<
+    inplace_function<Signature, Capacity, Alignment>
+> = true;
+}  // namespace __detail
+}  // namespace exfs
+
+#endif  // EXFS_INPLACE_FUNCTION_HPP_
@@ -0,0 +1,232 @@
+#include "exfs/inplace_function.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/utility/functions.hpp"
+
+namespace {
+int add_one (int value) { return value + 1; }
+
+using Function = exfs::inplace_function<int(int), 64u>;
+}  // namespace
+
+TEST_CASE (
+    "exfs::inplace_function - type properties",
+    "[unit][inplace_function]"
+) {
+    CHECK(std::is_nothrow_move_constructible_v<Function>);
+    CHECK(std::is_nothrow_move_assignable_v<Function>);
+    CHECK(std::is_copy_constructible_v<Function>);
+    CHECK(sizeof(Function) == 64u + 2u * sizeof(void*));
+
+    CHECK(Function::capacity == 64u);
+    CHECK(Function::alignment == alignof(std::max_align_t));
+    CHECK(std::is_same_v<Function::result_type, int>);
+}
+
+TEST_CASE (
+    "exfs::inplace_function - callables which do not fit are rejected",
+    "[unit][inplace_function]"
+) {
+    auto small = [a = std::array<char, 64u>{}] (int) { return int{a[0]}; };
+    auto large = [a = std::array<char, 65u>{}] (int) { return int{a[0]}; };
+    auto wrong_sig = [] (std::string const&) { return 0; };
+
+    struct Throwing_Move {
+        Throwing_Move () = default;
+        Throwing_Move (Throwing_Move const&) = default;
+        Throwing_Move (Throwing_Move&&) noexcept(false) {}
+        int operator () (int) const { return 0; }
+    };
+
+    struct alignas(64) Over_Aligned {
+        int operator () (int) const { return 0; }
+    };
+
+    CHECK(std::is_constructible_v<Function, decltype(small)>);
+    CHECK(not std::is_constructible_v<Function, decltype(large)>);
+    CHECK(not std::is_constructible_v<Function, decltype(wrong_sig)>);
+    CHECK(not std::is_constructible_v<Function, Throwing_Move>);
+    CHECK(not std::is_constructible_v<Function, Over_Aligned>);
+}
+
+SCENARIO (
+    "exfs::inplace_function - invoking targets",
+    "[unit][inplace_function]"
+) {
+    WHEN ("default constructing a function") {
+        Function func{};
+
+        THEN ("it is empty") {
+            CHECK(not func);
+            CHECK(func == nullptr);
+        }
+    }
+
+    WHEN ("constructing from a null function pointer") {
+        int (*ptr)(int) = nullptr;
+        Function func{ptr};
+
+        THEN ("it is empty") {
+            CHECK(not func);
+        }
+    }
+
+    WHEN ("constructing from a function pointer") {
+        Function func{&add_one};
+
+        THEN ("invoking the function calls the target") {
+            REQUIRE(func);
+            CHECK(func(41) == 42);
+        }
+    }
+
+    WHEN ("constructing from a stateful lambda") {
+        int calls = 0;
+        Function func{[&calls, offset = 10] (int value) {
+            ++calls;
+            return value + offset;
+        }};
+
+        THEN ("invoking the function calls the target with its state") {
+            CHECK(func(1) == 11);
+            CHECK(func(2) == 12);
+            CHECK(calls == 2);
+        }
+    }
+
+    WHEN ("storing a callable returning a different type") {
+        exfs::inplace_function<long(short)> func{[] (int v) { return v * 2; }};
+
+        THEN ("the result is converted") {
+            CHECK(func(21) == 42L);
+        }
+    }
+
+    WHEN ("storing a callable in a function returning void") {
+        int result = 0;
+        exfs::inplace_function<void(int)> func{[&result] (int value) {
+            result = value;
+            return value;
+        }};
+        func(7);
+
+        THEN ("the result is discarded") {
+            CHECK(result == 7);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::inplace_function - copying and moving non-trivial targets",
+    "[unit][inplace_function]"
+) {
+    using namespace std::literals::string_literals;
+    auto const counter = std::make_shared<int>(0);
+
+    GIVEN ("a function storing a target with non-trivial lifetime") {
+        Function func{[counter, str = "abc"s] (int value) {
+            return value + static_cast<int>(str.size()) + *counter;
+        }};
+        REQUIRE(counter.use_count() == 2);
+
+        WHEN ("copy constructing the function") {
+            Function copy{func};
+
+            THEN ("the target is copied") {
+                CHECK(counter.use_count() == 3);
+                CHECK(copy(1) == 4);
+                CHECK(func(1) == 4);
+            }
+        }
+
+        WHEN ("move constructing the function") {
+            Function moved{exfs::move(func)};
+
+            THEN ("the target is relocated and the source is empty") {
+                CHECK(counter.use_count() == 2);
+                CHECK(moved(1) == 4);
+                CHECK(not func);
+            }
+        }
+
+        WHEN ("copy assigning over another stateful function") {
+            auto const other_counter = std::make_shared<int>(0);
+            Function other{[other_counter] (int) { return *other_counter; }};
+            other = func;
+
+            THEN ("the old target is destroyed and the new one copied") {
+                CHECK(other_counter.use_count() == 1);
+                CHECK(counter.use_count() == 3);
+                CHECK(other(2) == 5);
+            }
+        }
+
+        WHEN ("move assigning to an empty function") {
+            Function other{};
+            other = exfs::move(func);
+
+            THEN ("the target is relocated") {
+                CHECK(counter.use_count() == 2);
+                CHECK(other(2) == 5);
+                CHECK(not func);
+            }
+        }
+
+        WHEN ("assigning nullptr") {
+            func = nullptr;
+
+            THEN ("the target is destroyed") {
+                CHECK(counter.use_count() == 1);
+                CHECK(not func);
+            }
+        }
+
+        WHEN ("swapping with a function storing a trivial target") {
+            Function other{&add_one};
+            swap(func, other);
+
+            THEN ("the targets are exchanged") {
+                CHECK(func(1) == 2);
+                CHECK(other(1) == 4);
+                CHECK(counter.use_count() == 2);
+            }
+        }
+
+        WHEN ("the function is destroyed") {
+            { Function moved{exfs::move(func)}; }
+
+            THEN ("the target is destroyed") {
+                CHECK(counter.use_count() == 1);
+            }
+        }
+    }
+
+    GIVEN ("a function storing a trivially copyable target") {
+        int state = 5;
+        Function func{[&state] (int value) { return value * state; }};
+
+        WHEN ("copying the function") {
+            Function copy{func};
+            state = 6;
+
+            THEN ("both copies refer to the same state") {
+                CHECK(copy(2) == 12);
+                CHECK(func(2) == 12);
+            }
+        }
+
+        WHEN ("assigning a new callable") {
+            func = &add_one;
+
+            THEN ("the new target is invoked") {
+                CHECK(func(2) == 3);
+            }
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#include "exfs/intrusive_list.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+constexpr std::size_t churn_count = 256u;
+
+struct Task {
+    std::uint32_t id;
+    exfs::list_hook<exfs::link_mode::normal> hook{};
+};
+
+// A pseudo-random sequence of element indices to move around.
+std::vector<std::size_t> churn_order (std::size_t size) {
+    std::vector<std::size_t> order(churn_count);
+    std::uint32_t seed = 12345u;
+    for (auto& index : order) {
+        seed = seed * 1664525u + 1013904223u;
+        index = (seed >> 8u) % size;
+    }
+    return order;
+}
+
+// Each iteration removes an arbitrary element and reinserts it at the back,
+// as when a task's timer is restarted.
+void churn_intrusive_list (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const order = churn_order(size);
+    std::vector<Task> tasks(size);
+    exfs::intrusive_list<Task, &Task::hook> list{};
+    for (auto& task : tasks) {
+        list.push_back(task);
+    }
+
+    for (auto _ : state) {
+        for (auto index : order) {
+            list.erase(list.iterator_to(tasks[index]));
+            list.push_back(tasks[index]);
+        }
+        benchmark::DoNotOptimize(list.front());
+    }
+
+    state.SetItemsProcessed(state.iterations() * churn_count);
+}
+BENCHMARK(churn_intrusive_list)->Arg(16)->Arg(256);
+
+void churn_std_list (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const order = churn_order(size);
+    std::list<std::uint32_t> list{};
+    std::vector<std::list<std::uint32_t>::iterator> positions(size);
+    for (std::size_t idx = 0u; idx < size; ++idx) {
+        positions[idx] = list.insert(list.end(), std::uint32_t(idx));
+    }
+
+    for (auto _ : state) {
+        for (auto index : order) {
+            list.erase(positions[index]);
+            positions[index] = list.insert(list.end(), std::uint32_t(index));
+        }
+        benchmark::DoNotOptimize(list.front());
+    }
+
+    state.SetItemsProcessed(state.iterations() * churn_count);
+}
+BENCHMARK(churn_std_list)->Arg(16)->Arg(256);
+
+// Same churn, but std::list relinks its existing node with splice instead of
+// reallocating it.
+void churn_std_list_splice (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const order = churn_order(size);
+    std::list<std::uint32_t> list{};
+    std::vector<std::list<std::uint32_t>::iterator> positions(size);
+    for (std::size_t idx = 0u; idx < size; ++idx) {
+        positions[idx] = list.insert(list.end(), std::uint32_t(idx));
+    }
+
+    for (auto _ : state) {
+        for (auto index : order) {
+            list.splice(list.end(), list, positions[index]);
+        }
+        benchmark::DoNotOptimize(list.front());
+    }
+
+    state.SetItemsProcessed(state.iterations() * churn_count);
+}
+BENCHMARK(churn_std_list_splice)->Arg(16)->Arg(256);
+
+// Filling a list and then draining it from the front, as for a wait queue.
+void fill_drain_intrusive_list (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::vector<Task> tasks(size);
+    exfs::intrusive_list<Task, &Task::hook> list{};
+
+    for (auto _ : state) {
+        for (auto& task : tasks) {
+            list.push_back(task);
+        }
+        std::uint32_t sum = 0u;
+        while (not list.empty()) {
+            sum += list.front().id;
+            list.pop_front();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(fill_drain_intrusive_list)->Arg(16)->Arg(256);
+
+void fill_drain_std_list (benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    std::list<std::uint32_t> list{};
+
+    for (auto _ : state) {
+        for (std::size_t idx = 0u; idx < size; ++idx) {
+            list.push_back(std::uint32_t(idx));
+        }
+        std::uint32_t sum = 0u;
+        while (not list.empty()) {
+            sum += list.front();
+            list.pop_front();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(fill_drain_std_list)->Arg(16)->Arg(256);
+}  // namespace
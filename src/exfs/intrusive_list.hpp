@@ -0,0 +1,626 @@
+#ifndef EXFS_INTRUSIVE_LIST_HPP_
+#define EXFS_INTRUSIVE_LIST_HPP_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/reverse_iterator.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs {
+/**
+ * Selects how an intrusive hook tracks whether it is linked into a container.
+ */
+enum class link_mode {
+    /**
+     * The hook only holds the links. Nothing is reset when an element is
+     * removed, and whether a hook is linked cannot be queried.
+     */
+    normal,
+
+    /**
+     * The hook is reset when its element is removed from a container, so
+     * @c is_linked() is always accurate. Destroying a container unlinks all
+     * of its elements. Inserting an element which is already linked, or
+     * destroying a hook which is still linked, traps instead of corrupting
+     * the containers.
+     */
+    safe_link,
+
+    /**
+     * Like @c safe_link, except that the element unlinks itself from its
+     * container when the hook is destroyed, instead of trapping. It can also
+     * be unlinked by calling @c unlink(), without any reference to the
+     * container.
+     */
+    auto_unlink,
+};
+
+template <typename T, auto Hook>
+class intrusive_list;
+
+namespace __detail {
+// Called on a misuse of a hook which is detected at run time. It is not
+// constexpr, so a misuse during constant evaluation fails to compile.
+[[noreturn]] inline void __hook_misuse () noexcept {
+    __builtin_trap();
+}
+}  // namespace __detail
+
+/**
+ * Member hook which makes an object linkable into an @c intrusive_list.
+ *
+ * Copying an object does not copy its position in a list: a copied hook is
+ * unlinked and assigning to a hook leaves its links unchanged.
+ *
+ * @tparam Mode How the hook tracks its linked state.
+ */
+template <link_mode Mode = link_mode::safe_link>
+class list_hook {
+  public:
+    static constexpr link_mode mode = Mode;
+
+    constexpr list_hook () noexcept = default;
+
+    constexpr list_hook (list_hook const&) noexcept {}
+
+    constexpr list_hook& operator = (list_hook const&) noexcept {
+        return *this;
+    }
+
+    /**
+     * Unlinks the element from its list if this is an auto-unlink hook.
+     * Traps if this is a safe-link hook which is still linked.
+     */
+    constexpr ~list_hook () {
+        if constexpr (Mode == link_mode::auto_unlink) {
+            unlink();
+        } else if constexpr (Mode == link_mode::safe_link) {
+            if (is_linked()) {
+                __detail::__hook_misuse();
+            }
+        }
+    }
+
+    /**
+     * Checks if the element is currently in a list.
+     */
+    constexpr bool is_linked () const noexcept
+    requires (Mode != link_mode::normal) {
+        return next_ != nullptr;
+    }
+
+    /**
+     * Removes the element from whichever list it is in, if any.
+     */
+    constexpr void unlink () noexcept
+    requires (Mode == link_mode::auto_unlink) {
+        if (is_linked()) {
+            unlink_();
+        }
+    }
+
+  private:
+    template <typename, auto>
+    friend class intrusive_list;
+
+    // Links this hook in before `next`.
+    constexpr void link_before_ (list_hook* next) noexcept {
+        next_ = next;
+        prev_ = next->prev_;
+        prev_->next_ = this;
+        next->prev_ = this;
+    }
+
+    constexpr void unlink_ () noexcept {
+        prev_->next_ = next_;
+        next_->prev_ = prev_;
+        if constexpr (Mode != link_mode::normal) {
+            next_ = nullptr;
+            prev_ = nullptr;
+        }
+    }
+
+    list_hook* next_ = nullptr;
+    list_hook* prev_ = nullptr;
+};
+
+namespace __detail {
+template <typename T, auto Hook>
+struct __member_hook;
+
+template <typename T, link_mode Mode, list_hook<Mode> T::* Hook>
+struct __member_hook<T, Hook> {
+    static_assert(
+        not std::is_polymorphic_v<T>,
+        "The elements of an intrusive_list cannot be polymorphic."
+    );
+
+    using hook_type = list_hook<Mode>;
+
+    static hook_type* to_hook (T& value) noexcept {
+        return &(value.*Hook);
+    }
+
+    static T* to_value (hook_type* hook) noexcept {
+        return reinterpret_cast<T*>(
+            reinterpret_cast<unsigned char*>(hook) - offset_()
+        );
+    }
+
+  private:
+    // The offset of the hook within T, as offsetof would give, which does
+    // not take a pointer to member. No T exists in probe, so applying Hook
+    // to it is formally undefined behaviour. It is relied upon only for
+    // types without virtual functions or virtual bases: the offset of a data
+    // member of such a type does not depend on the object, and the vptr
+    // checks of sanitizers do not apply to it. Virtual bases cannot be
+    // detected, so they are only documented. The computation is folded to a
+    // constant by the optimizer.
+    static std::ptrdiff_t offset_ () noexcept {
+        alignas(T) static constexpr unsigned char probe[sizeof(T)] = {};
+        auto const* object = reinterpret_cast<T const*>(probe);
+        return reinterpret_cast<unsigned char const*>(&(object->*Hook)) -
+            probe;
+    }
+};
+}  // namespace __detail
+
+/**
+ * Doubly-linked list of objects which are not owned by the list.
+ *
+ * Instead of allocating nodes, the list links objects through a
+ * @c list_hook data member named by @p Hook, e.g.
+ * `intrusive_list<Task, &Task::wait_hook>`. Inserting and removing elements
+ * never allocates and removing any element is constant time given a reference
+ * to it. The caller is responsible for keeping the elements alive while they
+ * are in the list, and an element can be in only one list per hook.
+ *
+ * The list does not store its size, which makes splicing a range and
+ * auto-unlinking elements constant time. Consequently, @c size() is linear.
+ *
+ * @tparam T The type of the elements. It cannot have virtual functions or
+ *     virtual bases; its data members may have any access.
+ * @tparam Hook Pointer to the @c list_hook data member of @p T.
+ */
+template <typename T, auto Hook>
+class intrusive_list {
+    using traits_ = __detail::__member_hook<T, Hook>;
+    using hook_type_ = typename traits_::hook_type;
+
+    static constexpr link_mode mode_ = hook_type_::mode;
+
+    template <bool is_const>
+    class iterator_ {
+        using node_type_ = std::conditional_t<
+            is_const,
+            hook_type_ const,
+            hook_type_
+        >;
+
+      public:
+        using iterator_concept  = exfs::iterator::bidirectional_iterator_tag;
+        using iterator_category = exfs::iterator::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<is_const, T const*, T*>;
+        using reference         = std::conditional_t<is_const, T const&, T&>;
+
+        constexpr iterator_ () noexcept = default;
+
+        /**
+         * Converts a mutable iterator to a const iterator.
+         */
+        template <bool other_const>
+        requires (is_const and not other_const)
+        constexpr iterator_ (iterator_<other_const> other) noexcept
+              : node_{other.node_} {}
+
+        reference operator * () const noexcept {
+            return *traits_::to_value(const_cast<hook_type_*>(node_));
+        }
+
+        pointer operator -> () const noexcept {
+            return traits_::to_value(const_cast<hook_type_*>(node_));
+        }
+
+        constexpr iterator_& operator ++ () noexcept {
+            node_ = node_->next_;
+            return *this;
+        }
+
+        constexpr iterator_ operator ++ (int) noexcept {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        constexpr iterator_& operator -- () noexcept {
+            node_ = node_->prev_;
+            return *this;
+        }
+
+        constexpr iterator_ operator -- (int) noexcept {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        friend constexpr bool
+        operator == (iterator_ const&, iterator_ const&) = default;
+
+      private:
+        friend class intrusive_list;
+        friend class iterator_<not is_const>;
+
+        constexpr explicit iterator_ (node_type_* node) noexcept
+              : node_{node} {}
+
+        node_type_* node_ = nullptr;
+    };
+
+    template <typename U>
+    using rev_iter_ = exfs::iterator::reverse_iterator<U>;
+
+  public:
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = T const*;
+    using reference       = value_type&;
+    using const_reference = value_type const&;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using iterator               = iterator_<false>;
+    using const_iterator         = iterator_<true>;
+    using reverse_iterator       = rev_iter_<iterator>;
+    using const_reverse_iterator = rev_iter_<const_iterator>;
+
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Default constructor. Constructs an empty list.
+     */
+    intrusive_list () noexcept {
+        reset_root_();
+    }
+
+    intrusive_list (intrusive_list const&) = delete;
+
+    /**
+     * Takes over the elements of @p other, which is left empty.
+     *
+     * @param[in] other The list to move from.
+     */
+    intrusive_list (intrusive_list&& other) noexcept {
+        reset_root_();
+        splice(end(), other);
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Unlinks all elements (except in @c link_mode::normal, where the
+     * elements are left untouched).
+     */
+    ~intrusive_list () {
+        if constexpr (mode_ != link_mode::normal) {
+            clear();
+            // The sentinel is a hook too, which must not be destroyed while
+            // linked to itself.
+            root_.next_ = nullptr;
+            root_.prev_ = nullptr;
+        }
+    }
+
+    intrusive_list& operator = (intrusive_list const&) = delete;
+
+    /**
+     * Replaces the elements of this list with those of @p other, which is
+     * left empty.
+     *
+     * @param[in] other The list to move from.
+     * @return A reference to this list.
+     */
+    intrusive_list& operator = (intrusive_list&& other) noexcept {
+        if (this != &other) {
+            clear();
+            splice(end(), other);
+        }
+        return *this;
+    }
+
+    /**
+     * @name Iterators
+     * @{
+     */
+
+    iterator begin () noexcept { return iterator{root_.next_}; }
+    const_iterator begin () const noexcept {
+        return const_iterator{root_.next_};
+    }
+    const_iterator cbegin () const noexcept { return begin(); }
+
+    iterator end () noexcept { return iterator{&root_}; }
+    const_iterator end () const noexcept { return const_iterator{&root_}; }
+    const_iterator cend () const noexcept { return end(); }
+
+    reverse_iterator rbegin () noexcept { return reverse_iterator{end()}; }
+    const_reverse_iterator rbegin () const noexcept {
+        return const_reverse_iterator{end()};
+    }
+    const_reverse_iterator crbegin () const noexcept { return rbegin(); }
+
+    reverse_iterator rend () noexcept { return reverse_iterator{begin()}; }
+    const_reverse_iterator rend () const noexcept {
+        return const_reverse_iterator{begin()};
+    }
+    const_reverse_iterator crend () const noexcept { return rend(); }
+
+    /**
+     * Returns an iterator to @p value, which must be an element of this list.
+     * This is constant time.
+     */
+    static iterator iterator_to (reference value) noexcept {
+        return iterator{traits_::to_hook(value)};
+    }
+
+    /**
+     * @overload iterator_to()
+     */
+    static const_iterator iterator_to (const_reference value) noexcept {
+        return const_iterator{traits_::to_hook(const_cast<reference>(value))};
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Size
+     * @{
+     */
+
+    /**
+     * Checks if the list has no elements. This is constant time.
+     */
+    [[nodiscard]] bool empty () const noexcept {
+        return root_.next_ == &root_;
+    }
+
+    /**
+     * Returns the number of elements. This is linear in the number of
+     * elements since the size is not stored.
+     */
+    [[nodiscard]] size_type size () const noexcept {
+        size_type result = 0u;
+        for (auto const* node = root_.next_; node != &root_;) {
+            node = node->next_;
+            ++result;
+        }
+        return result;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Element Access
+     * @{
+     */
+
+    /**
+     * @warning Calling @c front() on an empty list is undefined.
+     */
+    reference front () noexcept { return *begin(); }
+    const_reference front () const noexcept { return *begin(); }
+
+    /**
+     * @warning Calling @c back() on an empty list is undefined.
+     */
+    reference back () noexcept { return *--end(); }
+    const_reference back () const noexcept { return *--end(); }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Modifiers
+     * @{
+     */
+
+    /**
+     * Links @p value in before @p pos.
+     *
+     * @warning If @p value is already in a list through the same hook, this
+     *     traps, except in @c link_mode::normal, where it is undefined
+     *     behavior.
+     *
+     * @return An iterator to @p value.
+     */
+    iterator insert (const_iterator pos, reference value) noexcept {
+        auto* const hook = traits_::to_hook(value);
+        if constexpr (mode_ != link_mode::normal) {
+            if (hook->is_linked()) {
+                __detail::__hook_misuse();
+            }
+        }
+        hook->link_before_(mutable_(pos));
+        return iterator{hook};
+    }
+
+    /**
+     * Links @p value in at the front of the list.
+     */
+    void push_front (reference value) noexcept {
+        insert(begin(), value);
+    }
+
+    /**
+     * Links @p value in at the back of the list.
+     */
+    void push_back (reference value) noexcept {
+        insert(end(), value);
+    }
+
+    /**
+     * Unlinks the element at @p pos. The element itself is not destroyed.
+     *
+     * @return An iterator to the element following the removed one.
+     */
+    iterator erase (const_iterator pos) noexcept {
+        auto* const node = mutable_(pos);
+        iterator const next{node->next_};
+        node->unlink_();
+        return next;
+    }
+
+    /**
+     * Unlinks the elements in the range [first, last).
+     *
+     * @return An iterator to @p last.
+     */
+    iterator erase (const_iterator first, const_iterator last) noexcept {
+        while (first != last) {
+            first = erase(first);
+        }
+        return iterator{mutable_(last)};
+    }
+
+    /**
+     * Unlinks the first element.
+     *
+     * @warning Calling this function on an empty list is undefined behavior.
+     */
+    void pop_front () noexcept {
+        erase(begin());
+    }
+
+    /**
+     * Unlinks the last element.
+     *
+     * @warning Calling this function on an empty list is undefined behavior.
+     */
+    void pop_back () noexcept {
+        erase(--end());
+    }
+
+    /**
+     * Unlinks all elements. In @c link_mode::normal this is constant time,
+     * otherwise every hook is reset.
+     */
+    void clear () noexcept {
+        if constexpr (mode_ != link_mode::normal) {
+            auto* node = root_.next_;
+            while (node != &root_) {
+                auto* const next = node->next_;
+                node->next_ = nullptr;
+                node->prev_ = nullptr;
+                node = next;
+            }
+        }
+        reset_root_();
+    }
+
+    /**
+     * Moves all elements of @p other in before @p pos. This is constant time.
+     */
+    void splice (const_iterator pos, intrusive_list& other) noexcept {
+        splice(pos, other, other.begin(), other.end());
+    }
+
+    /**
+     * @overload splice()
+     */
+    void splice (const_iterator pos, intrusive_list&& other) noexcept {
+        splice(pos, other);
+    }
+
+    /**
+     * Moves the element at @p it from @p other in before @p pos. This is
+     * constant time.
+     */
+    void splice (
+        const_iterator pos,
+        intrusive_list& other,
+        const_iterator it
+    ) noexcept {
+        const_iterator last = it;
+        splice(pos, other, it, ++last);
+    }
+
+    /**
+     * Moves the elements in [first, last) from @p other in before @p pos.
+     * This is constant time, regardless of the number of elements moved.
+     *
+     * @warning It is undefined behavior if @p pos is in [first, last).
+     */
+    void splice (
+        const_iterator pos,
+        intrusive_list& /* other */,
+        const_iterator first,
+        const_iterator last
+    ) noexcept {
+        if (first == last) {
+            return;
+        }
+
+        auto* const next = mutable_(pos);
+        auto* const head = mutable_(first);
+        auto* const tail = mutable_(last)->prev_;
+
+        // Detach [head, tail] from its list.
+        head->prev_->next_ = tail->next_;
+        tail->next_->prev_ = head->prev_;
+
+        // Attach it before `next`.
+        head->prev_ = next->prev_;
+        tail->next_ = next;
+        next->prev_->next_ = head;
+        next->prev_ = tail;
+    }
+
+    /**
+     * Exchanges the elements of this list and @p other. This is constant
+     * time.
+     */
+    void swap (intrusive_list& other) noexcept {
+        intrusive_list tmp{exfs::move(other)};
+        other.splice(other.end(), *this);
+        splice(end(), tmp);
+    }
+
+    /**
+     * @overload swap()
+     */
+    friend void swap (intrusive_list& a, intrusive_list& b) noexcept {
+        a.swap(b);
+    }
+
+    /**
+     * @}
+     */
+
+  private:
+    static hook_type_* mutable_ (const_iterator pos) noexcept {
+        return const_cast<hook_type_*>(pos.node_);
+    }
+
+    void reset_root_ () noexcept {
+        root_.next_ = &root_;
+        root_.prev_ = &root_;
+    }
+
+    hook_type_ root_;
+};
+}  // namespace exfs
+
+#endif  // EXFS_INTRUSIVE_LIST_HPP_
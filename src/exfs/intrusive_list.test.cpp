@@ -0,0 +1,458 @@
+#include "exfs/intrusive_list.hpp"
+
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <vector>
+
+// The death tests of the safe-link mode run in a forked child process, which
+// requires POSIX.
+#if __has_include(<fcntl.h>) and \
+    __has_include(<sys/wait.h>) and \
+    __has_include(<unistd.h>)
+#define EXFS_TEST_HAS_FORK 1
+#include <csignal>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace {
+template <exfs::link_mode Mode>
+struct Task {
+    int id;
+    exfs::list_hook<Mode> wait_hook{};
+    exfs::list_hook<Mode> timer_hook{};
+};
+
+// An element with both public and private members, which is not
+// standard-layout.
+class Prioritized_Task {
+  public:
+    explicit Prioritized_Task (int priority) : priority_{priority} {}
+
+    int priority () const { return priority_; }
+
+    exfs::list_hook<> hook{};
+
+  private:
+    int priority_;
+};
+
+template <exfs::link_mode Mode>
+using Wait_List = exfs::intrusive_list<Task<Mode>, &Task<Mode>::wait_hook>;
+
+template <exfs::link_mode Mode>
+using Timer_List = exfs::intrusive_list<Task<Mode>, &Task<Mode>::timer_hook>;
+
+#ifdef EXFS_TEST_HAS_FORK
+// Runs fn in a child process and checks if it was killed by a trap, i.e. by
+// SIGILL or SIGTRAP. The child restores the default handlers for these
+// signals, which Catch replaces, and discards its output so that it does not
+// show up in the test reports.
+template <typename Fn>
+bool traps (Fn fn) {
+    auto const pid = fork();
+    if (pid == -1) {
+        FAIL("fork() failed");
+    }
+    if (pid == 0) {
+        std::signal(SIGILL, SIG_DFL);
+        std::signal(SIGTRAP, SIG_DFL);
+        auto const null = open("/dev/null", O_WRONLY);
+        if (null != -1) {
+            dup2(null, STDOUT_FILENO);
+            dup2(null, STDERR_FILENO);
+        }
+        fn();
+        _exit(0);
+    }
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid) {
+        FAIL("waitpid() failed");
+    }
+    return WIFSIGNALED(status) and
+        (WTERMSIG(status) == SIGILL or WTERMSIG(status) == SIGTRAP);
+}
+#endif
+
+template <typename Range>
+std::vector<int> ids (Range const& range) {
+    std::vector<int> result;
+    for (auto const& task : range) {
+        result.push_back(task.id);
+    }
+    return result;
+}
+
+template <typename List>
+std::vector<int> reversed_ids (List const& list) {
+    std::vector<int> result;
+    for (auto it = list.rbegin(); it != list.rend(); ++it) {
+        result.push_back(it->id);
+    }
+    return result;
+}
+}  // namespace
+
+TEST_CASE (
+    "exfs::intrusive_list - iterator properties",
+    "[unit][intrusive_list]"
+) {
+    using List = Wait_List<exfs::link_mode::safe_link>;
+
+    CHECK(exfs::iterator::bidirectional_iterator<List::iterator>);
+    CHECK(exfs::iterator::bidirectional_iterator<List::const_iterator>);
+    CHECK(exfs::iterator::bidirectional_iterator<List::reverse_iterator>);
+    CHECK(std::bidirectional_iterator<List::iterator>);
+    CHECK(not exfs::iterator::random_access_iterator<List::iterator>);
+
+    CHECK(std::is_same_v<
+        std::iter_reference_t<List::const_iterator>,
+        Task<exfs::link_mode::safe_link> const&
+    >);
+    CHECK(std::is_convertible_v<List::iterator, List::const_iterator>);
+    CHECK(not std::is_convertible_v<List::const_iterator, List::iterator>);
+
+    // The list is only the sentinel's links and hooks are only two links.
+    CHECK(sizeof(List) == 2u * sizeof(void*));
+    CHECK(sizeof(exfs::list_hook<>) == 2u * sizeof(void*));
+    CHECK(not std::is_copy_constructible_v<List>);
+    CHECK(std::is_nothrow_move_constructible_v<List>);
+}
+
+TEMPLATE_TEST_CASE_SIG (
+    "exfs::intrusive_list - basic usage matches std::list",
+    "[unit][std-parity][intrusive_list]",
+    ((exfs::link_mode Mode), Mode),
+    exfs::link_mode::normal,
+    exfs::link_mode::safe_link,
+    exfs::link_mode::auto_unlink
+) {
+    std::vector<Task<Mode>> tasks(8u);
+    for (int idx = 0; idx < 8; ++idx) {
+        tasks[idx].id = idx;
+    }
+
+    Wait_List<Mode> list{};
+    std::list<int> reference{};
+
+    THEN ("a new list is empty") {
+        CHECK(list.empty());
+        CHECK(list.size() == 0u);
+        CHECK(list.begin() == list.end());
+        CHECK(list.rbegin() == list.rend());
+    }
+
+    WHEN ("elements are pushed at both ends") {
+        for (int idx = 0; idx < 4; ++idx) {
+            list.push_back(tasks[idx]);
+            reference.push_back(idx);
+        }
+        for (int idx = 4; idx < 8; ++idx) {
+            list.push_front(tasks[idx]);
+            reference.push_front(idx);
+        }
+
+        THEN ("the list holds the same sequence as std::list") {
+            CHECK(list.size() == reference.size());
+            CHECK(ids(list) == std::vector<int>(
+                reference.begin(),
+                reference.end()
+            ));
+            CHECK(reversed_ids(list) == std::vector<int>(
+                reference.rbegin(),
+                reference.rend()
+            ));
+            CHECK(list.front().id == reference.front());
+            CHECK(list.back().id == reference.back());
+        }
+
+        AND_WHEN ("elements are removed from both ends and the middle") {
+            list.pop_front();
+            reference.pop_front();
+            list.pop_back();
+            reference.pop_back();
+            list.erase(list.iterator_to(tasks[1]));
+            reference.remove(1);
+
+            THEN ("the list holds the same sequence as std::list") {
+                CHECK(ids(list) == std::vector<int>(
+                    reference.begin(),
+                    reference.end()
+                ));
+            }
+        }
+
+        AND_WHEN ("an element is inserted in the middle") {
+            list.erase(list.iterator_to(tasks[2]));
+            auto const it = list.insert(list.iterator_to(tasks[5]), tasks[2]);
+
+            THEN ("it is linked before the position") {
+                CHECK(&*it == &tasks[2]);
+                CHECK(ids(list) == std::vector<int>{7, 6, 2, 5, 4, 0, 1, 3});
+            }
+        }
+
+        AND_WHEN ("a range is erased") {
+            auto const it = list.erase(
+                list.iterator_to(tasks[6]),
+                list.iterator_to(tasks[0])
+            );
+
+            THEN ("the following element is returned") {
+                CHECK(&*it == &tasks[0]);
+                CHECK(ids(list) == std::vector<int>{7, 0, 1, 2, 3});
+            }
+        }
+
+        AND_WHEN ("the list is cleared") {
+            list.clear();
+
+            THEN ("it is empty") {
+                CHECK(list.empty());
+                CHECK(list.begin() == list.end());
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::intrusive_list - splicing",
+    "[unit][intrusive_list]"
+) {
+    using Mode = std::integral_constant<
+        exfs::link_mode,
+        exfs::link_mode::safe_link
+    >;
+    Task<Mode::value> tasks[6] = {{0}, {1}, {2}, {3}, {4}, {5}};
+
+    GIVEN ("two lists") {
+        Wait_List<Mode::value> a{};
+        Wait_List<Mode::value> b{};
+        for (int idx = 0; idx < 3; ++idx) {
+            a.push_back(tasks[idx]);
+            b.push_back(tasks[idx + 3]);
+        }
+
+        WHEN ("one list is spliced into the other") {
+            a.splice(a.iterator_to(tasks[1]), b);
+
+            THEN ("all elements are moved") {
+                CHECK(ids(a) == std::vector<int>{0, 3, 4, 5, 1, 2});
+                CHECK(reversed_ids(a) == std::vector<int>{2, 1, 5, 4, 3, 0});
+                CHECK(b.empty());
+            }
+        }
+
+        WHEN ("a single element is spliced") {
+            a.splice(a.end(), b, b.iterator_to(tasks[4]));
+
+            THEN ("only that element is moved") {
+                CHECK(ids(a) == std::vector<int>{0, 1, 2, 4});
+                CHECK(ids(b) == std::vector<int>{3, 5});
+            }
+        }
+
+        WHEN ("a range is spliced") {
+            a.splice(a.begin(), b, b.iterator_to(tasks[4]), b.end());
+
+            THEN ("the range is moved") {
+                CHECK(ids(a) == std::vector<int>{4, 5, 0, 1, 2});
+                CHECK(ids(b) == std::vector<int>{3});
+            }
+        }
+
+        WHEN ("elements are reordered within a list") {
+            a.splice(a.begin(), a, a.iterator_to(tasks[2]));
+
+            THEN ("the element is moved") {
+                CHECK(ids(a) == std::vector<int>{2, 0, 1});
+            }
+        }
+
+        WHEN ("the lists are swapped") {
+            swap(a, b);
+
+            THEN ("their elements are exchanged") {
+                CHECK(ids(a) == std::vector<int>{3, 4, 5});
+                CHECK(ids(b) == std::vector<int>{0, 1, 2});
+            }
+        }
+
+        WHEN ("a list is moved") {
+            Wait_List<Mode::value> c{exfs::move(a)};
+
+            THEN ("the new list takes over the elements") {
+                CHECK(ids(c) == std::vector<int>{0, 1, 2});
+                CHECK(reversed_ids(c) == std::vector<int>{2, 1, 0});
+                CHECK(a.empty());
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::intrusive_list - link modes",
+    "[unit][intrusive_list]"
+) {
+    GIVEN ("safe-link elements in two lists through different hooks") {
+        using Safe_Task = Task<exfs::link_mode::safe_link>;
+        Safe_Task tasks[3] = {{0}, {1}, {2}};
+        Wait_List<exfs::link_mode::safe_link> waiting{};
+        Timer_List<exfs::link_mode::safe_link> timers{};
+        for (auto& task : tasks) {
+            waiting.push_back(task);
+        }
+        timers.push_back(tasks[2]);
+        timers.push_back(tasks[0]);
+
+        THEN ("each hook tracks its own list") {
+            CHECK(ids(waiting) == std::vector<int>{0, 1, 2});
+            CHECK(ids(timers) == std::vector<int>{2, 0});
+            CHECK(tasks[1].wait_hook.is_linked());
+            CHECK(not tasks[1].timer_hook.is_linked());
+        }
+
+        WHEN ("an element is erased") {
+            waiting.erase(waiting.iterator_to(tasks[0]));
+
+            THEN ("its hook is reset") {
+                CHECK(not tasks[0].wait_hook.is_linked());
+                CHECK(tasks[0].timer_hook.is_linked());
+            }
+        }
+
+        WHEN ("a list is destroyed") {
+            {
+                Wait_List<exfs::link_mode::safe_link> temporary{};
+                temporary.splice(temporary.end(), waiting);
+            }
+
+            THEN ("every element is unlinked") {
+                for (auto const& task : tasks) {
+                    CHECK(not task.wait_hook.is_linked());
+                }
+            }
+        }
+
+        WHEN ("an element is copied") {
+            Safe_Task const copy = tasks[1];
+
+            THEN ("the copy is not linked") {
+                CHECK(copy.id == 1);
+                CHECK(not copy.wait_hook.is_linked());
+                CHECK(waiting.size() == 3u);
+            }
+        }
+    }
+
+#ifdef EXFS_TEST_HAS_FORK
+    GIVEN ("a safe-link element in a list") {
+        using Safe_Task = Task<exfs::link_mode::safe_link>;
+
+        THEN ("inserting it into a second list traps") {
+            CHECK(traps([] {
+                Safe_Task task{0};
+                Wait_List<exfs::link_mode::safe_link> first{};
+                Wait_List<exfs::link_mode::safe_link> second{};
+                first.push_back(task);
+                second.push_back(task);
+            }));
+        }
+
+        THEN ("inserting it again into the same list traps") {
+            CHECK(traps([] {
+                Safe_Task task{0};
+                Wait_List<exfs::link_mode::safe_link> list{};
+                list.push_back(task);
+                list.push_front(task);
+            }));
+        }
+
+        THEN ("destroying it while linked traps") {
+            CHECK(traps([] {
+                Wait_List<exfs::link_mode::safe_link> list{};
+                Safe_Task task{0};
+                list.push_back(task);
+            }));
+        }
+
+        THEN ("it can be inserted again once removed") {
+            CHECK(not traps([] {
+                Safe_Task task{0};
+                Wait_List<exfs::link_mode::safe_link> first{};
+                Wait_List<exfs::link_mode::safe_link> second{};
+                first.push_back(task);
+                first.pop_front();
+                second.push_back(task);
+            }));
+        }
+    }
+#endif
+
+    GIVEN ("auto-unlink elements") {
+        using Auto_Task = Task<exfs::link_mode::auto_unlink>;
+        Wait_List<exfs::link_mode::auto_unlink> list{};
+        Auto_Task first{0};
+        Auto_Task last{3};
+        list.push_back(first);
+
+        WHEN ("an element is destroyed while linked") {
+            {
+                Auto_Task temporary{1};
+                list.push_back(temporary);
+                list.push_back(last);
+                CHECK(list.size() == 3u);
+            }
+
+            THEN ("it removes itself from the list") {
+                CHECK(ids(list) == std::vector<int>{0, 3});
+                CHECK(reversed_ids(list) == std::vector<int>{3, 0});
+            }
+        }
+
+        WHEN ("an element is unlinked through its hook") {
+            list.push_back(last);
+            first.wait_hook.unlink();
+
+            THEN ("it is removed without access to the list") {
+                CHECK(not first.wait_hook.is_linked());
+                CHECK(ids(list) == std::vector<int>{3});
+            }
+
+            AND_WHEN ("it is unlinked again") {
+                first.wait_hook.unlink();
+
+                THEN ("nothing happens") {
+                    CHECK(ids(list) == std::vector<int>{3});
+                }
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::intrusive_list - elements which are not standard-layout",
+    "[unit][intrusive_list]"
+) {
+    GIVEN ("elements with public and private members") {
+        CHECK(not std::is_standard_layout_v<Prioritized_Task>);
+
+        Prioritized_Task tasks[2] = {Prioritized_Task{7}, Prioritized_Task{3}};
+        exfs::intrusive_list<Prioritized_Task, &Prioritized_Task::hook> list{};
+        list.push_back(tasks[0]);
+        list.push_back(tasks[1]);
+
+        THEN ("they are linked through their hook") {
+            CHECK(&list.front() == &tasks[0]);
+            CHECK(list.back().priority() == 3);
+        }
+    }
+}
@@ -213,9 +213,30 @@ using __iter_concept_traits = std::conditional_t<
 template <typename I>
 struct __iter_concept_impl;
 
-// ITER_CONCEPT(I) is ITER_TRAITS(I)::iterator_concept if that is valid.
 template <typename I>
-requires requires { typename __iter_concept_traits<I>::iterator_concept; }
+concept __has_member_iter_concept = requires {
+    typename I::iterator_concept;
+};
+
+// ITER_CONCEPT(I) is I::iterator_concept if I declares it.
+//
+// This is a deviation from the standard, which looks the member up in
+// ITER_TRAITS(I): that instantiates iterator_traits<I>, and for iterators
+// which do not declare every legacy member type the cascade of legacy
+// iterator concepts behind it, only to find out whether it is specialized.
+// The results differ only for an iterator which declares iterator_concept and
+// whose iterator_traits specialization names a different one.
+template <__has_member_iter_concept I>
+struct __iter_concept_impl<I> {
+    using type = typename I::iterator_concept;
+};
+
+// Else, ITER_TRAITS(I)::iterator_concept if that is valid.
+template <typename I>
+requires (
+    not __has_member_iter_concept<I> and
+    requires { typename __iter_concept_traits<I>::iterator_concept; }
+)
 struct __iter_concept_impl<I> {
     using type = typename __iter_concept_traits<I>::iterator_concept;
 };
@@ -223,6 +244,7 @@ struct __iter_concept_impl<I> {
 // Else, ITER_TRAITS(I)::iterator_category if that is valid.
 template <typename I>
 requires (
+    not __has_member_iter_concept<I> and
     not requires { typename __iter_concept_traits<I>::iterator_concept; } and
     requires { typename __iter_concept_traits<I>::iterator_category; }
 )
@@ -233,6 +255,7 @@ struct __iter_concept_impl<I> {
 // Else, random_access_tag if iterator_traits<I> is not specialized.
 template <typename I>
 requires (
+    not __has_member_iter_concept<I> and
     not requires { typename __iter_concept_traits<I>::iterator_concept; } and
     not requires { typename __iter_concept_traits<I>::iterator_category; } and
     __default_iterator_traits<I>
@@ -284,8 +307,8 @@ concept output_iterator =
  */
 template <typename I>
 concept forward_iterator =
-    input_iterator<I> and
     std::derived_from<__detail::__iter_concept<I>, forward_iterator_tag> and
+    input_iterator<I> and
     incrementable<I> and
     sentinel_for<I, I>;
 
@@ -295,11 +318,11 @@ concept forward_iterator =
  */
 template <typename I>
 concept bidirectional_iterator =
-    forward_iterator<I> and
     std::derived_from<
         __detail::__iter_concept<I>,
         bidirectional_iterator_tag
     > and
+    forward_iterator<I> and
     requires (I i) {
         { --i } -> std::same_as<I&>;
         { i-- } -> std::same_as<I>;
@@ -313,11 +336,11 @@ concept bidirectional_iterator =
  */
 template <typename I>
 concept random_access_iterator =
-    bidirectional_iterator<I> and
     std::derived_from<
         __detail::__iter_concept<I>,
         random_access_iterator_tag
     > and
+    bidirectional_iterator<I> and
     std::totally_ordered<I> and
     sized_sentinel_for<I, I> and
     requires (I i, I const j, iter_difference_t<I> const n) {
@@ -336,8 +359,8 @@ concept random_access_iterator =
  */
 template <typename I>
 concept contiguous_iterator =
-    random_access_iterator<I> and
     std::derived_from<__detail::__iter_concept<I>, contiguous_iterator_tag> and
+    random_access_iterator<I> and
     std::is_lvalue_reference_v<iter_reference_t<I>> and
     std::same_as<
         iter_value_t<I>,
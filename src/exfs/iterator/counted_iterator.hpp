@@ -0,0 +1,336 @@
+#ifndef EXFS_ITERATOR_COUNTED_ITERATOR_HPP_
+#define EXFS_ITERATOR_COUNTED_ITERATOR_HPP_
+
+#include <compare>
+#include <concepts>
+#include <memory>
+#include <type_traits>
+
+#include "exfs/concepts.hpp"
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/iterator/legacy.hpp"
+#include "exfs/iterator/sentinels.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::iterator {
+namespace __detail {
+// The member types of counted_iterator which are only present when the
+// underlying iterator is readable, or is a legacy iterator.
+template <typename Iter>
+struct __counted_iterator_types {};
+
+template <input_iterator Iter>
+struct __counted_iterator_types<Iter> {
+    using iterator_concept = __iter_concept<Iter>;
+    using value_type       = iter_value_t<Iter>;
+};
+
+template <input_iterator Iter>
+requires requires { typename iterator_category_t<Iter>; }
+struct __counted_iterator_types<Iter> {
+    using iterator_concept  = __iter_concept<Iter>;
+    using iterator_category = iterator_category_t<Iter>;
+    using value_type        = iter_value_t<Iter>;
+};
+}  // namespace __detail
+
+/**
+ * This class is an iterator adaptor that behaves exactly like the underlying
+ * iterator, except that it keeps track of the distance to the end of its
+ * range. The end is reached when the count reaches zero, which is detected by
+ * comparing the iterator with @c default_sentinel.
+ *
+ * A counted range `[counted_iterator{first, n}, default_sentinel)` needs a
+ * single loop condition on the count, rather than a comparison with an end
+ * iterator and a separate bound check. Its size is known in constant time
+ * even when the underlying iterator is not random access.
+ *
+ * @tparam Iter The underlying iterator.
+ */
+template <input_or_output_iterator Iter>
+class counted_iterator : public __detail::__counted_iterator_types<Iter> {
+  public:
+    using iterator_type   = Iter;
+    using difference_type = iter_difference_t<Iter>;
+
+    /**
+     * Default constructor. The underlying iterator is value-initialized and
+     * the count is zero.
+     */
+    constexpr counted_iterator ()
+    requires std::default_initializable<Iter> = default;
+
+    /**
+     * Constructs an iterator over the @p count elements starting at @p iter.
+     *
+     * @warning It is undefined behavior if @p count is negative.
+     *
+     * @param[in] iter The underlying iterator to adapt.
+     * @param[in] count The number of elements in the range.
+     */
+    constexpr counted_iterator (Iter iter, difference_type count)
+          : current_{exfs::move(iter)},
+            count_{count} {}
+
+    /**
+     * Constructs a copy of @p other with a converted underlying iterator.
+     *
+     * @param[in] other Iterator to convert and adapt.
+     */
+    template <typename Other>
+    requires (
+        not std::is_same_v<Other, Iter> and
+        std::convertible_to<Other const&, Iter>
+    )
+    constexpr counted_iterator (counted_iterator<Other> const& other)
+          : current_{other.base()},
+            count_{other.count()} {}
+
+    /**
+     * Assigns the underlying iterator and the count of @p other.
+     *
+     * @param[in] other The iterator adaptor to assign from.
+     */
+    template <typename Other>
+    requires (
+        not std::is_same_v<Other, Iter> and
+        std::assignable_from<Iter&, Other const&>
+    )
+    constexpr counted_iterator&
+    operator = (counted_iterator<Other> const& other) {
+        current_ = other.base();
+        count_ = other.count();
+        return *this;
+    }
+
+    /**
+     * Returns the underlying iterator.
+     */
+    constexpr Iter const& base () const& noexcept { return current_; }
+
+    /**
+     * @overload base()
+     */
+    constexpr Iter base () && { return exfs::move(current_); }
+
+    /**
+     * Returns the number of elements left until the end of the range.
+     */
+    constexpr difference_type count () const noexcept { return count_; }
+
+    /**
+     * Returns a reference to the current element.
+     *
+     * @warning It is undefined behavior if the count is zero.
+     */
+    constexpr decltype(auto) operator * () { return *current_; }
+
+    /**
+     * @overload operator*()
+     */
+    constexpr decltype(auto) operator * () const
+    requires dereferenceable<Iter const> {
+        return *current_;
+    }
+
+    /**
+     * Returns a pointer to the current element. Only available when the
+     * underlying iterator is contiguous.
+     */
+    constexpr auto operator -> () const noexcept
+    requires contiguous_iterator<Iter> {
+        return std::to_address(current_);
+    }
+
+    /**
+     * Returns a reference to the element at the specified relative location.
+     *
+     * @warning It is undefined behavior if @p idx is not less than the count.
+     */
+    constexpr decltype(auto) operator [] (difference_type idx) const
+    requires random_access_iterator<Iter> {
+        return current_[idx];
+    }
+
+    /**
+     * Pre-increments the iterator by one, decrementing the count.
+     */
+    constexpr counted_iterator& operator ++ () {
+        ++current_;
+        --count_;
+        return *this;
+    }
+
+    /**
+     * Post-increments the iterator by one. For single-pass iterators, the
+     * result of post-incrementing the underlying iterator is returned.
+     */
+    constexpr decltype(auto) operator ++ (int) {
+        if constexpr (forward_iterator<Iter>) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        } else {
+            --count_;
+            return current_++;
+        }
+    }
+
+    /**
+     * Pre-decrements the iterator by one, incrementing the count.
+     */
+    constexpr counted_iterator& operator -- ()
+    requires bidirectional_iterator<Iter> {
+        --current_;
+        ++count_;
+        return *this;
+    }
+
+    /**
+     * Post-decrements the iterator by one.
+     */
+    constexpr counted_iterator operator -- (int)
+    requires bidirectional_iterator<Iter> {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    /**
+     * Advances the iterator by @p dist.
+     *
+     * @warning It is undefined behavior if @p dist is greater than the count.
+     */
+    constexpr counted_iterator& operator += (difference_type dist)
+    requires random_access_iterator<Iter> {
+        current_ += dist;
+        count_ -= dist;
+        return *this;
+    }
+
+    /**
+     * Recedes the iterator by @p dist.
+     */
+    constexpr counted_iterator& operator -= (difference_type dist)
+    requires random_access_iterator<Iter> {
+        current_ -= dist;
+        count_ += dist;
+        return *this;
+    }
+
+    friend constexpr counted_iterator operator + (
+        counted_iterator it,
+        difference_type dist
+    ) requires random_access_iterator<Iter> {
+        return it += dist;
+    }
+
+    friend constexpr counted_iterator operator + (
+        difference_type dist,
+        counted_iterator it
+    ) requires random_access_iterator<Iter> {
+        return it += dist;
+    }
+
+    friend constexpr counted_iterator operator - (
+        counted_iterator it,
+        difference_type dist
+    ) requires random_access_iterator<Iter> {
+        return it -= dist;
+    }
+
+    /**
+     * Computes the distance between two iterators over the same range from
+     * their counts, in constant time whatever the underlying iterator. The
+     * underlying iterators may differ in type, e.g. in constness, as long as
+     * they have a common type.
+     */
+    template <std::common_with<Iter> Other>
+    friend constexpr iter_difference_t<Other> operator - (
+        counted_iterator const& lhs,
+        counted_iterator<Other> const& rhs
+    ) noexcept {
+        return rhs.count() - lhs.count_;
+    }
+
+    /**
+     * Computes the distance from @p it to the end of its range.
+     */
+    friend constexpr difference_type operator - (
+        default_sentinel_t,
+        counted_iterator const& it
+    ) noexcept {
+        return it.count_;
+    }
+
+    /**
+     * @overload
+     */
+    friend constexpr difference_type operator - (
+        counted_iterator const& it,
+        default_sentinel_t
+    ) noexcept {
+        return -it.count_;
+    }
+
+    /**
+     * Two iterators over the same range are equal when their counts are.
+     */
+    template <std::common_with<Iter> Other>
+    friend constexpr bool operator == (
+        counted_iterator const& lhs,
+        counted_iterator<Other> const& rhs
+    ) noexcept {
+        return lhs.count_ == rhs.count();
+    }
+
+    /**
+     * The iterator has reached the end of its range when its count is zero.
+     */
+    friend constexpr bool operator == (
+        counted_iterator const& it,
+        default_sentinel_t
+    ) noexcept {
+        return it.count_ == 0;
+    }
+
+    /**
+     * Orders iterators over the same range by their positions, which is the
+     * inverse of the order of their counts.
+     */
+    template <std::common_with<Iter> Other>
+    friend constexpr std::strong_ordering operator <=> (
+        counted_iterator const& lhs,
+        counted_iterator<Other> const& rhs
+    ) noexcept {
+        return rhs.count() <=> lhs.count_;
+    }
+
+    friend constexpr decltype(auto) iter_move (counted_iterator const& it)
+    noexcept(noexcept(iterator::iter_move(it.current_)))
+    requires input_iterator<Iter> {
+        return iterator::iter_move(it.current_);
+    }
+
+    template <typename Other>
+    friend constexpr void iter_swap (
+        counted_iterator const& lhs,
+        counted_iterator<Other> const& rhs
+    ) noexcept(noexcept(iterator::iter_swap(lhs.current_, rhs.base())))
+    requires requires { iterator::iter_swap(lhs.current_, rhs.base()); } {
+        iterator::iter_swap(lhs.current_, rhs.base());
+    }
+
+  private:
+    Iter current_{};
+    difference_type count_ = 0;
+};
+
+template <typename Iter>
+counted_iterator (Iter, iter_difference_t<Iter>) -> counted_iterator<Iter>;
+}  // namespace exfs::iterator
+
+#endif  // EXFS_ITERATOR_COUNTED_ITERATOR_HPP_
@@ -0,0 +1,197 @@
+#include "exfs/iterator/counted_iterator.hpp"
+
+#include <concepts>
+#include <forward_list>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/iterator/sentinels.hpp"
+
+#include "models.hpp"
+
+namespace {
+namespace iter = exfs::iterator;
+
+using iter::counted_iterator;
+using iter::default_sentinel;
+using iter::default_sentinel_t;
+
+static_assert(iter::contiguous_iterator<counted_iterator<int*>>);
+static_assert(iter::random_access_iterator<
+    counted_iterator<iter::models::random_access_iterator>
+>);
+static_assert(iter::bidirectional_iterator<
+    counted_iterator<iter::models::bidirectional_iterator>
+>);
+static_assert(not iter::random_access_iterator<
+    counted_iterator<iter::models::bidirectional_iterator>
+>);
+static_assert(iter::forward_iterator<
+    counted_iterator<iter::models::forward_iterator>
+>);
+static_assert(iter::input_iterator<
+    counted_iterator<iter::models::input_iterator>
+>);
+static_assert(iter::input_or_output_iterator<
+    counted_iterator<iter::models::output_iterator>
+>);
+
+// The distance to the end is known in constant time whatever the underlying
+// iterator.
+static_assert(iter::sized_sentinel_for<
+    default_sentinel_t,
+    counted_iterator<std::forward_list<int>::iterator>
+>);
+static_assert(iter::sized_sentinel_for<
+    counted_iterator<std::list<int>::iterator>,
+    counted_iterator<std::list<int>::iterator>
+>);
+
+static_assert(std::is_same_v<
+    counted_iterator<std::list<int>::iterator>::value_type,
+    int
+>);
+static_assert(std::is_same_v<
+    counted_iterator<std::list<int>::iterator>::iterator_category,
+    iter::bidirectional_iterator_tag
+>);
+static_assert(std::totally_ordered_with<
+    counted_iterator<int*>,
+    counted_iterator<int const*>
+>);
+static_assert(iter::sized_sentinel_for<
+    counted_iterator<int const*>,
+    counted_iterator<int*>
+>);
+static_assert(sizeof(counted_iterator<int*>) == 2u * sizeof(void*));
+
+constexpr int sum_first (int n) {
+    int values[] = {1, 2, 3, 4};
+    int sum = 0;
+    for (counted_iterator it{values + 0, n}; it != default_sentinel; ++it) {
+        sum += *it;
+    }
+    return sum;
+}
+static_assert(sum_first(3) == 6);
+static_assert(sum_first(0) == 0);
+}  // namespace
+
+SCENARIO (
+    "exfs::iterator::counted_iterator",
+    "[unit][iterator]"
+) {
+    GIVEN ("a counted iterator over a prefix of a list") {
+        std::list<int> values{1, 2, 3, 4, 5};
+        counted_iterator it{values.begin(), 3};
+
+        THEN ("it dereferences to the underlying element") {
+            CHECK(*it == 1);
+            CHECK(it.base() == values.begin());
+            CHECK(it.count() == 3);
+            CHECK(default_sentinel - it == 3);
+            CHECK(it - default_sentinel == -3);
+        }
+
+        WHEN ("it is incremented") {
+            auto const first = it;
+            auto const old = it++;
+            ++it;
+
+            THEN ("the count decreases") {
+                CHECK(*it == 3);
+                CHECK(it.count() == 1);
+                CHECK(*old == 1);
+                CHECK(it - first == 2);
+                CHECK(first < it);
+                CHECK(it != default_sentinel);
+            }
+
+            THEN ("it reaches the end after the counted elements") {
+                ++it;
+                CHECK(it == default_sentinel);
+                CHECK(*it.base() == 4);
+            }
+
+            THEN ("it can be decremented back") {
+                --it;
+                CHECK(it.count() == 2);
+                CHECK(*it-- == 2);
+                CHECK(it == first);
+            }
+        }
+    }
+
+    GIVEN ("a counted iterator over an array") {
+        int values[] = {1, 2, 3, 4, 5};
+        counted_iterator it{values + 1, 3};
+
+        THEN ("it supports random access") {
+            CHECK(it[2] == 4);
+            CHECK((it + 2).count() == 1);
+            CHECK((2 + it).base() == values + 3);
+            CHECK(it.operator->() == values + 1);
+
+            it += 3;
+            CHECK(it == default_sentinel);
+            it -= 1;
+            CHECK(*it == 4);
+            CHECK((it - 1).count() == 2);
+        }
+
+        WHEN ("a const counted iterator is converted from it") {
+            counted_iterator<int const*> const const_it = it;
+
+            THEN ("it refers to the same position") {
+                CHECK(const_it.base() == values + 1);
+                CHECK(const_it.count() == 3);
+            }
+        }
+
+        WHEN ("it is compared with a const counted iterator") {
+            counted_iterator<int const*> const const_it{values + 3, 1};
+
+            THEN ("they compare and subtract by their counts") {
+                CHECK(it != const_it);
+                CHECK(it + 2 == const_it);
+                CHECK(const_it == it + 2);
+                CHECK(it < const_it);
+                CHECK(const_it > it);
+                CHECK(const_it - it == 2);
+                CHECK(it - const_it == -2);
+            }
+        }
+    }
+
+    GIVEN ("counted iterators over strings") {
+        std::vector<std::string> values{"one", "two"};
+        counted_iterator a{values.begin(), 2};
+        counted_iterator b{values.begin() + 1, 1};
+
+        WHEN ("an element is moved out") {
+            std::string moved = iter::iter_move(a);
+
+            THEN ("the underlying iterator is moved from") {
+                CHECK(moved == "one");
+                CHECK(values[0].empty());
+            }
+        }
+
+        WHEN ("the elements are swapped") {
+            iter::iter_swap(a, b);
+
+            THEN ("the underlying elements are exchanged") {
+                CHECK(values[0] == "two");
+                CHECK(values[1] == "one");
+            }
+        }
+    }
+}
@@ -86,6 +86,132 @@ inline namespace __cust {
  */
 inline constexpr __cust_iter_move::__iter_move_fn iter_move{};
 }  // inline namespace __cust
+
+namespace __cust_iter_swap {
+// Base cases for ADL. Should never actually be called. The deleted swap()
+// hides exfs::swap() so that only swap() overloads found by ADL are detected,
+// and makes an unconstrained std::swap() ambiguous.
+template <typename I_1, typename I_2>
+void iter_swap (I_1, I_2) = delete;
+
+template <typename T>
+void swap (T&, T&) = delete;
+
+template <typename T, typename U>
+concept __adl_iter_swap = (
+    __cust_iter_move::__class_or_enum<std::remove_reference_t<T>> or
+    __cust_iter_move::__class_or_enum<std::remove_reference_t<U>>
+) and requires (T&& t, U&& u) {
+    iter_swap(static_cast<T&&>(t), static_cast<U&&>(u));
+};
+
+template <typename T, typename U>
+concept __adl_swap = (
+    __cust_iter_move::__class_or_enum<std::remove_reference_t<T>> or
+    __cust_iter_move::__class_or_enum<std::remove_reference_t<U>>
+) and requires (T&& t, U&& u) {
+    swap(static_cast<T&&>(t), static_cast<U&&>(u));
+};
+
+// The referenced objects can be swapped directly, either by a swap() found
+// by ADL (which is how proxy references customize swapping) or, when both are
+// lvalues of the same type, by exfs::swap().
+template <typename T, typename U>
+concept __swappable_references =
+    dereferenceable<T> and
+    dereferenceable<U> and (
+        __adl_swap<decltype(*declval<T>()), decltype(*declval<U>())> or
+        requires (T&& t, U&& u) {
+            exfs::swap(*static_cast<T&&>(t), *static_cast<U&&>(u));
+        }
+    );
+
+// The referenced objects can be exchanged through a temporary by moving them
+// out with iter_move().
+template <typename T, typename U>
+concept __exchangeable_references = requires (T&& t, U&& u) {
+    typename std::remove_cvref_t<decltype(iter_move(static_cast<T&&>(t)))>;
+    requires std::is_constructible_v<
+        std::remove_cvref_t<decltype(iter_move(static_cast<T&&>(t)))>,
+        decltype(iter_move(static_cast<T&&>(t)))
+    >;
+    *static_cast<T&&>(t) = iter_move(static_cast<U&&>(u));
+    *static_cast<U&&>(u) = declval<
+        std::remove_cvref_t<decltype(iter_move(static_cast<T&&>(t)))>
+    >();
+};
+
+struct __iter_swap_fn {
+  private:
+    template <typename T, typename U>
+    static constexpr void __swap_references (T&& t, U&& u) {
+        if constexpr (
+            __adl_swap<decltype(*declval<T>()), decltype(*declval<U>())>
+        ) {
+            swap(*static_cast<T&&>(t), *static_cast<U&&>(u));
+        } else {
+            exfs::swap(*static_cast<T&&>(t), *static_cast<U&&>(u));
+        }
+    }
+
+    template <typename T, typename U>
+    static constexpr bool __is_noexcept () {
+        if constexpr (__adl_iter_swap<T, U>) {
+            return noexcept(iter_swap(declval<T>(), declval<U>()));
+        } else if constexpr (__swappable_references<T, U>) {
+            if constexpr (
+                __adl_swap<decltype(*declval<T>()), decltype(*declval<U>())>
+            ) {
+                return noexcept(swap(*declval<T>(), *declval<U>()));
+            } else {
+                return noexcept(exfs::swap(*declval<T>(), *declval<U>()));
+            }
+        } else {
+            using value_type = std::remove_cvref_t<
+                decltype(iter_move(declval<T>()))
+            >;
+            return
+                noexcept(value_type(iter_move(declval<T>()))) and
+                noexcept(*declval<T>() = iter_move(declval<U>())) and
+                noexcept(*declval<U>() = declval<value_type>());
+        }
+    }
+
+  public:
+    template <typename T, typename U>
+    requires (
+        __adl_iter_swap<T, U> or
+        __swappable_references<T, U> or
+        __exchangeable_references<T, U>
+    )
+    constexpr void operator () (T&& t, U&& u) const
+        noexcept(__is_noexcept<T, U>())
+    {
+        if constexpr (__adl_iter_swap<T, U>) {
+            (void)iter_swap(static_cast<T&&>(t), static_cast<U&&>(u));
+        } else if constexpr (__swappable_references<T, U>) {
+            __swap_references(static_cast<T&&>(t), static_cast<U&&>(u));
+        } else {
+            std::remove_cvref_t<decltype(iter_move(static_cast<T&&>(t)))>
+                tmp(iter_move(static_cast<T&&>(t)));
+            *static_cast<T&&>(t) = iter_move(static_cast<U&&>(u));
+            *static_cast<U&&>(u) = exfs::move(tmp);
+        }
+    }
+};
+}  // namespace __cust_iter_swap
+
+inline namespace __cust {
+/**
+ * Swaps the objects referenced by two iterators, which may have different
+ * types and may be proxy iterators.
+ *
+ * This is a customization point object. An @c iter_swap found by ADL is
+ * preferred, then a @c swap of the referenced objects, and finally an
+ * exchange through a temporary using @c iter_move.
+ */
+inline constexpr __cust_iter_swap::__iter_swap_fn iter_swap{};
+}  // inline namespace __cust
 }  // namespace exfs::iterator
 
 #endif  // EXFS_ITERATOR_ITER_MOVE_HPP_
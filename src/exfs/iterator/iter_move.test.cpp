@@ -0,0 +1,147 @@
+#include "exfs/iterator/iter_move.hpp"
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+namespace iter = exfs::iterator;
+
+namespace test {
+// An iterator whose reference is a proxy, which swaps the referenced object
+// through a hidden friend swap().
+struct Proxy {
+    int* target;
+
+    friend constexpr void swap (Proxy a, Proxy b) noexcept {
+        int tmp = *a.target;
+        *a.target = *b.target;
+        *b.target = tmp;
+    }
+};
+
+struct Proxy_Iterator {
+    int* ptr;
+
+    constexpr Proxy operator * () const { return Proxy{ptr}; }
+};
+
+// An iterator which customizes iter_swap() and counts the calls.
+struct Counting_Iterator {
+    int* ptr;
+    int* swaps;
+
+    constexpr int& operator * () const { return *ptr; }
+
+    friend constexpr void iter_swap (
+        Counting_Iterator a,
+        Counting_Iterator b
+    ) {
+        ++*a.swaps;
+        int tmp = *a.ptr;
+        *a.ptr = *b.ptr;
+        *b.ptr = tmp;
+    }
+};
+}  // namespace test
+
+static_assert(noexcept(iter::iter_swap(
+    std::declval<int*>(),
+    std::declval<int*>()
+)));
+static_assert(std::is_invocable_v<decltype(iter::iter_swap), int*, long*>);
+static_assert(not std::is_invocable_v<
+    decltype(iter::iter_swap),
+    int const*,
+    int*
+>);
+
+constexpr bool swaps_in_constant_evaluation () {
+    int values[] = {1, 2};
+    iter::iter_swap(values + 0, values + 1);
+    return values[0] == 2 and values[1] == 1;
+}
+static_assert(swaps_in_constant_evaluation());
+}  // namespace
+
+SCENARIO (
+    "exfs::iterator::iter_swap",
+    "[unit][iterator]"
+) {
+    GIVEN ("pointers to strings") {
+        std::string a = "first";
+        std::string b = "second";
+
+        WHEN ("they are swapped") {
+            iter::iter_swap(&a, &b);
+
+            THEN ("the strings are exchanged") {
+                CHECK(a == "second");
+                CHECK(b == "first");
+            }
+        }
+    }
+
+    GIVEN ("pointers to different types") {
+        int i = 1;
+        long l = 2;
+
+        WHEN ("they are swapped") {
+            iter::iter_swap(&i, &l);
+
+            THEN ("the values are exchanged through a temporary") {
+                CHECK(i == 2);
+                CHECK(l == 1l);
+            }
+        }
+    }
+
+    GIVEN ("iterators with proxy references") {
+        int a = 1;
+        int b = 2;
+
+        WHEN ("they are swapped") {
+            iter::iter_swap(test::Proxy_Iterator{&a}, test::Proxy_Iterator{&b});
+
+            THEN ("the proxy swap() is used") {
+                CHECK(a == 2);
+                CHECK(b == 1);
+            }
+        }
+    }
+
+    GIVEN ("iterators which customize iter_swap()") {
+        int a = 1;
+        int b = 2;
+        int swaps = 0;
+
+        WHEN ("they are swapped") {
+            iter::iter_swap(
+                test::Counting_Iterator{&a, &swaps},
+                test::Counting_Iterator{&b, &swaps}
+            );
+
+            THEN ("the customization is used") {
+                CHECK(swaps == 1);
+                CHECK(a == 2);
+                CHECK(b == 1);
+            }
+        }
+    }
+
+    GIVEN ("vector iterators") {
+        std::vector<std::vector<int>> values{{1}, {2, 3}};
+
+        WHEN ("they are swapped") {
+            iter::iter_swap(values.begin(), values.begin() + 1);
+
+            THEN ("the elements are exchanged") {
+                CHECK(values[0] == std::vector<int>{2, 3});
+                CHECK(values[1] == std::vector<int>{1});
+            }
+        }
+    }
+}
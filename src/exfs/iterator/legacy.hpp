@@ -203,6 +203,16 @@ concept __has_most_iter_trait_members = requires {
     typename Iter::iterator_category;
 };
 
+// The negation of __has_most_iter_trait_members, as a concept of its own so
+// that it is the same atomic constraint in each specialization below. That
+// lets the specialization for input iterators subsume the one for other
+// legacy iterators, and lets both be rejected by this cheap check before the
+// legacy iterator concepts are evaluated for iterators which declare their
+// member types.
+template <typename Iter>
+concept __lacks_most_iter_trait_members =
+    not __has_most_iter_trait_members<Iter>;
+
 /**
  * Specialization of @c __iter_traits for when @p Iter defines all expected
  * member types.
@@ -248,8 +258,11 @@ struct __safe_iter_ptr<Iter> {
     using type = exfs::iterator::iter_pointer_t<Iter>;
 };
 
-template <legacy_input_iterator Iter>
-requires (not __has_most_iter_trait_members<Iter>)
+template <typename Iter>
+requires (
+    __lacks_most_iter_trait_members<Iter> and
+    legacy_input_iterator<Iter>
+)
 struct __iter_traits<Iter> {
     using difference_type   = typename incrementable_traits<Iter>::difference_type;
     using value_type        = typename indirectly_readable_traits<Iter>::value_type;
@@ -269,8 +282,8 @@ struct __safe_iter_diff<T> {
     using type = typename incrementable_traits<T>::difference_type;
 };
 
-template <legacy_iterator Iter>
-requires (not __has_most_iter_trait_members<Iter>)
+template <typename Iter>
+requires (__lacks_most_iter_trait_members<Iter> and legacy_iterator<Iter>)
 struct __iter_traits<Iter> {
     using difference_type   = typename __safe_iter_diff<Iter>::type;
     using value_type        = void;
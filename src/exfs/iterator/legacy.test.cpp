@@ -356,6 +356,37 @@ TEMPLATE_TEST_CASE (
     #undef DO_CHECK
 }
 
+// A C++20 iterator which declares none of the legacy reference, pointer and
+// iterator_category member types, but still models the legacy iterator
+// requirements.
+struct Iter_Without_Members {
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = long;
+
+    long& operator * () const;
+    Iter_Without_Members& operator ++ ();
+    Iter_Without_Members operator ++ (int);
+
+    bool operator == (Iter_Without_Members const&) const = default;
+};
+
+TEST_CASE (
+    "exfs::iterator::iterator_traits - no legacy members",
+    "[unit][std-parity][iterator]"
+) {
+    using traits = exfs::iterator::iterator_traits<Iter_Without_Members>;
+
+    CHECK(std::is_same_v<traits::difference_type, std::ptrdiff_t>);
+    CHECK(std::is_same_v<traits::value_type, long>);
+    CHECK(std::is_same_v<traits::pointer, void>);
+    CHECK(std::is_same_v<traits::reference, long&>);
+    CHECK(std::is_same_v<
+        traits::iterator_category,
+        exfs::iterator::forward_iterator_tag
+    >);
+}
+
 // TODO: Test different iterator categories with iterator_traits.
 
 TEST_CASE (
@@ -4,6 +4,7 @@
 #include <cstddef>
 
 #include <compare>
+#include <concepts>
 
 #include "exfs/iterator/category_tags.hpp"
 #include "exfs/iterator/concepts.hpp"
@@ -95,14 +96,215 @@ struct bidirectional_iterator
       : __detail::__bidir_iter<bidirectional_iterator> {};
 struct random_access_iterator
       : __detail::__rand_acc_iter<random_access_iterator> {};
+
+/**
+ * The number of operations applied to a @c counting_iterator and to the
+ * iterators copied from it.
+ */
+struct Operation_Counts {
+    int increments = 0;
+    int decrements = 0;
+    int jumps = 0;
+    int subtractions = 0;
+};
+
+/**
+ * An iterator over an array of @c int which records the operations applied to
+ * it, with the iterator concept given by @p Tag. This tells whether an
+ * algorithm steps through a range or jumps over it.
+ */
+template <typename Tag>
+class counting_iterator {
+  public:
+    using iterator_concept  = Tag;
+    using iterator_category = Tag;
+    using value_type        = int;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = int&;
+
+    counting_iterator () = default;
+
+    constexpr counting_iterator (int* ptr, Operation_Counts* counts)
+          : ptr_{ptr},
+            counts_{counts} {}
+
+    constexpr int* base () const { return ptr_; }
+    constexpr Operation_Counts* counts () const { return counts_; }
+
+    constexpr int& operator * () const { return *ptr_; }
+
+    constexpr counting_iterator& operator ++ () {
+        ++counts_->increments;
+        ++ptr_;
+        return *this;
+    }
+
+    constexpr counting_iterator operator ++ (int) {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    constexpr counting_iterator& operator -- ()
+    requires std::derived_from<Tag, bidirectional_iterator_tag> {
+        ++counts_->decrements;
+        --ptr_;
+        return *this;
+    }
+
+    constexpr counting_iterator operator -- (int)
+    requires std::derived_from<Tag, bidirectional_iterator_tag> {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    constexpr counting_iterator& operator += (difference_type n)
+    requires std::derived_from<Tag, random_access_iterator_tag> {
+        ++counts_->jumps;
+        ptr_ += n;
+        return *this;
+    }
+
+    constexpr counting_iterator& operator -= (difference_type n)
+    requires std::derived_from<Tag, random_access_iterator_tag> {
+        return *this += -n;
+    }
+
+    friend constexpr counting_iterator operator + (
+        counting_iterator it,
+        difference_type n
+    ) requires std::derived_from<Tag, random_access_iterator_tag> {
+        return it += n;
+    }
+
+    friend constexpr counting_iterator operator + (
+        difference_type n,
+        counting_iterator it
+    ) requires std::derived_from<Tag, random_access_iterator_tag> {
+        return it += n;
+    }
+
+    friend constexpr counting_iterator operator - (
+        counting_iterator it,
+        difference_type n
+    ) requires std::derived_from<Tag, random_access_iterator_tag> {
+        return it -= n;
+    }
+
+    friend constexpr difference_type operator - (
+        counting_iterator const& a,
+        counting_iterator const& b
+    ) requires std::derived_from<Tag, random_access_iterator_tag> {
+        ++a.counts_->subtractions;
+        return a.ptr_ - b.ptr_;
+    }
+
+    constexpr int& operator [] (difference_type n) const
+    requires std::derived_from<Tag, random_access_iterator_tag> {
+        return ptr_[n];
+    }
+
+    friend constexpr bool operator == (
+        counting_iterator const& a,
+        counting_iterator const& b
+    ) {
+        return a.ptr_ == b.ptr_;
+    }
+
+    friend constexpr std::strong_ordering operator <=> (
+        counting_iterator const& a,
+        counting_iterator const& b
+    ) requires std::derived_from<Tag, random_access_iterator_tag> {
+        return a.ptr_ <=> b.ptr_;
+    }
+
+  private:
+    int* ptr_ = nullptr;
+    Operation_Counts* counts_ = nullptr;
+};
+
+/**
+ * A sentinel for @c counting_iterator. If @p is_sized, the distance from an
+ * iterator to it can be computed by subtraction, which is also recorded.
+ */
+template <bool is_sized>
+class counting_sentinel {
+  public:
+    counting_sentinel () = default;
+
+    constexpr explicit counting_sentinel (int* end) : end_{end} {}
+
+    template <typename Tag>
+    friend constexpr bool operator == (
+        counting_iterator<Tag> const& it,
+        counting_sentinel const& s
+    ) {
+        return it.base() == s.end_;
+    }
+
+    template <typename Tag>
+    friend constexpr std::ptrdiff_t operator - (
+        counting_sentinel const& s,
+        counting_iterator<Tag> const& it
+    ) requires is_sized {
+        ++it.counts()->subtractions;
+        return s.end_ - it.base();
+    }
+
+    template <typename Tag>
+    friend constexpr std::ptrdiff_t operator - (
+        counting_iterator<Tag> const& it,
+        counting_sentinel const& s
+    ) requires is_sized {
+        ++it.counts()->subtractions;
+        return it.base() - s.end_;
+    }
+
+  private:
+    int* end_ = nullptr;
+};
+
+/**
+ * A sentinel which can be subtracted from a @c counting_iterator, but opts
+ * out of @c sized_sentinel_for through @c disable_sized_sentinel_for.
+ */
+struct disabled_sized_sentinel : counting_sentinel<true> {
+    using counting_sentinel<true>::counting_sentinel;
+};
 }  // namespace models
 
+template <typename Tag>
+inline constexpr bool disable_sized_sentinel_for<
+    models::disabled_sized_sentinel,
+    models::counting_iterator<Tag>
+> = true;
+
 static_assert(input_or_output_iterator<models::input_or_output_iterator>);
 static_assert(input_iterator<models::input_iterator>);
 static_assert(output_iterator<models::output_iterator, models::Value>);
 static_assert(forward_iterator<models::forward_iterator>);
 static_assert(bidirectional_iterator<models::bidirectional_iterator>);
 static_assert(random_access_iterator<models::random_access_iterator>);
+
+static_assert(input_iterator<
+    models::counting_iterator<input_iterator_tag>
+>);
+static_assert(random_access_iterator<
+    models::counting_iterator<random_access_iterator_tag>
+>);
+static_assert(sized_sentinel_for<
+    models::counting_sentinel<true>,
+    models::counting_iterator<forward_iterator_tag>
+>);
+static_assert(not sized_sentinel_for<
+    models::counting_sentinel<false>,
+    models::counting_iterator<forward_iterator_tag>
+>);
+static_assert(not sized_sentinel_for<
+    models::disabled_sized_sentinel,
+    models::counting_iterator<forward_iterator_tag>
+>);
 }  // exfs::iterator
 
 #endif  // TESTS_EXFS_ITERATOR_MODEL_CONCEPTS_HPP_
@@ -0,0 +1,336 @@
+#ifndef EXFS_ITERATOR_MOVE_ITERATOR_HPP_
+#define EXFS_ITERATOR_MOVE_ITERATOR_HPP_
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/iterator/legacy.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::iterator {
+namespace __detail {
+// The iterator_category member of move_iterator, which is only present when
+// the underlying iterator is a legacy iterator.
+template <typename Iter>
+struct __move_iterator_category {};
+
+template <typename Iter>
+requires requires { typename iterator_category_t<Iter>; }
+struct __move_iterator_category<Iter> {
+    using iterator_category = std::conditional_t<
+        std::is_base_of_v<
+            random_access_iterator_tag,
+            iterator_category_t<Iter>
+        >,
+        random_access_iterator_tag,
+        iterator_category_t<Iter>
+    >;
+};
+}  // namespace __detail
+
+/**
+ * This class is an iterator adaptor that behaves exactly like the underlying
+ * iterator, except that dereferencing converts the value returned by the
+ * underlying iterator into an rvalue, through @c iter_move. Copying from a
+ * range of @c move_iterator therefore moves its elements instead.
+ *
+ * The algorithms and containers of this library recognize ranges of
+ * @c move_iterator over trivially copyable elements, for which moving is
+ * copying, and transfer them with the same memory builtins as plain copies.
+ *
+ * @tparam Iter The underlying iterator.
+ */
+template <input_iterator Iter>
+class move_iterator : public __detail::__move_iterator_category<Iter> {
+  public:
+    using iterator_type    = Iter;
+    using iterator_concept = std::conditional_t<
+        random_access_iterator<Iter>,
+        random_access_iterator_tag,
+        std::conditional_t<
+            bidirectional_iterator<Iter>,
+            bidirectional_iterator_tag,
+            std::conditional_t<
+                forward_iterator<Iter>,
+                forward_iterator_tag,
+                input_iterator_tag
+            >
+        >
+    >;
+    using value_type       = iter_value_t<Iter>;
+    using difference_type  = iter_difference_t<Iter>;
+    using pointer          = Iter;
+    using reference        = iter_rvalue_reference_t<Iter>;
+
+    /**
+     * Default constructor. The underlying iterator is value-initialized.
+     */
+    constexpr move_iterator () = default;
+
+    /**
+     * Constructs a @c move_iterator wrapping @p iter.
+     *
+     * @param[in] iter The underlying iterator to adapt.
+     */
+    constexpr explicit move_iterator (Iter iter)
+          : current_{exfs::move(iter)} {}
+
+    /**
+     * Constructs a @c move_iterator wrapping a converted copy of the
+     * underlying iterator of @p other.
+     *
+     * @param[in] other Iterator to convert and adapt.
+     */
+    template <typename Other>
+    requires (
+        not std::is_same_v<Other, Iter> and
+        std::convertible_to<Other const&, Iter>
+    )
+    constexpr move_iterator (move_iterator<Other> const& other)
+          : current_{other.base()} {}
+
+    /**
+     * Assigns the underlying iterator from that of @p other.
+     *
+     * @param[in] other The iterator adaptor to assign from.
+     */
+    template <typename Other>
+    requires (
+        not std::is_same_v<Other, Iter> and
+        std::convertible_to<Other const&, Iter> and
+        std::assignable_from<Iter&, Other const&>
+    )
+    constexpr move_iterator& operator = (move_iterator<Other> const& other) {
+        current_ = other.base();
+        return *this;
+    }
+
+    /**
+     * Returns the underlying iterator.
+     */
+    constexpr Iter const& base () const& noexcept { return current_; }
+
+    /**
+     * @overload base()
+     */
+    constexpr Iter base () && { return exfs::move(current_); }
+
+    /**
+     * Returns an rvalue reference to the current element, or the value
+     * returned by a customized @c iter_move of the underlying iterator.
+     */
+    constexpr reference operator * () const {
+        return iterator::iter_move(current_);
+    }
+
+    /**
+     * Returns an rvalue reference to the element at the specified relative
+     * location.
+     */
+    constexpr reference operator [] (difference_type idx) const
+    requires random_access_iterator<Iter> {
+        return iterator::iter_move(current_ + idx);
+    }
+
+    constexpr move_iterator& operator ++ () {
+        ++current_;
+        return *this;
+    }
+
+    /**
+     * Post-increments the iterator by one. Single-pass iterators are not
+     * copied.
+     */
+    constexpr auto operator ++ (int) {
+        if constexpr (forward_iterator<Iter>) {
+            auto tmp = *this;
+            ++current_;
+            return tmp;
+        } else {
+            ++current_;
+        }
+    }
+
+    constexpr move_iterator& operator -- ()
+    requires bidirectional_iterator<Iter> {
+        --current_;
+        return *this;
+    }
+
+    constexpr move_iterator operator -- (int)
+    requires bidirectional_iterator<Iter> {
+        auto tmp = *this;
+        --current_;
+        return tmp;
+    }
+
+    constexpr move_iterator& operator += (difference_type dist)
+    requires random_access_iterator<Iter> {
+        current_ += dist;
+        return *this;
+    }
+
+    constexpr move_iterator& operator -= (difference_type dist)
+    requires random_access_iterator<Iter> {
+        current_ -= dist;
+        return *this;
+    }
+
+    friend constexpr move_iterator operator + (
+        move_iterator const& it,
+        difference_type dist
+    ) requires random_access_iterator<Iter> {
+        return move_iterator{it.current_ + dist};
+    }
+
+    friend constexpr move_iterator operator + (
+        difference_type dist,
+        move_iterator const& it
+    ) requires random_access_iterator<Iter> {
+        return move_iterator{it.current_ + dist};
+    }
+
+    friend constexpr move_iterator operator - (
+        move_iterator const& it,
+        difference_type dist
+    ) requires random_access_iterator<Iter> {
+        return move_iterator{it.current_ - dist};
+    }
+
+    friend constexpr difference_type operator - (
+        move_iterator const& lhs,
+        move_iterator const& rhs
+    ) requires sized_sentinel_for<Iter, Iter> {
+        return lhs.current_ - rhs.current_;
+    }
+
+    friend constexpr bool operator == (
+        move_iterator const& lhs,
+        move_iterator const& rhs
+    ) requires std::equality_comparable<Iter> {
+        return lhs.current_ == rhs.current_;
+    }
+
+    friend constexpr auto operator <=> (
+        move_iterator const& lhs,
+        move_iterator const& rhs
+    ) requires std::three_way_comparable<Iter> {
+        return lhs.current_ <=> rhs.current_;
+    }
+
+    friend constexpr reference iter_move (move_iterator const& it)
+    noexcept(noexcept(iterator::iter_move(it.current_))) {
+        return iterator::iter_move(it.current_);
+    }
+
+    template <typename Other>
+    friend constexpr void iter_swap (
+        move_iterator const& lhs,
+        move_iterator<Other> const& rhs
+    ) noexcept(noexcept(iterator::iter_swap(lhs.current_, rhs.base())))
+    requires requires { iterator::iter_swap(lhs.current_, rhs.base()); } {
+        iterator::iter_swap(lhs.current_, rhs.base());
+    }
+
+  private:
+    Iter current_{};
+};
+
+template <typename Iter>
+move_iterator (Iter) -> move_iterator<Iter>;
+
+/**
+ * Creates a @c move_iterator wrapping @p iter, deducing its type.
+ */
+template <input_iterator Iter>
+constexpr move_iterator<Iter> make_move_iterator (Iter iter) {
+    return move_iterator<Iter>{exfs::move(iter)};
+}
+
+/**
+ * A sentinel adaptor for the end of a range of @c move_iterator, for ranges
+ * whose sentinel type differs from their iterator type.
+ *
+ * @tparam S The underlying sentinel.
+ */
+template <std::semiregular S>
+class move_sentinel {
+  public:
+    /**
+     * Default constructor. The underlying sentinel is value-initialized.
+     */
+    constexpr move_sentinel () = default;
+
+    /**
+     * Constructs a @c move_sentinel wrapping @p sentinel.
+     */
+    constexpr explicit move_sentinel (S sentinel)
+          : last_{exfs::move(sentinel)} {}
+
+    /**
+     * Constructs a @c move_sentinel wrapping a converted copy of the
+     * underlying sentinel of @p other.
+     */
+    template <typename Other>
+    requires (
+        not std::is_same_v<Other, S> and
+        std::convertible_to<Other const&, S>
+    )
+    constexpr move_sentinel (move_sentinel<Other> const& other)
+          : last_{other.base()} {}
+
+    /**
+     * Returns the underlying sentinel.
+     */
+    constexpr S base () const { return last_; }
+
+    template <typename Iter>
+    requires sentinel_for<S, Iter>
+    friend constexpr bool operator == (
+        move_iterator<Iter> const& it,
+        move_sentinel const& s
+    ) {
+        return it.base() == s.last_;
+    }
+
+    template <typename Iter>
+    requires sized_sentinel_for<S, Iter>
+    friend constexpr iter_difference_t<Iter> operator - (
+        move_sentinel const& s,
+        move_iterator<Iter> const& it
+    ) {
+        return s.last_ - it.base();
+    }
+
+    template <typename Iter>
+    requires sized_sentinel_for<S, Iter>
+    friend constexpr iter_difference_t<Iter> operator - (
+        move_iterator<Iter> const& it,
+        move_sentinel const& s
+    ) {
+        return it.base() - s.last_;
+    }
+
+  private:
+    S last_{};
+};
+
+/**
+ * This partial specialization of @c sized_sentinel_for prevents specializations
+ * of @c move_iterator from satisfying @c sized_sentinel_for if their
+ * underlying iterators do not satisfy the concept.
+ */
+template <typename Iter_1, typename Iter_2>
+requires (not sized_sentinel_for<Iter_1, Iter_2>)
+inline constexpr bool disable_sized_sentinel_for<
+    move_iterator<Iter_1>,
+    move_iterator<Iter_2>
+> = true;
+}  // namespace exfs::iterator
+
+#endif  // EXFS_ITERATOR_MOVE_ITERATOR_HPP_
@@ -0,0 +1,154 @@
+#include "exfs/iterator/move_iterator.hpp"
+
+#include <forward_list>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/counted_iterator.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/iterator/sentinels.hpp"
+
+#include "models.hpp"
+
+namespace {
+namespace iter = exfs::iterator;
+
+using iter::move_iterator;
+using iter::move_sentinel;
+
+// Elements are read as rvalues, so a move_iterator is never contiguous.
+static_assert(iter::random_access_iterator<move_iterator<int*>>);
+static_assert(not iter::contiguous_iterator<move_iterator<int*>>);
+static_assert(iter::bidirectional_iterator<
+    move_iterator<std::list<int>::iterator>
+>);
+static_assert(iter::forward_iterator<
+    move_iterator<std::forward_list<int>::iterator>
+>);
+static_assert(iter::input_iterator<
+    move_iterator<iter::models::input_iterator>
+>);
+static_assert(not iter::forward_iterator<
+    move_iterator<iter::models::input_iterator>
+>);
+
+static_assert(std::is_same_v<
+    iter::iter_reference_t<move_iterator<std::string*>>,
+    std::string&&
+>);
+static_assert(std::is_same_v<
+    iter::iter_reference_t<move_iterator<std::string const*>>,
+    std::string const&&
+>);
+static_assert(std::is_same_v<
+    move_iterator<std::list<int>::iterator>::iterator_category,
+    iter::bidirectional_iterator_tag
+>);
+
+static_assert(iter::sized_sentinel_for<
+    move_iterator<int*>,
+    move_iterator<int*>
+>);
+static_assert(not iter::sized_sentinel_for<
+    move_iterator<std::list<int>::iterator>,
+    move_iterator<std::list<int>::iterator>
+>);
+static_assert(iter::sized_sentinel_for<
+    move_sentinel<iter::default_sentinel_t>,
+    move_iterator<iter::counted_iterator<std::list<int>::iterator>>
+>);
+}  // namespace
+
+SCENARIO (
+    "exfs::iterator::move_iterator",
+    "[unit][iterator]"
+) {
+    GIVEN ("a vector of strings") {
+        std::vector<std::string> values{"one", "two", "three"};
+
+        WHEN ("its elements are read through a move_iterator") {
+            auto it = iter::make_move_iterator(values.begin());
+            std::string moved = *it;
+            std::string moved_again = it[2];
+
+            THEN ("they are moved from") {
+                CHECK(moved == "one");
+                CHECK(moved_again == "three");
+                CHECK(values[0].empty());
+                CHECK(values[2].empty());
+                CHECK(values[1] == "two");
+            }
+        }
+
+        WHEN ("a vector is constructed from a range of move_iterator") {
+            std::vector<std::string> dest(
+                move_iterator{values.begin()},
+                move_iterator{values.end()}
+            );
+
+            THEN ("the elements are transferred") {
+                CHECK(dest == std::vector<std::string>{"one", "two", "three"});
+                CHECK(values[1].empty());
+            }
+        }
+
+        THEN ("the iterators move like the underlying iterators") {
+            move_iterator first{values.begin()};
+            move_iterator const last{values.end()};
+
+            CHECK(last - first == 3);
+            CHECK((first + 2).base() == values.begin() + 2);
+            CHECK((1 + first).base() == values.begin() + 1);
+            CHECK(first < last);
+            CHECK(first++ == move_iterator{values.begin()});
+            CHECK(first.base() == values.begin() + 1);
+            --first;
+            first += 3;
+            CHECK(first == last);
+            first -= 1;
+            CHECK((first - 1).base() == values.begin() + 1);
+        }
+
+        WHEN ("the elements are swapped through move iterators") {
+            iter::iter_swap(
+                move_iterator{values.begin()},
+                move_iterator{values.begin() + 2}
+            );
+
+            THEN ("the underlying elements are exchanged") {
+                CHECK(values[0] == "three");
+                CHECK(values[2] == "one");
+            }
+        }
+    }
+
+    GIVEN ("a counted range over a list") {
+        std::list<std::string> values{"a", "b", "c"};
+        move_iterator first{iter::counted_iterator{values.begin(), 2}};
+        move_sentinel const last{iter::default_sentinel};
+
+        WHEN ("it is iterated to a move_sentinel") {
+            std::vector<std::string> moved;
+            for (; first != last; ++first) {
+                moved.push_back(*first);
+            }
+
+            THEN ("the counted elements are moved") {
+                CHECK(moved == std::vector<std::string>{"a", "b"});
+                CHECK(values.front().empty());
+                CHECK(values.back() == "c");
+            }
+        }
+
+        THEN ("the distance to the sentinel is known") {
+            CHECK(last - first == 2);
+            CHECK(first - last == -2);
+        }
+    }
+}
@@ -0,0 +1,20 @@
+// Probes of the code generated for exfs::iterator::reverse_iterator, checked
+// by the assembly test (see tools/check_assembly.py).
+#include "exfs/iterator/reverse_iterator.hpp"
+
+namespace {
+using Reverse_Iterator = exfs::iterator::reverse_iterator<int const*>;
+}  // namespace
+
+extern "C" {
+// Dereferencing is a single load before the underlying pointer.
+// ASSEMBLY probe_reverse_iterator_dereference: instructions=1 loads=1 calls=0
+int probe_reverse_iterator_dereference (int const* ptr) {
+    return *Reverse_Iterator{ptr};
+}
+
+// ASSEMBLY probe_reverse_iterator_subscript: instructions=1 loads=1 calls=0
+int probe_reverse_iterator_subscript (int const* ptr) {
+    return Reverse_Iterator{ptr}[2];
+}
+}
@@ -0,0 +1,99 @@
+#include "exfs/iterator/reverse_iterator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+// A backward traversal summing the elements, through an exfs reverse
+// iterator, through std::reverse_iterator and through a hand-written
+// decrementing loop, which should all compile to the same code.
+std::vector<std::uint32_t> make_values (std::size_t size) {
+    std::vector<std::uint32_t> values(size);
+    std::iota(values.begin(), values.end(), 0u);
+    return values;
+}
+
+template <typename Iter>
+std::uint32_t sum (Iter first, Iter last) {
+    std::uint32_t total = 0u;
+    for (; first != last; ++first) {
+        total += *first;
+    }
+    return total;
+}
+
+void reverse_traversal_exfs (benchmark::State& state) {
+    auto const values = make_values(static_cast<std::size_t>(state.range(0)));
+    using iterator = exfs::iterator::reverse_iterator<std::uint32_t const*>;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(sum(
+            iterator{values.data() + values.size()},
+            iterator{values.data()}
+        ));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(reverse_traversal_exfs)->Arg(64)->Arg(4096);
+
+void reverse_traversal_std (benchmark::State& state) {
+    auto const values = make_values(static_cast<std::size_t>(state.range(0)));
+    using iterator = std::reverse_iterator<std::uint32_t const*>;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values.data());
+        benchmark::DoNotOptimize(sum(
+            iterator{values.data() + values.size()},
+            iterator{values.data()}
+        ));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(reverse_traversal_std)->Arg(64)->Arg(4096);
+
+void reverse_traversal_loop (benchmark::State& state) {
+    auto const values = make_values(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(values.data());
+        std::uint32_t total = 0u;
+        for (auto idx = values.size(); idx-- > 0u;) {
+            total += values[idx];
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(reverse_traversal_loop)->Arg(64)->Arg(4096);
+
+// Node-based traversal, where the reverse iterator decrements a copy of the
+// underlying iterator on each dereference.
+void reverse_traversal_list (benchmark::State& state) {
+    auto const values = make_values(static_cast<std::size_t>(state.range(0)));
+    std::list<std::uint32_t> const list(values.begin(), values.end());
+    using iterator = exfs::iterator::reverse_iterator<
+        std::list<std::uint32_t>::const_iterator
+    >;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(&list);
+        benchmark::DoNotOptimize(sum(
+            iterator{list.end()},
+            iterator{list.begin()}
+        ));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(reverse_traversal_list)->Arg(64)->Arg(4096);
+}  // namespace
@@ -188,7 +188,10 @@ class reverse_iterator {
      * @return A reference to the "current" element.
      */
     constexpr reference operator * () const {
-        return *exfs::iterator::prev(base_);
+        // Decrement a copy rather than use `prev()`, which requires a legacy
+        // iterator, so that iterators with proxy references are supported.
+        iterator_type tmp = base_;
+        return *--tmp;
     }
 
     /**
@@ -210,7 +213,8 @@ class reverse_iterator {
         if constexpr (std::is_pointer_v<iterator_type>) {
             return base_ - 1;
         } else {
-            return exfs::iterator::prev(base_).operator->();
+            iterator_type tmp = base_;
+            return (--tmp).operator->();
         }
     }
 
@@ -257,6 +261,32 @@ class reverse_iterator {
         return reverse_iterator{base_++};
     }
 
+    /**
+     * Advances the iterator by the given distance.
+     *
+     * The base iterator @p Iter must be a random access iterator.
+     *
+     * @param[in] dist The amount to advance it by.
+     */
+    constexpr reverse_iterator& operator += (difference_type dist)
+    requires (random_access_iterator<Iter>) {
+        base_ -= dist;
+        return *this;
+    }
+
+    /**
+     * Recedes the iterator by the given distance.
+     *
+     * The base iterator @p Iter must be a random access iterator.
+     *
+     * @param[in] dist The amount to recede it by.
+     */
+    constexpr reverse_iterator& operator -= (difference_type dist)
+    requires (random_access_iterator<Iter>) {
+        base_ += dist;
+        return *this;
+    }
+
     /**
      * Increments the iterator by the given distance.
      *
@@ -544,6 +544,26 @@ TEMPLATE_TEST_CASE (
                         CHECK(result.base() == rev_iter.base() + dist);
                     }
                 }
+
+                WHEN ("operator += (rev_iter, dist)") {
+                    auto result = rev_iter;
+                    auto& ref = (result += dist);
+
+                    THEN ("the iterator is `rev_iter.base() - dist`") {
+                        CHECK(&ref == &result);
+                        CHECK(result.base() == rev_iter.base() - dist);
+                    }
+                }
+
+                WHEN ("operator -= (rev_iter, dist)") {
+                    auto result = rev_iter;
+                    auto& ref = (result -= dist);
+
+                    THEN ("the iterator is `rev_iter.base() + dist`") {
+                        CHECK(&ref == &result);
+                        CHECK(result.base() == rev_iter.base() + dist);
+                    }
+                }
             }
 
             AND_GIVEN ("another reverse iterator before `rev_iter`") {
@@ -0,0 +1,47 @@
+#ifndef EXFS_ITERATOR_SENTINELS_HPP_
+#define EXFS_ITERATOR_SENTINELS_HPP_
+
+#include "exfs/iterator/concepts.hpp"
+
+namespace exfs::iterator {
+/**
+ * An empty sentinel type for iterators which know where their range ends,
+ * such as @c counted_iterator. Comparing such an iterator with
+ * @c default_sentinel tells whether it has reached the end.
+ */
+struct default_sentinel_t {};
+
+/**
+ * The @c default_sentinel_t value.
+ */
+inline constexpr default_sentinel_t default_sentinel{};
+
+/**
+ * A sentinel which never compares equal to any iterator, denoting an
+ * unbounded range.
+ *
+ * Searching from an iterator up to @c unreachable_sentinel skips the end
+ * check of every step, which is worthwhile when the element searched for is
+ * known to be present, e.g. because a sentinel value has been written at the
+ * end of the buffer.
+ *
+ * @warning It is undefined behavior to iterate past the end of the underlying
+ *     buffer: the comparison does not protect against it.
+ */
+struct unreachable_sentinel_t {
+    template <weakly_incrementable I>
+    friend constexpr bool operator == (
+        unreachable_sentinel_t,
+        I const&
+    ) noexcept {
+        return false;
+    }
+};
+
+/**
+ * The @c unreachable_sentinel_t value.
+ */
+inline constexpr unreachable_sentinel_t unreachable_sentinel{};
+}  // namespace exfs::iterator
+
+#endif  // EXFS_ITERATOR_SENTINELS_HPP_
@@ -0,0 +1,48 @@
+#include "exfs/iterator/sentinels.hpp"
+
+#include <list>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/concepts.hpp"
+
+namespace {
+namespace iter = exfs::iterator;
+
+static_assert(iter::sentinel_for<iter::unreachable_sentinel_t, int*>);
+static_assert(iter::sentinel_for<
+    iter::unreachable_sentinel_t,
+    std::list<int>::iterator
+>);
+static_assert(not iter::sized_sentinel_for<
+    iter::unreachable_sentinel_t,
+    int*
+>);
+static_assert(std::is_empty_v<iter::default_sentinel_t>);
+static_assert(std::is_empty_v<iter::unreachable_sentinel_t>);
+}  // namespace
+
+SCENARIO (
+    "exfs::iterator::unreachable_sentinel",
+    "[unit][iterator]"
+) {
+    GIVEN ("a buffer terminated by a known value") {
+        int const values[] = {3, 1, 4, 0};
+
+        WHEN ("it is searched up to an unreachable sentinel") {
+            int const* it = values;
+            while (it != iter::unreachable_sentinel and *it != 0) {
+                ++it;
+            }
+
+            THEN ("the search stops at the terminator") {
+                CHECK(it == values + 3);
+            }
+        }
+
+        THEN ("no iterator compares equal to the sentinel") {
+            CHECK(values + 4 != iter::unreachable_sentinel);
+            CHECK(not (iter::unreachable_sentinel == values + 0));
+        }
+    }
+}
@@ -0,0 +1,123 @@
+// Compile-time stress test of the iterator traits and concepts, compiled by
+// tools/compile_stress.py. It defines STRESS_COUNT distinct synthetic
+// iterator types of each of the kinds below, and instantiates for each of
+// them iterator_traits, the associated type aliases and the strongest
+// iterator concept it models, as a generic algorithm would. The time and
+// memory the compiler takes then grows with the per-type cost of the trait
+// machinery.
+#include <cstddef>
+#include <type_traits>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/legacy.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/utility/integer_sequence.hpp"
+
+#ifndef STRESS_COUNT
+#define STRESS_COUNT 100
+#endif
+
+namespace stress {
+using exfs::iterator::iterator_traits;
+
+// A legacy random access iterator which declares all five member types, like
+// the iterators of most containers.
+template <std::size_t N>
+struct Member_Iterator {
+    using difference_type = std::ptrdiff_t;
+    using value_type = int;
+    using pointer = int*;
+    using reference = int&;
+    using iterator_category = exfs::iterator::random_access_iterator_tag;
+
+    reference operator* () const;
+    pointer operator-> () const;
+    reference operator[] (difference_type) const;
+    Member_Iterator& operator++ ();
+    Member_Iterator operator++ (int);
+    Member_Iterator& operator-- ();
+    Member_Iterator operator-- (int);
+    Member_Iterator& operator+= (difference_type);
+    Member_Iterator& operator-= (difference_type);
+    Member_Iterator operator+ (difference_type) const;
+    Member_Iterator operator- (difference_type) const;
+    difference_type operator- (Member_Iterator const&) const;
+
+    friend Member_Iterator operator+ (difference_type n, Member_Iterator i) {
+        return i + n;
+    }
+
+    friend bool operator == (Member_Iterator, Member_Iterator) = default;
+    friend auto operator <=> (Member_Iterator, Member_Iterator) = default;
+};
+
+// A C++20 forward iterator, which declares its iterator_concept but none of
+// the legacy reference, pointer and iterator_category member types.
+template <std::size_t N>
+struct Concept_Iterator {
+    using iterator_concept = exfs::iterator::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = long;
+
+    long& operator* () const;
+    Concept_Iterator& operator++ ();
+    Concept_Iterator operator++ (int);
+
+    friend bool operator == (Concept_Iterator, Concept_Iterator) = default;
+};
+
+// An output iterator which declares no member types except difference_type,
+// like std::back_insert_iterator.
+template <std::size_t N>
+struct Output_Iterator {
+    using difference_type = std::ptrdiff_t;
+
+    Output_Iterator& operator* ();
+    Output_Iterator& operator= (int);
+    Output_Iterator& operator++ ();
+    Output_Iterator operator++ (int);
+};
+
+template <std::size_t N>
+constexpr bool check () {
+    using Member = Member_Iterator<N>;
+    using Concept = Concept_Iterator<N>;
+    using Output = Output_Iterator<N>;
+
+    static_assert(std::is_same_v<
+        typename iterator_traits<Member>::iterator_category,
+        exfs::iterator::random_access_iterator_tag
+    >);
+    static_assert(std::is_same_v<exfs::iterator::iter_value_t<Member>, int>);
+    static_assert(exfs::iterator::random_access_iterator<Member>);
+
+    static_assert(std::is_same_v<
+        typename iterator_traits<Concept>::iterator_category,
+        exfs::iterator::forward_iterator_tag
+    >);
+    static_assert(std::is_same_v<
+        exfs::iterator::iter_difference_t<Concept>,
+        std::ptrdiff_t
+    >);
+    static_assert(std::is_same_v<exfs::iterator::iter_value_t<Concept>, long>);
+    static_assert(exfs::iterator::forward_iterator<Concept>);
+    static_assert(not exfs::iterator::bidirectional_iterator<Concept>);
+
+    static_assert(std::is_same_v<
+        typename iterator_traits<Output>::iterator_category,
+        exfs::iterator::output_iterator_tag
+    >);
+    static_assert(exfs::iterator::output_iterator<Output, int>);
+    static_assert(not exfs::iterator::input_iterator<Output>);
+
+    return true;
+}
+
+template <std::size_t... Ns>
+constexpr bool check_all (exfs::index_sequence<Ns...>) {
+    return (check<Ns>() and ...);
+}
+
+static_assert(check_all(exfs::make_index_sequence<STRESS_COUNT>{}));
+}  // namespace stress
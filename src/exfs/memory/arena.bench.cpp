@@ -0,0 +1,86 @@
+#include "exfs/memory/arena.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+// Each simulated frame makes this many scratch allocations of varying sizes
+// and releases all of them at the end of the frame.
+constexpr std::size_t allocations_per_frame = 64u;
+
+constexpr std::size_t allocation_size (std::size_t idx) {
+    return 16u + (idx * 24u) % 512u;
+}
+
+void frame_malloc (benchmark::State& state) {
+    void* buffers[allocations_per_frame];
+
+    for (auto _ : state) {
+        for (std::size_t idx = 0u; idx < allocations_per_frame; ++idx) {
+            buffers[idx] = std::malloc(allocation_size(idx));
+            benchmark::DoNotOptimize(buffers[idx]);
+        }
+        for (std::size_t idx = 0u; idx < allocations_per_frame; ++idx) {
+            std::free(buffers[idx]);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * allocations_per_frame);
+}
+BENCHMARK(frame_malloc);
+
+void frame_arena (benchmark::State& state) {
+    alignas(std::max_align_t) static std::byte buffer[64u * 1024u];
+    exfs::memory::arena arena{buffer};
+
+    for (auto _ : state) {
+        for (std::size_t idx = 0u; idx < allocations_per_frame; ++idx) {
+            auto* const data = arena.allocate<std::byte>(allocation_size(idx));
+            benchmark::DoNotOptimize(data);
+        }
+        arena.reset();
+    }
+
+    state.SetItemsProcessed(state.iterations() * allocations_per_frame);
+}
+BENCHMARK(frame_arena);
+
+void frame_pmr_vector_default (benchmark::State& state) {
+    for (auto _ : state) {
+        for (std::size_t idx = 0u; idx < allocations_per_frame; ++idx) {
+            std::pmr::vector<int> vec(
+                allocation_size(idx) / sizeof(int),
+                std::pmr::get_default_resource()
+            );
+            benchmark::DoNotOptimize(vec.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * allocations_per_frame);
+}
+BENCHMARK(frame_pmr_vector_default);
+
+void frame_pmr_vector_arena (benchmark::State& state) {
+    alignas(std::max_align_t) static std::byte buffer[64u * 1024u];
+    exfs::memory::arena arena{buffer};
+    exfs::memory::arena_resource resource{arena};
+
+    for (auto _ : state) {
+        for (std::size_t idx = 0u; idx < allocations_per_frame; ++idx) {
+            std::pmr::vector<int> vec(
+                allocation_size(idx) / sizeof(int),
+                &resource
+            );
+            benchmark::DoNotOptimize(vec.data());
+        }
+        arena.reset();
+    }
+
+    state.SetItemsProcessed(state.iterations() * allocations_per_frame);
+}
+BENCHMARK(frame_pmr_vector_arena);
+}  // namespace
@@ -0,0 +1,319 @@
+#ifndef EXFS_MEMORY_ARENA_HPP_
+#define EXFS_MEMORY_ARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <type_traits>
+
+#if __STDC_HOSTED__
+#include <memory_resource>
+#include <new>
+#endif  // __STDC_HOSTED__
+
+#include "exfs/memory/storage.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::memory {
+/**
+ * A monotonic (bump-pointer) allocator over a caller-provided block of memory.
+ *
+ * Allocation advances a single offset into the buffer, padding it as needed to
+ * satisfy the alignment of the requested type. Individual allocations are
+ * never freed; instead the whole arena is released at once with @c reset(),
+ * or partially with @c rollback() to a previously taken @c checkpoint(). Both
+ * are constant time operations.
+ *
+ * This is intended for short-lived scratch memory, such as buffers that live
+ * for the duration of a single frame of processing, where the cost of a
+ * general purpose heap is undesirable.
+ *
+ * @warning The arena does not track the objects created in it and never calls
+ *     their destructors. Objects which are not trivially destructible must be
+ *     destroyed explicitly before the memory they occupy is released.
+ *
+ * @warning The arena does not own the buffer. The buffer must outlive the
+ *     arena and every allocation made from it.
+ */
+class arena {
+  public:
+    using size_type = std::size_t;
+
+    /**
+     * An opaque position in the arena which can later be returned to with @c
+     * rollback().
+     */
+    class marker {
+      public:
+        friend constexpr bool operator == (marker, marker) = default;
+
+      private:
+        friend class arena;
+
+        constexpr explicit marker (size_type offset) : offset_{offset} {}
+
+        size_type offset_;
+    };
+
+    /**
+     * RAII helper which takes a checkpoint of an arena on construction and
+     * rolls the arena back to it on destruction. Scopes may be nested as long
+     * as they are destroyed in the reverse order of their construction.
+     */
+    class scope {
+      public:
+        /**
+         * Take a checkpoint of @p owner.
+         * @param[in,out] owner The arena to roll back at the end of the scope.
+         */
+        explicit scope (arena& owner) noexcept
+              : arena_{owner}, marker_{owner.checkpoint()} {}
+
+        scope (scope const&) = delete;
+        scope& operator = (scope const&) = delete;
+
+        /**
+         * Roll the arena back to the checkpoint taken on construction.
+         */
+        ~scope () {
+            arena_.rollback(marker_);
+        }
+
+      private:
+        arena& arena_;
+        marker marker_;
+    };
+
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Construct an arena allocating from the @p size bytes starting at @p
+     * buffer.
+     *
+     * @param[in] buffer The first byte of the memory block to allocate from.
+     * @param[in] size The number of bytes in the memory block.
+     */
+    constexpr arena (std::byte* buffer, size_type size) noexcept
+          : buffer_{buffer}, capacity_{size} {}
+
+    /**
+     * Construct an arena allocating from all of @p buffer.
+     *
+     * @param[in] buffer The memory block to allocate from.
+     */
+    template <size_type N>
+    constexpr explicit arena (std::byte (&buffer)[N]) noexcept
+          : arena{buffer, N} {}
+
+    /**
+     * An arena hands out pointers into its buffer, so copies would allocate
+     * overlapping memory.
+     */
+    arena (arena const&) = delete;
+    arena& operator = (arena const&) = delete;
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Allocation
+     * @{
+     */
+
+    /**
+     * Allocate @p size bytes aligned to @p alignment.
+     *
+     * @param[in] size The number of bytes to allocate.
+     * @param[in] alignment The required alignment. Must be a power of two.
+     *
+     * @return A pointer to the allocated memory, or @c nullptr if the arena
+     *     does not have enough space remaining.
+     */
+    [[nodiscard]] void* allocate_bytes (size_type size, size_type alignment)
+    noexcept {
+        auto const address =
+            reinterpret_cast<std::uintptr_t>(buffer_) + used_;
+        auto const padding = static_cast<size_type>(-address & (alignment - 1));
+
+        if (padding > capacity_ - used_ or size > capacity_ - used_ - padding) {
+            return nullptr;
+        }
+
+        std::byte* const result = buffer_ + used_ + padding;
+        used_ += padding + size;
+        return result;
+    }
+
+    /**
+     * Allocate uninitialized storage for @p count contiguous objects of type
+     * @p T.
+     *
+     * @param[in] count The number of objects to allocate storage for.
+     *
+     * @return A pointer to the first element of the storage, or @c nullptr if
+     *     the arena does not have enough space remaining.
+     */
+    template <typename T>
+    [[nodiscard]] storage<T>* allocate (size_type count = 1u) noexcept {
+        // Reject counts whose total size would overflow before multiplying.
+        if (count > (capacity_ - used_) / sizeof(storage<T>)) {
+            return nullptr;
+        }
+
+        return static_cast<storage<T>*>(allocate_bytes(
+            sizeof(storage<T>) * count,
+            alignof(storage<T>)
+        ));
+    }
+
+    /**
+     * Allocate and construct an object of type @p T from @p args... in the
+     * arena.
+     *
+     * @param[in] args... Arguments used for initialization.
+     *
+     * @return A pointer to the new object, or @c nullptr if the arena does not
+     *     have enough space remaining. In the latter case no object is
+     *     constructed.
+     */
+    template <typename T, typename... Args>
+    [[nodiscard]] T* create (Args&&... args)
+    noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        storage<T>* const slot = allocate<T>();
+        if (slot == nullptr) {
+            return nullptr;
+        }
+
+        slot->construct(exfs::forward<Args>(args)...);
+        return &slot->object();
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Release
+     * @{
+     */
+
+    /**
+     * Record the current allocation position.
+     *
+     * @return A marker which can be passed to @c rollback().
+     */
+    [[nodiscard]] constexpr marker checkpoint () const noexcept {
+        return marker{used_};
+    }
+
+    /**
+     * Release every allocation made since @p mark was taken.
+     *
+     * @warning It is undefined behavior to roll back to a marker taken before
+     *     the most recent @c reset() or taken after a marker that has since
+     *     been rolled back to.
+     *
+     * @param[in] mark A marker previously returned by @c checkpoint().
+     */
+    constexpr void rollback (marker mark) noexcept {
+        used_ = mark.offset_;
+    }
+
+    /**
+     * Release every allocation made from the arena.
+     */
+    constexpr void reset () noexcept {
+        used_ = 0u;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Capacity
+     * @{
+     */
+
+    /**
+     * The total number of bytes managed by the arena.
+     */
+    [[nodiscard]] constexpr size_type capacity () const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * The number of bytes currently allocated, including alignment padding.
+     */
+    [[nodiscard]] constexpr size_type used () const noexcept {
+        return used_;
+    }
+
+    /**
+     * The number of bytes which have not been allocated. Alignment padding may
+     * make less than this available to any one allocation.
+     */
+    [[nodiscard]] constexpr size_type remaining () const noexcept {
+        return capacity_ - used_;
+    }
+
+    /**
+     * @}
+     */
+
+  private:
+    std::byte* buffer_;
+    size_type capacity_;
+    size_type used_ = 0u;
+};
+
+#if __STDC_HOSTED__
+/**
+ * Adapts an @c arena to the @c std::pmr::memory_resource interface so that it
+ * can back standard library containers such as @c std::pmr::vector.
+ *
+ * Like @c std::pmr::monotonic_buffer_resource, deallocation is a no-op. Unlike
+ * it, there is no upstream resource: exhausting the arena throws @c
+ * std::bad_alloc instead of falling back to the heap.
+ */
+class arena_resource : public std::pmr::memory_resource {
+  public:
+    /**
+     * Construct a resource which allocates from @p source.
+     *
+     * @param[in,out] source The arena to allocate from. Must outlive the
+     *     resource.
+     */
+    explicit arena_resource (arena& source) noexcept : arena_{source} {}
+
+    /**
+     * Access the underlying arena.
+     */
+    arena& source () const noexcept { return arena_; }
+
+  private:
+    void* do_allocate (std::size_t bytes, std::size_t alignment) override {
+        void* const result = arena_.allocate_bytes(bytes, alignment);
+        if (result == nullptr) {
+            throw std::bad_alloc{};
+        }
+        return result;
+    }
+
+    void do_deallocate (void*, std::size_t, std::size_t) override {}
+
+    bool do_is_equal (std::pmr::memory_resource const& other)
+    const noexcept override {
+        return this == &other;
+    }
+
+    arena& arena_;
+};
+#endif  // __STDC_HOSTED__
+}  // namespace exfs::memory
+
+#endif  // EXFS_MEMORY_ARENA_HPP_
@@ -0,0 +1,204 @@
+#include "exfs/memory/arena.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/memory/storage.hpp"
+
+namespace {
+bool is_aligned (void const* ptr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0u;
+}
+
+struct alignas(32) Over_Aligned {
+    int value;
+};
+}  // namespace
+
+SCENARIO (
+    "exfs::memory::arena - bump allocation",
+    "[unit][memory][arena]"
+) {
+    GIVEN ("an arena over a 256 byte buffer") {
+        alignas(64) std::byte buffer[256];
+        exfs::memory::arena arena{buffer};
+
+        THEN ("nothing is allocated") {
+            CHECK(arena.capacity() == 256u);
+            CHECK(arena.used() == 0u);
+            CHECK(arena.remaining() == 256u);
+        }
+
+        WHEN ("allocating storage for a char and then an int") {
+            auto* const c = arena.allocate<char>();
+            auto* const i = arena.allocate<std::int32_t>();
+
+            THEN ("the storage is placed in order in the buffer") {
+                CHECK(static_cast<void*>(c) == static_cast<void*>(buffer));
+                CHECK(static_cast<void*>(i) == static_cast<void*>(buffer + 4));
+            }
+
+            THEN ("the int is padded to its alignment") {
+                CHECK(is_aligned(i, alignof(std::int32_t)));
+                CHECK(arena.used() == 8u);
+            }
+        }
+
+        WHEN ("allocating storage for an over-aligned type") {
+            (void)arena.allocate<char>();
+            auto* const obj = arena.allocate<Over_Aligned>();
+
+            THEN ("the storage respects the alignment of the type") {
+                CHECK(is_aligned(obj, 32u));
+                CHECK(arena.used() == 32u + sizeof(Over_Aligned));
+            }
+        }
+
+        WHEN ("allocating storage for an array of objects") {
+            auto* const data = arena.allocate<std::uint16_t>(10u);
+
+            THEN ("the whole array is reserved") {
+                REQUIRE(data != nullptr);
+                CHECK(arena.used() == 20u);
+            }
+        }
+
+        WHEN ("creating an object in the arena") {
+            using namespace std::literals::string_literals;
+            auto* const str = arena.create<std::string>("scratch"s);
+
+            THEN ("the object is constructed from the arguments") {
+                REQUIRE(str != nullptr);
+                CHECK(*str == "scratch"s);
+            }
+
+            std::destroy_at(str);
+        }
+
+        WHEN ("allocating more than the remaining space") {
+            (void)arena.allocate<std::byte>(250u);
+            auto const used = arena.used();
+            auto* const result = arena.allocate<std::uint64_t>();
+
+            THEN ("the allocation fails without consuming space") {
+                CHECK(result == nullptr);
+                CHECK(arena.used() == used);
+            }
+
+            THEN ("a smaller allocation still succeeds") {
+                CHECK(arena.allocate<std::uint16_t>() != nullptr);
+            }
+        }
+
+        WHEN ("allocating a count whose total size overflows") {
+            auto* const result = arena.allocate<std::uint64_t>(
+                SIZE_MAX / sizeof(std::uint64_t) + 1u
+            );
+
+            THEN ("the allocation fails without consuming space") {
+                CHECK(result == nullptr);
+                CHECK(arena.used() == 0u);
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::memory::arena - releasing memory",
+    "[unit][memory][arena]"
+) {
+    GIVEN ("an arena with some memory allocated") {
+        alignas(16) std::byte buffer[128];
+        exfs::memory::arena arena{buffer};
+        auto* const first = arena.allocate<std::uint32_t>(4u);
+
+        WHEN ("the arena is reset") {
+            arena.reset();
+
+            THEN ("all memory is available again") {
+                CHECK(arena.used() == 0u);
+                CHECK(arena.allocate<std::uint32_t>() == first);
+            }
+        }
+
+        WHEN ("rolling back to a checkpoint") {
+            auto const mark = arena.checkpoint();
+            auto* const second = arena.allocate<std::uint64_t>(2u);
+            arena.rollback(mark);
+
+            THEN ("only the later allocations are released") {
+                CHECK(arena.used() == 16u);
+                CHECK(arena.allocate<std::uint64_t>() == second);
+            }
+        }
+
+        WHEN ("nesting scopes") {
+            auto const outer_used = arena.used();
+            std::size_t inner_used = 0u;
+            {
+                exfs::memory::arena::scope outer{arena};
+                (void)arena.allocate<std::uint64_t>();
+                inner_used = arena.used();
+                {
+                    exfs::memory::arena::scope inner{arena};
+                    (void)arena.allocate<std::uint64_t>(4u);
+                }
+
+                THEN ("the inner scope releases only its allocations") {
+                    CHECK(arena.used() == inner_used);
+                }
+            }
+
+            THEN ("the outer scope releases the rest") {
+                CHECK(arena.used() == outer_used);
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::memory::arena_resource - polymorphic allocation",
+    "[unit][memory][arena]"
+) {
+    GIVEN ("a memory resource adapting an arena") {
+        alignas(std::max_align_t) std::byte buffer[256];
+        exfs::memory::arena arena{buffer};
+        exfs::memory::arena_resource resource{arena};
+
+        WHEN ("a pmr container allocates from it") {
+            std::pmr::vector<int> vec{&resource};
+            vec.reserve(8u);
+            vec.push_back(42);
+
+            THEN ("the elements live in the arena buffer") {
+                auto const* const data =
+                    reinterpret_cast<std::byte const*>(vec.data());
+                CHECK(data >= buffer);
+                CHECK(data < buffer + sizeof(buffer));
+                CHECK(arena.used() >= 8u * sizeof(int));
+            }
+        }
+
+        WHEN ("the arena is exhausted") {
+            THEN ("allocation throws std::bad_alloc") {
+                CHECK_THROWS_AS(
+                    resource.allocate(sizeof(buffer) + 1u),
+                    std::bad_alloc
+                );
+            }
+        }
+
+        THEN ("the resource compares equal only to itself") {
+            exfs::memory::arena_resource other{arena};
+            CHECK(resource.is_equal(resource));
+            CHECK(not resource.is_equal(other));
+        }
+    }
+}
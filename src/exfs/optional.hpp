@@ -0,0 +1,560 @@
+#ifndef EXFS_OPTIONAL_HPP_
+#define EXFS_OPTIONAL_HPP_
+
+#include <cstddef>
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/memory/storage.hpp"
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/in_place.hpp"
+
+namespace exfs {
+/**
+ * Tag type used to indicate an @c optional with uninitialized state.
+ */
+struct nullopt_t {
+    constexpr explicit nullopt_t (int) {}
+};
+
+inline constexpr nullopt_t nullopt{0};
+
+/**
+ * @name niche
+ * @{
+ */
+
+/**
+ * Describes an unused representation (a "niche") of @p T which @c optional
+ * can use to encode the disengaged state instead of a separate flag. Users may
+ * specialize @c niche for a program-defined type.
+ *
+ * The primary template has no members, meaning @p T has no known niche. A
+ * specialization must provide the following static member functions:
+ *   - `void set_empty(exfs::memory::storage<T>&) noexcept` writes the empty
+ *     representation into storage which holds no object.
+ *   - `bool is_empty(exfs::memory::storage<T> const&) noexcept` checks if the
+ *     storage holds the empty representation.
+ *
+ * The empty representation must never be produced by a live @p T and must
+ * not require destruction, since an object will later be constructed over it.
+ * The storage type is standard layout, so its bytes may be inspected through
+ * an <tt>unsigned char</tt> pointer to the storage object.
+ */
+template <typename T>
+struct niche {};
+
+/**
+ * Helper for specializing @c niche with a @p sentinel value of @p T which the
+ * program never otherwise uses. The empty state is a live object holding @p
+ * sentinel, so @p T must be trivially destructible and equality comparable.
+ *
+ * @code
+ * template <>
+ * struct exfs::niche<Pin_Id> : exfs::sentinel_niche<Pin_Id, Pin_Id{0xff}> {};
+ * @endcode
+ */
+template <typename T, T sentinel>
+requires (std::is_trivially_destructible_v<T> and std::equality_comparable<T>)
+struct sentinel_niche {
+    static constexpr void set_empty (memory::storage<T>& slot) noexcept {
+        slot.construct(sentinel);
+    }
+
+    static constexpr bool is_empty (memory::storage<T> const& slot) noexcept {
+        return slot.object() == sentinel;
+    }
+};
+
+/**
+ * A @c bool only uses the values 0 and 1 of its byte, so any other bit pattern
+ * can encode the empty state.
+ */
+template <>
+struct niche<bool> {
+    static void set_empty (memory::storage<bool>& slot) noexcept {
+        *reinterpret_cast<unsigned char*>(&slot) = 0xffu;
+    }
+
+    static bool is_empty (memory::storage<bool> const& slot) noexcept {
+        return *reinterpret_cast<unsigned char const*>(&slot) == 0xffu;
+    }
+};
+
+/**
+ * Indicates if @c niche has been specialized for @p T.
+ */
+template <typename T>
+concept has_niche = requires (
+    memory::storage<T>& slot,
+    memory::storage<T> const& cslot
+) {
+    { niche<T>::set_empty(slot) } noexcept;
+    { niche<T>::is_empty(cslot) } noexcept -> std::same_as<bool>;
+};
+
+/**
+ * @}
+ */
+
+namespace __detail {
+template <typename T, typename U>
+concept __equality_comparable_with = requires (T const& t, U const& u) {
+    { t == u } -> std::convertible_to<bool>;
+};
+
+template <typename T>
+inline constexpr bool __is_optional = false;
+
+/**
+ * Base of @c optional which tracks the engaged state with a separate flag.
+ */
+template <typename T>
+class __optional_state {
+  public:
+    constexpr bool has_value () const noexcept { return engaged_; }
+
+  protected:
+    constexpr __optional_state () noexcept = default;
+
+    template <typename... Args>
+    constexpr void construct_ (Args&&... args) {
+        storage_.construct(exfs::forward<Args>(args)...);
+        engaged_ = true;
+    }
+
+    constexpr void destroy_ () noexcept {
+        storage_.destroy();
+        engaged_ = false;
+    }
+
+    memory::storage<T> storage_;
+    bool engaged_ = false;
+};
+
+/**
+ * Base of @c optional which encodes the engaged state in the niche of @p T.
+ */
+template <has_niche T>
+class __optional_state<T> {
+  public:
+    constexpr bool has_value () const noexcept {
+        return not niche<T>::is_empty(storage_);
+    }
+
+  protected:
+    constexpr __optional_state () noexcept {
+        niche<T>::set_empty(storage_);
+    }
+
+    template <typename... Args>
+    constexpr void construct_ (Args&&... args) {
+        // If construction throws, the niche may have been overwritten.
+        struct guard {
+            memory::storage<T>* slot;
+            constexpr ~guard () {
+                if (slot != nullptr) {
+                    niche<T>::set_empty(*slot);
+                }
+            }
+        } restore{&storage_};
+
+        storage_.construct(exfs::forward<Args>(args)...);
+        restore.slot = nullptr;
+    }
+
+    constexpr void destroy_ () noexcept {
+        storage_.destroy();
+        niche<T>::set_empty(storage_);
+    }
+
+    memory::storage<T> storage_;
+};
+}  // namespace __detail
+
+/**
+ * The class template @c optional manages an optional contained value, i.e. a
+ * value that may or may not be present.
+ *
+ * The contained value is held in an @c exfs::memory::storage and never
+ * allocated dynamically. By default, whether a value is present is tracked
+ * with a separate @c bool. If @c niche is specialized for @p T, the empty
+ * state is encoded in an otherwise unused representation of @p T instead so
+ * that `sizeof(optional<T>) == sizeof(T)`.
+ *
+ * The interface follows @c std::optional except that there is no checked @c
+ * value() accessor, since it would need to throw.
+ *
+ * @tparam T The type of the value to manage.
+ */
+template <typename T>
+class optional : public __detail::__optional_state<T> {
+    static_assert(std::is_object_v<T> and not std::is_array_v<T>);
+    static_assert(not std::same_as<std::remove_cv_t<T>, nullopt_t>);
+    static_assert(not std::same_as<std::remove_cv_t<T>, in_place_t>);
+
+    using base_ = __detail::__optional_state<T>;
+    using base_::storage_;
+
+  public:
+    using value_type = T;
+
+    using base_::has_value;
+
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Constructs an object that does not contain a value.
+     */
+    constexpr optional () noexcept = default;
+
+    /**
+     * @overload optional()
+     */
+    constexpr optional (nullopt_t) noexcept {}
+
+    /**
+     * Copy constructor. If @p other contains a value, the contained value is
+     * copy constructed from it. Trivial if @p T is trivially copy
+     * constructible.
+     */
+    constexpr optional (optional const& other)
+    requires (
+        std::copy_constructible<T> and
+        std::is_trivially_copy_constructible_v<T>
+    ) = default;
+
+    constexpr optional (optional const& other)
+    noexcept(std::is_nothrow_copy_constructible_v<T>)
+    requires (std::copy_constructible<T>) {
+        if (other.has_value()) {
+            this->construct_(*other);
+        }
+    }
+
+    /**
+     * Move constructor. If @p other contains a value, the contained value is
+     * move constructed from it. @p other still contains a (moved-from)
+     * value afterwards. Trivial if @p T is trivially move constructible.
+     */
+    constexpr optional (optional&& other)
+    requires (
+        std::move_constructible<T> and
+        std::is_trivially_move_constructible_v<T>
+    ) = default;
+
+    constexpr optional (optional&& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>)
+    requires (std::move_constructible<T>) {
+        if (other.has_value()) {
+            this->construct_(exfs::move(*other));
+        }
+    }
+
+    /**
+     * Constructs an optional object that contains a value, initialized as if
+     * direct-initializing an object of type @p T with @p args....
+     */
+    template <typename... Args>
+    requires (std::is_constructible_v<T, Args...>)
+    constexpr explicit optional (in_place_t, Args&&... args) {
+        this->construct_(exfs::forward<Args>(args)...);
+    }
+
+    /**
+     * Constructs an optional object that contains a value, initialized as if
+     * direct-initializing an object of type @p T with @p value.
+     */
+    template <typename U = T>
+    requires (
+        std::is_constructible_v<T, U> and
+        not std::same_as<std::remove_cvref_t<U>, in_place_t> and
+        not std::same_as<std::remove_cvref_t<U>, optional> and
+        not std::same_as<std::remove_cvref_t<U>, nullopt_t>
+    )
+    constexpr explicit(not std::is_convertible_v<U, T>) optional (U&& value) {
+        this->construct_(exfs::forward<U>(value));
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Destroys the contained value, if there is one. Trivial if @p T is
+     * trivially destructible.
+     */
+    constexpr ~optional () requires (std::is_trivially_destructible_v<T>)
+        = default;
+
+    constexpr ~optional () {
+        reset();
+    }
+
+    /**
+     * @name Assignment
+     * @{
+     */
+
+    /**
+     * Destroys the contained value, if any.
+     */
+    constexpr optional& operator = (nullopt_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    /**
+     * Copy assignment. Assigns, constructs, or destroys the contained value
+     * depending on whether @c *this and @p other contain values.
+     */
+    constexpr optional& operator = (optional const& other)
+    requires (
+        std::copyable<T> and
+        std::is_trivially_copy_assignable_v<T> and
+        std::is_trivially_copy_constructible_v<T> and
+        std::is_trivially_destructible_v<T>
+    ) = default;
+
+    constexpr optional& operator = (optional const& other)
+    noexcept(
+        std::is_nothrow_copy_assignable_v<T> and
+        std::is_nothrow_copy_constructible_v<T>
+    )
+    requires (std::copyable<T>) {
+        assign_(other);
+        return *this;
+    }
+
+    /**
+     * Move assignment. Assigns, constructs, or destroys the contained value
+     * depending on whether @c *this and @p other contain values.
+     */
+    constexpr optional& operator = (optional&& other)
+    requires (
+        std::movable<T> and
+        std::is_trivially_move_assignable_v<T> and
+        std::is_trivially_move_constructible_v<T> and
+        std::is_trivially_destructible_v<T>
+    ) = default;
+
+    constexpr optional& operator = (optional&& other)
+    noexcept(
+        std::is_nothrow_move_assignable_v<T> and
+        std::is_nothrow_move_constructible_v<T>
+    )
+    requires (std::movable<T>) {
+        assign_(exfs::move(other));
+        return *this;
+    }
+
+    /**
+     * Assigns @p value to the contained value, or constructs the contained
+     * value from @p value if there is none.
+     */
+    template <typename U = T>
+    requires (
+        not std::same_as<std::remove_cvref_t<U>, optional> and
+        std::is_constructible_v<T, U> and
+        std::is_assignable_v<T&, U> and
+        (not std::is_scalar_v<T> or not std::same_as<std::decay_t<U>, T>)
+    )
+    constexpr optional& operator = (U&& value) {
+        if (has_value()) {
+            **this = exfs::forward<U>(value);
+        } else {
+            this->construct_(exfs::forward<U>(value));
+        }
+        return *this;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Observers
+     * @{
+     */
+
+    /**
+     * Checks whether @c *this contains a value.
+     */
+    constexpr explicit operator bool () const noexcept {
+        return has_value();
+    }
+
+    /**
+     * Accesses the contained value.
+     * @warning The behavior is undefined if @c *this does not contain a value.
+     */
+    constexpr T& operator * () & noexcept { return storage_.object(); }
+
+    /**
+     * @overload operator*()
+     */
+    constexpr T const& operator * () const& noexcept {
+        return storage_.object();
+    }
+
+    /**
+     * @overload operator*()
+     */
+    constexpr T&& operator * () && noexcept {
+        return exfs::move(storage_).object();
+    }
+
+    /**
+     * Accesses members of the contained value.
+     * @warning The behavior is undefined if @c *this does not contain a value.
+     */
+    constexpr T* operator -> () noexcept { return &storage_.object(); }
+
+    /**
+     * @overload operator->()
+     */
+    constexpr T const* operator -> () const noexcept {
+        return &storage_.object();
+    }
+
+    /**
+     * Returns the contained value if @c *this has a value, otherwise returns
+     * @p default_value.
+     */
+    template <typename U>
+    constexpr T value_or (U&& default_value) const& {
+        return has_value()
+            ? **this
+            : static_cast<T>(exfs::forward<U>(default_value));
+    }
+
+    /**
+     * @overload value_or()
+     */
+    template <typename U>
+    constexpr T value_or (U&& default_value) && {
+        return has_value()
+            ? exfs::move(**this)
+            : static_cast<T>(exfs::forward<U>(default_value));
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Modifiers
+     * @{
+     */
+
+    /**
+     * Constructs the contained value in-place from @p args.... If @c *this
+     * already contains a value, it is destroyed first.
+     *
+     * @return A reference to the new contained value.
+     */
+    template <typename... Args>
+    constexpr T& emplace (Args&&... args) {
+        reset();
+        this->construct_(exfs::forward<Args>(args)...);
+        return **this;
+    }
+
+    /**
+     * If @c *this contains a value, destroy that value.
+     */
+    constexpr void reset () noexcept {
+        if (has_value()) {
+            this->destroy_();
+        }
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Comparison
+     * @{
+     */
+
+    /**
+     * An optional object equals @c nullopt if it does not contain a value.
+     */
+    friend constexpr bool operator == (optional const& opt, nullopt_t)
+    noexcept {
+        return not opt.has_value();
+    }
+
+    /**
+     * @}
+     */
+
+  private:
+    template <typename Other>
+    constexpr void assign_ (Other&& other) {
+        if (has_value() and other.has_value()) {
+            **this = *exfs::forward<Other>(other);
+        } else if (other.has_value()) {
+            this->construct_(*exfs::forward<Other>(other));
+        } else {
+            reset();
+        }
+    }
+};
+
+template <typename T>
+optional (T) -> optional<T>;
+
+namespace __detail {
+template <typename T>
+inline constexpr bool __is_optional<optional<T>> = true;
+}  // namespace __detail
+
+/**
+ * @name Comparison
+ *
+ * Both operands are deduced (rather than declared as hidden friends) so that
+ * values are never implicitly converted to @c optional when the compiler
+ * considers the reversed candidates.
+ *
+ * @{
+ */
+
+/**
+ * Two optional objects are equal if neither contains a value, or both do and
+ * the values compare equal.
+ */
+template <typename T, typename U>
+requires (__detail::__equality_comparable_with<T, U>)
+constexpr bool operator == (optional<T> const& lhs, optional<U> const& rhs) {
+    if (lhs.has_value() != rhs.has_value()) {
+        return false;
+    }
+    return not lhs.has_value() or static_cast<bool>(*lhs == *rhs);
+}
+
+/**
+ * An optional object equals a value if it contains a value which compares
+ * equal to it.
+ */
+template <typename T, typename U>
+requires (
+    not __detail::__is_optional<U> and
+    not std::same_as<U, nullopt_t> and
+    __detail::__equality_comparable_with<T, U>
+)
+constexpr bool operator == (optional<T> const& opt, U const& value) {
+    return opt.has_value() and static_cast<bool>(*opt == value);
+}
+
+/**
+ * @}
+ */
+}  // namespace exfs
+
+#endif  // EXFS_OPTIONAL_HPP_
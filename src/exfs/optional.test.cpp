@@ -0,0 +1,206 @@
+#include "exfs/optional.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/in_place.hpp"
+
+namespace {
+enum class Pin_Id : std::uint8_t {
+    pa0, pa1, pa2, pb0, pb1,
+    none = 0xffu,
+};
+
+template <typename Optional>
+constexpr auto in_place_for = exfs::in_place;
+
+template <typename T>
+constexpr auto in_place_for<std::optional<T>> = std::in_place;
+}  // namespace
+
+template <>
+struct exfs::niche<Pin_Id> : exfs::sentinel_niche<Pin_Id, Pin_Id::none> {};
+
+TEST_CASE (
+    "exfs::optional - size and triviality",
+    "[unit][optional]"
+) {
+    CHECK(sizeof(exfs::optional<std::uint32_t>) == 8u);
+    CHECK(sizeof(exfs::optional<std::uint8_t>) == 2u);
+
+    // Types with a niche need no separate engaged flag.
+    CHECK(exfs::has_niche<Pin_Id>);
+    CHECK(exfs::has_niche<bool>);
+    CHECK(not exfs::has_niche<std::uint8_t>);
+    CHECK(sizeof(exfs::optional<Pin_Id>) == sizeof(Pin_Id));
+    CHECK(sizeof(exfs::optional<bool>) == sizeof(bool));
+
+    CHECK(std::is_trivially_copyable_v<exfs::optional<int>>);
+    CHECK(std::is_trivially_copyable_v<exfs::optional<Pin_Id>>);
+    CHECK(std::is_trivially_destructible_v<exfs::optional<double>>);
+    CHECK(not std::is_trivially_copyable_v<exfs::optional<std::string>>);
+
+    CHECK(std::is_copy_constructible_v<exfs::optional<std::string>>);
+    CHECK(not std::is_copy_constructible_v<
+        exfs::optional<std::unique_ptr<int>>
+    >);
+    CHECK(std::is_move_constructible_v<exfs::optional<std::unique_ptr<int>>>);
+}
+
+TEMPLATE_TEST_CASE (
+    "exfs::optional - basic usage",
+    "[unit][std-parity][optional]",
+    std::optional<std::string>,
+    exfs::optional<std::string>
+) {
+    using namespace std::literals::string_literals;
+    using Optional = TestType;
+
+    WHEN ("default constructing an optional") {
+        Optional opt{};
+
+        THEN ("it is empty") {
+            CHECK(not opt.has_value());
+            CHECK(not opt);
+            CHECK(opt.value_or("default"s) == "default"s);
+        }
+
+        AND_WHEN ("a value is emplaced") {
+            auto& result = opt.emplace("xxxx", 3u);
+
+            THEN ("it holds the value") {
+                CHECK(opt.has_value());
+                CHECK(*opt == "xxx"s);
+                CHECK(opt->size() == 3u);
+                CHECK(&result == &*opt);
+            }
+        }
+    }
+
+    WHEN ("constructing an optional from a value") {
+        Optional opt{"value"s};
+
+        THEN ("it holds the value") {
+            REQUIRE(opt);
+            CHECK(*opt == "value"s);
+            CHECK(opt.value_or("default"s) == "value"s);
+        }
+
+        AND_WHEN ("it is reset") {
+            opt.reset();
+
+            THEN ("it is empty") {
+                CHECK(not opt);
+            }
+        }
+
+        AND_WHEN ("it is copied") {
+            Optional copy{opt};
+
+            THEN ("the copy holds the same value") {
+                REQUIRE(copy);
+                CHECK(*copy == "value"s);
+                CHECK(copy == opt);
+            }
+        }
+
+        AND_WHEN ("a value is assigned") {
+            opt = "other"s;
+
+            THEN ("the contained value is replaced") {
+                CHECK(*opt == "other"s);
+            }
+        }
+
+        AND_WHEN ("an empty optional is assigned") {
+            opt = Optional{};
+
+            THEN ("it is empty") {
+                CHECK(not opt);
+            }
+        }
+    }
+
+    WHEN ("constructing an optional in place") {
+        Optional opt{in_place_for<Optional>, "yyyy", 2u};
+
+        THEN ("the value is constructed from the arguments") {
+            REQUIRE(opt);
+            CHECK(*opt == "yy"s);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::optional - comparison",
+    "[unit][optional]"
+) {
+    GIVEN ("an empty and an engaged optional") {
+        exfs::optional<int> empty{};
+        exfs::optional<int> engaged{3};
+
+        THEN ("they compare as expected") {
+            CHECK(empty == exfs::nullopt);
+            CHECK(engaged != exfs::nullopt);
+            CHECK(empty != engaged);
+            CHECK(engaged == 3);
+            CHECK(engaged != 4);
+            CHECK(empty != 3);
+            CHECK(engaged == exfs::optional<long>{3L});
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::optional - niche optimization",
+    "[unit][optional]"
+) {
+    GIVEN ("an optional of a type with a sentinel niche") {
+        exfs::optional<Pin_Id> opt{};
+
+        THEN ("it is initially empty") {
+            CHECK(not opt);
+        }
+
+        WHEN ("a value is assigned") {
+            opt = Pin_Id::pb0;
+
+            THEN ("it holds the value") {
+                REQUIRE(opt);
+                CHECK(*opt == Pin_Id::pb0);
+            }
+
+            AND_WHEN ("it is copied and reset") {
+                auto copy = opt;
+                opt.reset();
+
+                THEN ("the copy is unaffected") {
+                    CHECK(not opt);
+                    CHECK(copy == Pin_Id::pb0);
+                }
+            }
+        }
+    }
+
+    GIVEN ("an optional bool") {
+        exfs::optional<bool> opt{};
+
+        THEN ("it distinguishes empty, false and true") {
+            CHECK(not opt.has_value());
+            opt = false;
+            CHECK(opt.has_value());
+            CHECK(*opt == false);
+            opt = true;
+            CHECK(*opt == true);
+            opt = exfs::nullopt;
+            CHECK(not opt.has_value());
+        }
+    }
+}
@@ -0,0 +1,184 @@
+#ifndef EXFS_RANGES_ACCESS_HPP_
+#define EXFS_RANGES_ACCESS_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+namespace __cust_access {
+// Base cases for ADL. Should never actually be called.
+void begin ();
+void end ();
+
+template <typename T>
+concept __class_or_enum =
+    std::is_class_v<T> or
+    std::is_union_v<T> or
+    std::is_enum_v<T>;
+
+template <typename T>
+concept __member_begin = requires (T& t) {
+    { t.begin() } -> iterator::input_or_output_iterator;
+};
+
+template <typename T>
+concept __adl_begin = __class_or_enum<std::remove_cv_t<T>> and
+    requires (T& t) {
+        { begin(t) } -> iterator::input_or_output_iterator;
+    };
+
+struct __begin_fn {
+    template <typename T>
+    requires (
+        std::is_array_v<T> or
+        __member_begin<T> or
+        __adl_begin<T>
+    )
+    constexpr auto operator () (T& t) const {
+        if constexpr (std::is_array_v<T>) {
+            return t + 0;
+        } else if constexpr (__member_begin<T>) {
+            return t.begin();
+        } else {
+            return begin(t);
+        }
+    }
+};
+
+template <typename T>
+using __begin_t = decltype(__begin_fn{}(declval<T&>()));
+
+template <typename T>
+concept __member_end = requires (T& t) {
+    { t.end() } -> iterator::sentinel_for<__begin_t<T>>;
+};
+
+template <typename T>
+concept __adl_end = __class_or_enum<std::remove_cv_t<T>> and
+    requires (T& t) {
+        { end(t) } -> iterator::sentinel_for<__begin_t<T>>;
+    };
+
+struct __end_fn {
+    template <typename T>
+    requires (
+        std::extent_v<T> != 0u or
+        __member_end<T> or
+        __adl_end<T>
+    )
+    constexpr auto operator () (T& t) const {
+        if constexpr (std::is_array_v<T>) {
+            return t + std::extent_v<T>;
+        } else if constexpr (__member_end<T>) {
+            return t.end();
+        } else {
+            return end(t);
+        }
+    }
+};
+
+template <typename T>
+concept __member_size = requires (T& t) {
+    { t.size() } -> std::integral;
+};
+
+template <typename T>
+concept __subtractable = requires (T& t) {
+    __begin_fn{}(t);
+    __end_fn{}(t);
+} and iterator::sized_sentinel_for<
+    decltype(__end_fn{}(declval<T&>())),
+    __begin_t<T>
+>;
+
+struct __size_fn {
+    template <typename T>
+    requires (
+        std::extent_v<T> != 0u or
+        __member_size<T> or
+        (
+            __subtractable<T> and
+            iterator::forward_iterator<__begin_t<T>>
+        )
+    )
+    constexpr auto operator () (T& t) const {
+        if constexpr (std::is_array_v<T>) {
+            return std::size_t{std::extent_v<T>};
+        } else if constexpr (__member_size<T>) {
+            return t.size();
+        } else {
+            using difference_type = iterator::iter_difference_t<__begin_t<T>>;
+            return static_cast<std::make_unsigned_t<difference_type>>(
+                __end_fn{}(t) - __begin_fn{}(t)
+            );
+        }
+    }
+};
+
+template <typename T>
+concept __member_data = requires (T& t) {
+    { t.data() } -> std::same_as<
+        std::remove_reference_t<iterator::iter_reference_t<__begin_t<T>>>*
+    >;
+};
+
+struct __data_fn {
+    template <typename T>
+    requires (
+        __member_data<T> or
+        iterator::contiguous_iterator<__begin_t<T>>
+    )
+    constexpr auto operator () (T& t) const {
+        if constexpr (__member_data<T>) {
+            return t.data();
+        } else {
+            return std::to_address(__begin_fn{}(t));
+        }
+    }
+};
+}  // namespace __cust_access
+
+inline namespace __cust {
+/**
+ * Returns an iterator to the first element of a range: the array itself
+ * decayed to a pointer, the result of a member @c begin(), or the result of a
+ * @c begin() found by ADL, in that order of preference.
+ *
+ * Only lvalue ranges are accepted, since an iterator into an rvalue container
+ * would dangle.
+ *
+ * This is a customization point object.
+ */
+inline constexpr __cust_access::__begin_fn begin{};
+
+/**
+ * Returns a sentinel for the end of a range, chosen like @c begin.
+ *
+ * This is a customization point object.
+ */
+inline constexpr __cust_access::__end_fn end{};
+
+/**
+ * Returns the number of elements in a range in constant time: the extent of
+ * an array, the result of a member @c size(), or the difference between the
+ * end and begin of the range when they model @c sized_sentinel_for.
+ *
+ * This is a customization point object.
+ */
+inline constexpr __cust_access::__size_fn size{};
+
+/**
+ * Returns a pointer to the first element of a contiguous range.
+ *
+ * This is a customization point object.
+ */
+inline constexpr __cust_access::__data_fn data{};
+}  // inline namespace __cust
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_ACCESS_HPP_
@@ -0,0 +1,72 @@
+#ifndef EXFS_RANGES_ADAPTOR_HPP_
+#define EXFS_RANGES_ADAPTOR_HPP_
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+namespace __detail {
+struct __closure_base {};
+}  // namespace __detail
+
+/**
+ * A range adaptor closure object wraps a callable taking a single
+ * @c viewable_range. Besides being called directly, it can be applied with
+ * the pipe operator, `r | c` being equivalent to `c(r)`, and two closures can
+ * be piped together into a new closure, such that `r | (c1 | c2)` is
+ * equivalent to `r | c1 | c2`.
+ *
+ * The adaptors in @c exfs::views return closures when they are given all
+ * their arguments except the range, e.g. `views::take(3)`.
+ *
+ * @tparam F The wrapped callable.
+ */
+template <typename F>
+class range_adaptor_closure : public __detail::__closure_base {
+  public:
+    constexpr explicit range_adaptor_closure (F fn)
+          : fn_{exfs::move(fn)} {}
+
+    template <viewable_range R>
+    requires std::invocable<F const&, R>
+    constexpr auto operator () (R&& r) const {
+        return fn_(exfs::forward<R>(r));
+    }
+
+    template <viewable_range R>
+    requires std::invocable<F const&, R>
+    friend constexpr auto operator | (R&& r, range_adaptor_closure const& c) {
+        return c(exfs::forward<R>(r));
+    }
+
+  private:
+    F fn_;
+};
+
+/**
+ * Composes two range adaptor closures into one which applies @p lhs and then
+ * @p rhs.
+ */
+template <typename F, typename G>
+constexpr auto operator | (
+    range_adaptor_closure<F> lhs,
+    range_adaptor_closure<G> rhs
+) {
+    using first_ = range_adaptor_closure<F> const&;
+    using second_ = range_adaptor_closure<G> const&;
+    return range_adaptor_closure{
+        [lhs = exfs::move(lhs), rhs = exfs::move(rhs)] <typename R> (R&& r)
+        requires (
+            std::invocable<first_, R> and
+            std::invocable<second_, std::invoke_result_t<first_, R>>
+        ) {
+            return rhs(lhs(exfs::forward<R>(r)));
+        }
+    };
+}
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_ADAPTOR_HPP_
@@ -0,0 +1,82 @@
+#ifndef EXFS_RANGES_ALL_HPP_
+#define EXFS_RANGES_ALL_HPP_
+
+#include <memory>
+#include <type_traits>
+
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/adaptor.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/view_interface.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+/**
+ * A @c view of the elements of some other range, which it refers to through a
+ * pointer. The referenced range must outlive the view.
+ *
+ * @tparam R The referenced range type.
+ */
+template <range R>
+requires std::is_object_v<R>
+class ref_view : public view_interface<ref_view<R>> {
+  public:
+    constexpr ref_view (R& r) noexcept : range_{std::addressof(r)} {}
+
+    constexpr R& base () const noexcept { return *range_; }
+
+    constexpr iterator_t<R> begin () const { return ranges::begin(*range_); }
+    constexpr sentinel_t<R> end () const { return ranges::end(*range_); }
+
+    constexpr auto size () const requires sized_range<R> {
+        return ranges::size(*range_);
+    }
+
+    constexpr auto data () const requires contiguous_range<R> {
+        return ranges::data(*range_);
+    }
+
+  private:
+    R* range_;
+};
+
+template <typename R>
+ref_view (R&) -> ref_view<R>;
+
+namespace __detail {
+struct __all_fn {
+    template <viewable_range R>
+    constexpr auto operator () (R&& r) const {
+        if constexpr (view<std::remove_cvref_t<R>>) {
+            return std::remove_cvref_t<R>(exfs::forward<R>(r));
+        } else {
+            return ref_view{r};
+        }
+    }
+};
+}  // namespace __detail
+
+namespace views {
+/**
+ * Converts a @c viewable_range to a @c view: a view is returned as a copy
+ * (or moved), and any other lvalue range is wrapped in a @c ref_view.
+ *
+ * This is a range adaptor closure object.
+ */
+inline constexpr range_adaptor_closure<__detail::__all_fn> all{
+    __detail::__all_fn{}
+};
+
+/**
+ * The type of the @c view obtained from @c views::all.
+ */
+template <viewable_range R>
+using all_t = decltype(all(declval<R>()));
+}  // namespace views
+}  // namespace exfs::ranges
+
+namespace exfs {
+namespace views = ranges::views;
+}  // namespace exfs
+
+#endif  // EXFS_RANGES_ALL_HPP_
@@ -0,0 +1,202 @@
+#ifndef EXFS_RANGES_CONCEPTS_HPP_
+#define EXFS_RANGES_CONCEPTS_HPP_
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+/**
+ * The @c range concept is modeled by types whose lvalues provide an iterator
+ * and a sentinel denoting their elements through @c ranges::begin and
+ * @c ranges::end.
+ */
+template <typename T>
+concept range = requires (T& t) {
+    ranges::begin(t);
+    ranges::end(t);
+};
+
+/**
+ * @name Associated types
+ *
+ * The iterator, sentinel, and element types of a @c range.
+ *
+ * @{
+ */
+
+template <range R>
+using iterator_t = decltype(ranges::begin(declval<R&>()));
+
+template <range R>
+using sentinel_t = decltype(ranges::end(declval<R&>()));
+
+template <range R>
+using range_difference_t = iterator::iter_difference_t<iterator_t<R>>;
+
+template <range R>
+using range_value_t = iterator::iter_value_t<iterator_t<R>>;
+
+template <range R>
+using range_reference_t = iterator::iter_reference_t<iterator_t<R>>;
+
+template <range R>
+using range_rvalue_reference_t =
+    iterator::iter_rvalue_reference_t<iterator_t<R>>;
+
+/**
+ * @}
+ */
+
+/**
+ * A @c sized_range knows its number of elements in constant time.
+ */
+template <typename T>
+concept sized_range = range<T> and requires (T& t) {
+    ranges::size(t);
+};
+
+/**
+ * A @c common_range has the same type for its iterator and its sentinel.
+ */
+template <typename T>
+concept common_range =
+    range<T> and
+    std::same_as<iterator_t<T>, sentinel_t<T>>;
+
+/**
+ * @name Iterator category refinements
+ *
+ * A range whose iterator models the corresponding iterator concept. A
+ * @c contiguous_range additionally provides @c ranges::data.
+ *
+ * @{
+ */
+
+template <typename T>
+concept input_range =
+    range<T> and
+    iterator::input_iterator<iterator_t<T>>;
+
+template <typename T>
+concept forward_range =
+    input_range<T> and
+    iterator::forward_iterator<iterator_t<T>>;
+
+template <typename T>
+concept bidirectional_range =
+    forward_range<T> and
+    iterator::bidirectional_iterator<iterator_t<T>>;
+
+template <typename T>
+concept random_access_range =
+    bidirectional_range<T> and
+    iterator::random_access_iterator<iterator_t<T>>;
+
+template <typename T>
+concept contiguous_range =
+    random_access_range<T> and
+    iterator::contiguous_iterator<iterator_t<T>> and
+    requires (T& t) {
+        { ranges::data(t) } -> std::same_as<
+            std::add_pointer_t<range_reference_t<T>>
+        >;
+    };
+
+/**
+ * @}
+ */
+
+namespace __detail {
+template <bool is_const, typename T>
+using __maybe_const_t = std::conditional_t<is_const, T const, T>;
+
+// A range whose first n elements can be sliced off in constant time, so that
+// an adaptor can reuse its iterator type unchanged.
+template <typename R>
+concept __sliceable = random_access_range<R> and sized_range<R>;
+
+// The strongest iterator concept tag which the iterator of V models, capped
+// at random access.
+template <typename V>
+using __view_concept_t = std::conditional_t<
+    random_access_range<V>,
+    iterator::random_access_iterator_tag,
+    std::conditional_t<
+        bidirectional_range<V>,
+        iterator::bidirectional_iterator_tag,
+        std::conditional_t<
+            forward_range<V>,
+            iterator::forward_iterator_tag,
+            iterator::input_iterator_tag
+        >
+    >
+>;
+}  // namespace __detail
+
+/**
+ * Tag base class marking a type as a @c view.
+ */
+struct view_base {};
+
+template <typename D>
+requires std::is_class_v<D> and std::same_as<D, std::remove_cv_t<D>>
+class view_interface;
+
+namespace __detail {
+// view_interface does not derive from view_base: if it did, a view holding
+// another view as its first member would have two view_base subobjects at
+// the same address, and the empty base optimization could not apply.
+template <typename D>
+void __derived_from_view_interface (view_interface<D> const*);
+
+template <typename T>
+concept __view_interface_derived = requires (T* t) {
+    __detail::__derived_from_view_interface(t);
+};
+}  // namespace __detail
+
+/**
+ * This variable template may be specialized to @c true for program-defined
+ * types which model @c view without deriving from @c view_base or
+ * @c view_interface.
+ */
+template <typename T>
+inline constexpr bool enable_view =
+    std::derived_from<T, view_base> or
+    __detail::__view_interface_derived<T>;
+
+/**
+ * A @c view is a range which is cheap to move and which does not own its
+ * elements, or owns them only as cheaply as it can be moved. Views are the
+ * building blocks which the adaptors in @c exfs::views compose lazily.
+ */
+template <typename T>
+concept view =
+    range<T> and
+    std::movable<T> and
+    enable_view<T>;
+
+/**
+ * A @c viewable_range can be converted to a @c view with @c views::all:
+ * either it is a view itself, or it is an lvalue which the view refers to.
+ */
+template <typename T>
+concept viewable_range =
+    range<T> and (
+        (
+            view<std::remove_cvref_t<T>> and
+            std::constructible_from<std::remove_cvref_t<T>, T>
+        ) or (
+            not view<std::remove_cvref_t<T>> and
+            std::is_lvalue_reference_v<T>
+        )
+    );
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_CONCEPTS_HPP_
@@ -0,0 +1,143 @@
+#include "exfs/ranges/concepts.hpp"
+
+#include <array>
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/all.hpp"
+#include "exfs/static_vector.hpp"
+
+namespace {
+namespace ranges = exfs::ranges;
+
+using Vector = exfs::static_vector<int, 4>;
+
+static_assert(ranges::contiguous_range<int[3]>);
+static_assert(ranges::contiguous_range<Vector>);
+static_assert(ranges::contiguous_range<Vector const>);
+static_assert(ranges::contiguous_range<std::vector<int>>);
+static_assert(ranges::sized_range<std::array<int, 2>>);
+static_assert(ranges::bidirectional_range<std::list<int>>);
+static_assert(not ranges::random_access_range<std::list<int>>);
+static_assert(ranges::forward_range<std::forward_list<int>>);
+static_assert(not ranges::sized_range<std::forward_list<int>>);
+static_assert(not ranges::range<int>);
+
+// Containers own their elements and are not views; lvalues of them are still
+// viewable through a ref_view.
+static_assert(not ranges::view<Vector>);
+static_assert(ranges::viewable_range<Vector&>);
+static_assert(not ranges::viewable_range<Vector>);
+static_assert(ranges::view<ranges::ref_view<Vector>>);
+static_assert(ranges::viewable_range<ranges::ref_view<Vector>>);
+static_assert(std::is_same_v<
+    ranges::views::all_t<Vector&>,
+    ranges::ref_view<Vector>
+>);
+static_assert(sizeof(ranges::ref_view<Vector>) == sizeof(Vector*));
+
+static_assert(std::is_same_v<ranges::iterator_t<Vector>, int*>);
+static_assert(std::is_same_v<ranges::iterator_t<Vector const>, int const*>);
+static_assert(std::is_same_v<ranges::range_value_t<int const[2]>, int>);
+static_assert(std::is_same_v<
+    ranges::range_rvalue_reference_t<std::list<int>>,
+    int&&
+>);
+
+struct Opted_In {
+    int* begin ();
+    int* end ();
+};
+}  // namespace
+
+template <>
+inline constexpr bool exfs::ranges::enable_view<Opted_In> = true;
+
+static_assert(ranges::view<Opted_In>);
+
+SCENARIO (
+    "exfs::ranges - access",
+    "[unit][ranges]"
+) {
+    GIVEN ("an array") {
+        int values[] = {1, 2, 3};
+
+        THEN ("its bounds are found from its type") {
+            CHECK(ranges::begin(values) == values);
+            CHECK(ranges::end(values) == values + 3);
+            CHECK(ranges::size(values) == 3u);
+            CHECK(ranges::data(values) == values);
+        }
+    }
+
+    GIVEN ("a static_vector") {
+        Vector values{{4, 5}};
+
+        THEN ("its members are used") {
+            CHECK(ranges::begin(values) == values.data());
+            CHECK(ranges::end(values) == values.data() + 2);
+            CHECK(ranges::size(values) == 2u);
+            CHECK(ranges::data(values) == values.data());
+        }
+    }
+
+    GIVEN ("a list") {
+        std::list<int> values{6, 7, 8, 9};
+
+        THEN ("its members are used") {
+            CHECK(*ranges::begin(values) == 6);
+            CHECK(ranges::size(values) == 4u);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::views::all",
+    "[unit][ranges]"
+) {
+    GIVEN ("a static_vector") {
+        Vector values{{1, 2, 3}};
+
+        WHEN ("it is viewed") {
+            auto view = values | exfs::views::all;
+
+            THEN ("the view refers to its elements") {
+                CHECK(&view.base() == &values);
+                CHECK(view.size() == 3u);
+                CHECK(view.data() == values.data());
+                CHECK(view.front() == 1);
+                CHECK(view.back() == 3);
+                CHECK(view[1] == 2);
+                CHECK(not view.empty());
+            }
+
+            THEN ("writes through the view are visible in the vector") {
+                view[0] = 10;
+                CHECK(values[0] == 10);
+            }
+        }
+
+        WHEN ("a view is viewed") {
+            auto view = exfs::views::all(values);
+            auto again = exfs::views::all(view);
+
+            THEN ("the view is returned as is") {
+                CHECK(std::is_same_v<decltype(view), decltype(again)>);
+            }
+        }
+    }
+
+    GIVEN ("an empty static_vector") {
+        Vector values{};
+        auto view = exfs::views::all(values);
+
+        THEN ("the view is empty") {
+            CHECK(view.empty());
+            CHECK(not view);
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#ifndef EXFS_RANGES_DROP_HPP_
+#define EXFS_RANGES_DROP_HPP_
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/adaptor.hpp"
+#include "exfs/ranges/all.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/view_interface.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+/**
+ * A @c view of the elements of an underlying view except the first @c count,
+ * or of no elements if it has fewer.
+ *
+ * The view has the same iterator and sentinel types as the underlying view,
+ * so it preserves contiguity and random access. Its @c begin() is computed in
+ * constant time when the underlying view is random access and sized, and in
+ * @c count steps otherwise.
+ *
+ * @tparam V The underlying view.
+ */
+template <view V>
+class drop_view : public view_interface<drop_view<V>> {
+  public:
+    /**
+     * Constructs a view of the elements of @p base after the first @p count.
+     *
+     * @warning It is undefined behavior if @p count is negative.
+     */
+    constexpr drop_view (V base, range_difference_t<V> count)
+          : base_{exfs::move(base)},
+            count_{count} {}
+
+    /**
+     * Returns a copy of the underlying view.
+     */
+    constexpr V base () const& requires std::copy_constructible<V> {
+        return base_;
+    }
+
+    /**
+     * @overload base()
+     */
+    constexpr V base () && { return exfs::move(base_); }
+
+    constexpr auto begin () { return begin_(base_); }
+
+    constexpr auto begin () const requires random_access_range<V const> {
+        return begin_(base_);
+    }
+
+    constexpr auto end () { return ranges::end(base_); }
+
+    constexpr auto end () const requires random_access_range<V const> {
+        return ranges::end(base_);
+    }
+
+    constexpr auto size () requires sized_range<V> {
+        return size_(base_);
+    }
+
+    constexpr auto size () const requires sized_range<V const> {
+        return size_(base_);
+    }
+
+  private:
+    template <typename B>
+    constexpr auto size_ (B& base) const {
+        auto const size = ranges::size(base);
+        using size_type = std::remove_const_t<decltype(size)>;
+        auto const count = static_cast<size_type>(count_);
+        return count < size ? size - count : size_type{0};
+    }
+
+    template <typename B>
+    constexpr iterator_t<B> begin_ (B& base) const {
+        auto first = ranges::begin(base);
+        if constexpr (__detail::__sliceable<B>) {
+            auto const size = static_cast<range_difference_t<B>>(
+                ranges::size(base)
+            );
+            return first + (count_ < size ? count_ : size);
+        } else {
+            auto const last = ranges::end(base);
+            for (auto n = count_; n > 0 and first != last; --n) {
+                ++first;
+            }
+            return first;
+        }
+    }
+
+    V base_;
+    range_difference_t<V> count_;
+};
+
+template <typename R>
+drop_view (R&&, range_difference_t<views::all_t<R>>)
+    -> drop_view<views::all_t<R>>;
+
+namespace __detail {
+struct __drop_fn {
+    template <viewable_range R>
+    constexpr auto operator () (
+        R&& r,
+        range_difference_t<views::all_t<R>> count
+    ) const {
+        return drop_view(exfs::forward<R>(r), count);
+    }
+
+    template <std::integral N>
+    constexpr auto operator () (N count) const {
+        return range_adaptor_closure{
+            [count] <viewable_range R> (R&& r) {
+                using difference_type = range_difference_t<views::all_t<R>>;
+                return drop_view(
+                    exfs::forward<R>(r),
+                    static_cast<difference_type>(count)
+                );
+            }
+        };
+    }
+};
+}  // namespace __detail
+
+namespace views {
+/**
+ * Adapts a range into a @c drop_view: `views::drop(r, n)`, or
+ * `r | views::drop(n)`.
+ */
+inline constexpr __detail::__drop_fn drop{};
+}  // namespace views
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_DROP_HPP_
@@ -0,0 +1,93 @@
+#include "exfs/ranges/drop.hpp"
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/take.hpp"
+#include "exfs/static_vector.hpp"
+
+namespace {
+namespace ranges = exfs::ranges;
+namespace views = exfs::views;
+
+using Vector = exfs::static_vector<int, 8>;
+using Dropped = ranges::drop_view<ranges::ref_view<Vector>>;
+
+static_assert(std::is_same_v<ranges::iterator_t<Dropped>, int*>);
+static_assert(ranges::contiguous_range<Dropped>);
+static_assert(ranges::sized_range<Dropped const>);
+static_assert(ranges::bidirectional_range<
+    ranges::drop_view<ranges::ref_view<std::list<int>>>
+>);
+
+template <typename R>
+std::vector<int> to_vector (R&& r) {
+    std::vector<int> result;
+    for (int x : r) {
+        result.push_back(x);
+    }
+    return result;
+}
+}  // namespace
+
+SCENARIO (
+    "exfs::views::drop",
+    "[unit][ranges]"
+) {
+    GIVEN ("a static_vector") {
+        Vector values{{1, 2, 3, 4, 5}};
+
+        WHEN ("fewer elements than it holds are dropped") {
+            auto view = views::drop(values, 2);
+
+            THEN ("the view holds the last elements") {
+                CHECK(to_vector(view) == std::vector<int>{3, 4, 5});
+                CHECK(view.size() == 3u);
+                CHECK(view.data() == values.data() + 2);
+            }
+        }
+
+        WHEN ("more elements than it holds are dropped") {
+            auto view = values | views::drop(6);
+
+            THEN ("the view is empty") {
+                CHECK(view.empty());
+                CHECK(view.size() == 0u);
+                CHECK(view.begin() == values.data() + 5);
+            }
+        }
+
+        WHEN ("it is sliced with drop and take") {
+            auto view = values | views::drop(1) | views::take(3);
+
+            THEN ("the view holds the middle elements") {
+                CHECK(to_vector(view) == std::vector<int>{2, 3, 4});
+                CHECK(view.data() == values.data() + 1);
+            }
+        }
+    }
+
+    GIVEN ("a forward list") {
+        std::forward_list<int> values{1, 2, 3};
+
+        WHEN ("elements are dropped") {
+            auto view = values | views::drop(1);
+
+            THEN ("the view starts after them") {
+                CHECK(to_vector(view) == std::vector<int>{2, 3});
+            }
+        }
+
+        WHEN ("more elements than it holds are dropped") {
+            auto view = values | views::drop(4);
+
+            THEN ("the view is empty") {
+                CHECK(view.empty());
+            }
+        }
+    }
+}
@@ -0,0 +1,261 @@
+#ifndef EXFS_RANGES_FILTER_HPP_
+#define EXFS_RANGES_FILTER_HPP_
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/iterator/legacy.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/adaptor.hpp"
+#include "exfs/ranges/all.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/view_interface.hpp"
+#include "exfs/utility/compressed_pair.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+namespace __detail {
+// The iterator_category of filter_view's iterator. A base whose reference is
+// not an lvalue reference only meets the Cpp17 input iterator requirements;
+// otherwise the base's category is kept, capped at bidirectional.
+template <typename V>
+struct __filter_iterator_category {
+    using type = iterator::input_iterator_tag;
+};
+
+template <forward_range V>
+requires std::is_lvalue_reference_v<range_reference_t<V>>
+struct __filter_iterator_category<V> {
+    using type = std::conditional_t<
+        std::is_base_of_v<
+            iterator::bidirectional_iterator_tag,
+            iterator::iterator_category_t<iterator_t<V>>
+        >,
+        iterator::bidirectional_iterator_tag,
+        iterator::iterator_category_t<iterator_t<V>>
+    >;
+};
+}  // namespace __detail
+
+/**
+ * A @c view of the elements of an underlying view which satisfy a predicate.
+ *
+ * The view is at most bidirectional, since the distance between two of its
+ * elements is not known without visiting the elements in between. Unlike
+ * @c std::ranges::filter_view, it does not cache its first element: every
+ * call to @c begin() searches for it again, which keeps the view free of
+ * mutable state. As in the standard library, the view can only be iterated
+ * through a non-const reference.
+ *
+ * @tparam V The underlying view.
+ * @tparam Pred The predicate selecting the elements. It takes no space when
+ *     it is an empty class, such as a captureless lambda.
+ */
+template <input_range V, std::copy_constructible Pred>
+requires (
+    view<V> and
+    std::is_object_v<Pred> and
+    std::predicate<Pred const&, range_reference_t<V>>
+)
+class filter_view : public view_interface<filter_view<V, Pred>> {
+    class sentinel_;
+
+    class iterator_ {
+        friend class filter_view;
+
+        using base_iter_ = iterator_t<V>;
+
+      public:
+        using iterator_concept  = std::conditional_t<
+            bidirectional_range<V>,
+            iterator::bidirectional_iterator_tag,
+            std::conditional_t<
+                forward_range<V>,
+                iterator::forward_iterator_tag,
+                iterator::input_iterator_tag
+            >
+        >;
+        using iterator_category =
+            typename __detail::__filter_iterator_category<V>::type;
+        using value_type        = range_value_t<V>;
+        using difference_type   = range_difference_t<V>;
+        using pointer           = void;
+        using reference         = range_reference_t<V>;
+
+        iterator_ () = default;
+
+        constexpr iterator_ (filter_view& parent, base_iter_ current)
+              : current_{exfs::move(current)},
+                parent_{&parent} {}
+
+        /**
+         * Returns the underlying iterator.
+         */
+        constexpr base_iter_ const& base () const& noexcept {
+            return current_;
+        }
+
+        constexpr reference operator * () const { return *current_; }
+
+        constexpr iterator_& operator ++ () {
+            current_ = parent_->find_next_(exfs::move(++current_));
+            return *this;
+        }
+
+        constexpr void operator ++ (int) { ++*this; }
+
+        constexpr iterator_ operator ++ (int) requires forward_range<V> {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        constexpr iterator_& operator -- () requires bidirectional_range<V> {
+            auto const& pred = parent_->members_.second();
+            do {
+                --current_;
+            } while (not std::invoke(pred, *current_));
+            return *this;
+        }
+
+        constexpr iterator_ operator -- (int)
+        requires bidirectional_range<V> {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        friend constexpr bool operator == (
+            iterator_ const& a,
+            iterator_ const& b
+        ) requires std::equality_comparable<base_iter_> {
+            return a.current_ == b.current_;
+        }
+
+        friend constexpr decltype(auto) iter_move (iterator_ const& it)
+        noexcept(noexcept(iterator::iter_move(it.current_))) {
+            return iterator::iter_move(it.current_);
+        }
+
+      private:
+        base_iter_ current_{};
+        filter_view* parent_ = nullptr;
+    };
+
+    class sentinel_ {
+      public:
+        sentinel_ () = default;
+
+        constexpr explicit sentinel_ (sentinel_t<V> end)
+              : end_{exfs::move(end)} {}
+
+        /**
+         * Returns the underlying sentinel.
+         */
+        constexpr sentinel_t<V> base () const { return end_; }
+
+        friend constexpr bool operator == (
+            iterator_ const& it,
+            sentinel_ const& s
+        ) {
+            return it.base() == s.end_;
+        }
+
+      private:
+        sentinel_t<V> end_{};
+    };
+
+  public:
+    /**
+     * Constructs a view of the elements of @p base which satisfy @p pred.
+     */
+    constexpr filter_view (V base, Pred pred)
+          : members_{exfs::move(base), exfs::move(pred)} {}
+
+    /**
+     * Returns a copy of the underlying view.
+     */
+    constexpr V base () const& requires std::copy_constructible<V> {
+        return members_.first();
+    }
+
+    /**
+     * @overload base()
+     */
+    constexpr V base () && { return exfs::move(members_.first()); }
+
+    /**
+     * Returns the predicate.
+     */
+    constexpr Pred const& pred () const { return members_.second(); }
+
+    /**
+     * Returns an iterator to the first element which satisfies the
+     * predicate. This takes linear time.
+     */
+    constexpr iterator_ begin () {
+        return iterator_{*this, find_next_(ranges::begin(members_.first()))};
+    }
+
+    constexpr auto end () {
+        if constexpr (common_range<V>) {
+            return iterator_{*this, ranges::end(members_.first())};
+        } else {
+            return sentinel_{ranges::end(members_.first())};
+        }
+    }
+
+  private:
+    constexpr iterator_t<V> find_next_ (iterator_t<V> first) {
+        auto const last = ranges::end(members_.first());
+        auto const& pred = members_.second();
+        while (first != last and not std::invoke(pred, *first)) {
+            ++first;
+        }
+        return first;
+    }
+
+    compressed_pair<V, Pred> members_;
+};
+
+template <typename R, typename Pred>
+filter_view (R&&, Pred) -> filter_view<views::all_t<R>, Pred>;
+
+namespace __detail {
+struct __filter_fn {
+    template <viewable_range R, typename Pred>
+    requires requires (R&& r, Pred pred) {
+        filter_view(exfs::forward<R>(r), exfs::move(pred));
+    }
+    constexpr auto operator () (R&& r, Pred pred) const {
+        return filter_view(exfs::forward<R>(r), exfs::move(pred));
+    }
+
+    template <typename Pred>
+    constexpr auto operator () (Pred pred) const {
+        return range_adaptor_closure{
+            [pred = exfs::move(pred)] <viewable_range R> (R&& r)
+            requires requires (Pred const& p) {
+                filter_view(exfs::forward<R>(r), p);
+            } {
+                return filter_view(exfs::forward<R>(r), pred);
+            }
+        };
+    }
+};
+}  // namespace __detail
+
+namespace views {
+/**
+ * Adapts a range into a @c filter_view: `views::filter(r, pred)`, or
+ * `r | views::filter(pred)`.
+ */
+inline constexpr __detail::__filter_fn filter{};
+}  // namespace views
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_FILTER_HPP_
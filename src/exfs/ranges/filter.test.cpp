@@ -0,0 +1,169 @@
+#include "exfs/ranges/filter.hpp"
+
+#include <forward_list>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/transform.hpp"
+#include "exfs/static_vector.hpp"
+
+namespace {
+namespace ranges = exfs::ranges;
+namespace views = exfs::views;
+
+constexpr auto is_even = [] (int x) { return x % 2 == 0; };
+
+using Vector = exfs::static_vector<int, 8>;
+using Evens = ranges::filter_view<
+    ranges::ref_view<Vector>,
+    decltype(is_even)
+>;
+
+static_assert(ranges::bidirectional_range<Evens>);
+static_assert(ranges::common_range<Evens>);
+static_assert(not ranges::random_access_range<Evens>);
+static_assert(not ranges::sized_range<Evens>);
+static_assert(not ranges::range<Evens const>);
+static_assert(sizeof(Evens) == sizeof(Vector*));
+static_assert(not ranges::bidirectional_range<
+    ranges::filter_view<
+        ranges::ref_view<std::forward_list<int>>,
+        decltype(is_even)
+    >
+>);
+
+// A filter over prvalue references is only a Cpp17 input iterator, whatever
+// its iterator_concept.
+constexpr auto negate = [] (int x) { return -x; };
+using Negated_Evens = decltype(
+    std::declval<Vector&>() | views::transform(negate) | views::filter(is_even)
+);
+static_assert(std::is_same_v<
+    ranges::iterator_t<Negated_Evens>::iterator_category,
+    exfs::iterator::input_iterator_tag
+>);
+static_assert(std::is_same_v<
+    ranges::iterator_t<Negated_Evens>::iterator_concept,
+    exfs::iterator::bidirectional_iterator_tag
+>);
+static_assert(std::is_same_v<
+    ranges::iterator_t<Evens>::iterator_category,
+    exfs::iterator::bidirectional_iterator_tag
+>);
+
+template <typename R>
+std::vector<int> to_vector (R&& r) {
+    std::vector<int> result;
+    for (int x : r) {
+        result.push_back(x);
+    }
+    return result;
+}
+
+constexpr int count_evens () {
+    int values[] = {1, 2, 3, 4, 6};
+    int count = 0;
+    for ([[maybe_unused]] int x : values | views::filter(is_even)) {
+        ++count;
+    }
+    return count;
+}
+static_assert(count_evens() == 3);
+
+struct Job {
+    int id;
+    bool ready;
+};
+}  // namespace
+
+SCENARIO (
+    "exfs::views::filter",
+    "[unit][ranges]"
+) {
+    GIVEN ("a static_vector") {
+        Vector values{{1, 2, 3, 4, 5, 6, 7}};
+
+        WHEN ("it is filtered") {
+            auto view = views::filter(values, is_even);
+
+            THEN ("only the matching elements are visited") {
+                CHECK(to_vector(view) == std::vector<int>{2, 4, 6});
+                CHECK(view.front() == 2);
+                CHECK(not view.empty());
+            }
+
+            THEN ("the view can be iterated backward") {
+                auto it = view.end();
+                CHECK(*--it == 6);
+                CHECK(*--it == 4);
+                CHECK(*--it == 2);
+                CHECK(it == view.begin());
+            }
+
+            THEN ("the underlying iterators point into the vector") {
+                CHECK(view.begin().base() == values.data() + 1);
+            }
+
+            THEN ("elements can be written through the view") {
+                for (int& x : view) {
+                    x = 0;
+                }
+                CHECK(to_vector(values)
+                    == std::vector<int>{1, 0, 3, 0, 5, 0, 7});
+            }
+        }
+
+        WHEN ("no element matches") {
+            auto view = values | views::filter([] (int x) { return x > 9; });
+
+            THEN ("the view is empty") {
+                CHECK(view.empty());
+                CHECK(view.begin() == view.end());
+            }
+        }
+
+        WHEN ("it is filtered then transformed") {
+            auto view = values |
+                views::filter(is_even) |
+                views::transform([] (int x) { return x * x; });
+
+            THEN ("the transform is applied to the matching elements") {
+                CHECK(to_vector(view) == std::vector<int>{4, 16, 36});
+            }
+        }
+    }
+
+    GIVEN ("a pointer to a data member as the predicate") {
+        Job jobs[] = {{1, false}, {2, true}, {3, false}, {4, true}};
+
+        WHEN ("it is filtered") {
+            auto view = jobs | views::filter(&Job::ready);
+
+            THEN ("only the elements with the member set are visited") {
+                std::vector<int> ids;
+                for (Job const& job : view) {
+                    ids.push_back(job.id);
+                }
+                CHECK(ids == std::vector<int>{2, 4});
+                CHECK((*--view.end()).id == 4);
+            }
+        }
+    }
+
+    GIVEN ("a list whose first and last elements do not match") {
+        std::list<int> values{1, 8, 9, 10, 11};
+
+        WHEN ("it is filtered") {
+            auto view = values | views::filter(is_even);
+
+            THEN ("the matching elements are visited in order") {
+                CHECK(to_vector(view) == std::vector<int>{8, 10});
+            }
+        }
+    }
+}
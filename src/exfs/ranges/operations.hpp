@@ -0,0 +1,256 @@
+#ifndef EXFS_RANGES_OPERATIONS_HPP_
+#define EXFS_RANGES_OPERATIONS_HPP_
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/traits.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+namespace __detail {
+struct __advance_fn {
+    /**
+     * Increments @p it @p n times, or decrements it @p -n times if @p n is
+     * negative. Random access iterators jump in constant time.
+     *
+     * @warning It is undefined behavior if @p n is negative and @p I is not
+     *     bidirectional.
+     */
+    template <iterator::input_or_output_iterator I>
+    constexpr void operator () (I& it, iterator::iter_difference_t<I> n) const {
+        if constexpr (iterator::random_access_iterator<I>) {
+            it += n;
+        } else {
+            for (; n > 0; --n) {
+                ++it;
+            }
+            if constexpr (iterator::bidirectional_iterator<I>) {
+                for (; n < 0; ++n) {
+                    --it;
+                }
+            }
+        }
+    }
+
+    /**
+     * Advances @p it to @p bound. This is an assignment if @p bound has the
+     * type of @p it, a jump by the distance to @p bound if it is a sized
+     * sentinel, and a step by step walk otherwise.
+     */
+    template <
+        iterator::input_or_output_iterator I,
+        iterator::sentinel_for<I> S
+    >
+    constexpr void operator () (I& it, S bound) const {
+        if constexpr (std::assignable_from<I&, S>) {
+            it = exfs::move(bound);
+        } else if constexpr (iterator::sized_sentinel_for<S, I>) {
+            (*this)(it, bound - it);
+        } else {
+            while (it != bound) {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * Advances @p it by @p n, but not past @p bound.
+     *
+     * When @p S is a sized sentinel for @p I, the distance to @p bound is
+     * computed once, and @p it jumps either by @p n or to @p bound.
+     *
+     * @warning It is undefined behavior if @p n is negative and @p I is not
+     *     bidirectional, or if @p bound is not reachable from @p it in the
+     *     direction of @p n.
+     *
+     * @return The part of @p n which was not traveled because @p bound was
+     *     reached first, so zero if @p it was advanced by @p n.
+     */
+    template <
+        iterator::input_or_output_iterator I,
+        iterator::sentinel_for<I> S
+    >
+    constexpr iterator::iter_difference_t<I> operator () (
+        I& it,
+        iterator::iter_difference_t<I> n,
+        S bound
+    ) const {
+        if constexpr (iterator::sized_sentinel_for<S, I>) {
+            auto const distance = bound - it;
+            bool const reaches_bound = n < 0
+                ? distance >= n
+                : distance <= n;
+            if (reaches_bound) {
+                if constexpr (std::assignable_from<I&, S>) {
+                    it = exfs::move(bound);
+                } else {
+                    (*this)(it, distance);
+                }
+                return n - distance;
+            }
+            (*this)(it, n);
+            return 0;
+        } else {
+            for (; n > 0 and it != bound; --n) {
+                ++it;
+            }
+            if constexpr (
+                iterator::bidirectional_iterator<I> and
+                std::same_as<I, S>
+            ) {
+                for (; n < 0 and it != bound; ++n) {
+                    --it;
+                }
+            }
+            return n;
+        }
+    }
+};
+
+struct __distance_fn {
+    /**
+     * Returns the number of increments from @p first to @p last, computed in
+     * constant time if @p S is a sized sentinel for @p I.
+     */
+    template <
+        iterator::input_or_output_iterator I,
+        iterator::sentinel_for<I> S
+    >
+    constexpr iterator::iter_difference_t<I> operator () (
+        I first,
+        S last
+    ) const {
+        if constexpr (iterator::sized_sentinel_for<S, I>) {
+            return last - first;
+        } else {
+            iterator::iter_difference_t<I> count = 0;
+            for (; first != last; ++first) {
+                ++count;
+            }
+            return count;
+        }
+    }
+
+    /**
+     * Returns the number of elements of @p r, in constant time if it is a
+     * @c sized_range.
+     */
+    template <range R>
+    constexpr range_difference_t<R> operator () (R&& r) const {
+        if constexpr (sized_range<R>) {
+            return static_cast<range_difference_t<R>>(ranges::size(r));
+        } else {
+            return (*this)(ranges::begin(r), ranges::end(r));
+        }
+    }
+};
+
+struct __next_fn {
+    template <iterator::input_or_output_iterator I>
+    constexpr I operator () (I it) const {
+        ++it;
+        return it;
+    }
+
+    template <iterator::input_or_output_iterator I>
+    constexpr I operator () (I it, iterator::iter_difference_t<I> n) const {
+        __advance_fn{}(it, n);
+        return it;
+    }
+
+    template <
+        iterator::input_or_output_iterator I,
+        iterator::sentinel_for<I> S
+    >
+    constexpr I operator () (I it, S bound) const {
+        __advance_fn{}(it, exfs::move(bound));
+        return it;
+    }
+
+    template <
+        iterator::input_or_output_iterator I,
+        iterator::sentinel_for<I> S
+    >
+    constexpr I operator () (
+        I it,
+        iterator::iter_difference_t<I> n,
+        S bound
+    ) const {
+        __advance_fn{}(it, n, exfs::move(bound));
+        return it;
+    }
+};
+
+struct __prev_fn {
+    template <iterator::bidirectional_iterator I>
+    constexpr I operator () (I it) const {
+        --it;
+        return it;
+    }
+
+    template <iterator::bidirectional_iterator I>
+    constexpr I operator () (I it, iterator::iter_difference_t<I> n) const {
+        __advance_fn{}(it, -n);
+        return it;
+    }
+
+    template <iterator::bidirectional_iterator I>
+    constexpr I operator () (
+        I it,
+        iterator::iter_difference_t<I> n,
+        I bound
+    ) const {
+        __advance_fn{}(it, -n, exfs::move(bound));
+        return it;
+    }
+};
+}  // namespace __detail
+
+/**
+ * @name Iterator operations
+ *
+ * Function objects which move iterators over a range delimited by a sentinel.
+ * Unlike @c iterator::advance and @c iterator::distance, they take the
+ * shortest path that the iterator and sentinel types allow: a random access
+ * iterator jumps, and the distance to a @c sized_sentinel_for is computed by
+ * subtraction rather than by stepping. They are objects rather than function
+ * templates, so they are not found by ADL and cannot be hijacked by
+ * unconstrained overloads.
+ *
+ * @{
+ */
+
+/**
+ * Advances an iterator by a count, to a bound, or by a count but not past a
+ * bound: `advance(it, n)`, `advance(it, bound)`, `advance(it, n, bound)`.
+ */
+inline constexpr __detail::__advance_fn advance{};
+
+/**
+ * Returns the distance between an iterator and a sentinel, or the number of
+ * elements of a range: `distance(first, last)`, `distance(r)`.
+ */
+inline constexpr __detail::__distance_fn distance{};
+
+/**
+ * Returns a copy of an iterator advanced like with @c ranges::advance, or by
+ * one if no count or bound is given.
+ */
+inline constexpr __detail::__next_fn next{};
+
+/**
+ * Returns a copy of an iterator moved backward by a count, or by one if no
+ * count is given, but not before an optional bound.
+ */
+inline constexpr __detail::__prev_fn prev{};
+
+/**
+ * @}
+ */
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_OPERATIONS_HPP_
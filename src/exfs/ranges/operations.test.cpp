@@ -0,0 +1,307 @@
+#include "exfs/ranges/operations.hpp"
+
+#include <forward_list>
+#include <list>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/counted_iterator.hpp"
+#include "exfs/iterator/models.hpp"
+#include "exfs/iterator/sentinels.hpp"
+
+namespace {
+namespace iter = exfs::iterator;
+namespace ranges = exfs::ranges;
+
+using iter::models::counting_iterator;
+using iter::models::counting_sentinel;
+using iter::models::disabled_sized_sentinel;
+using iter::models::Operation_Counts;
+
+using Forward = counting_iterator<iter::forward_iterator_tag>;
+using Bidirectional = counting_iterator<iter::bidirectional_iterator_tag>;
+using Random_Access = counting_iterator<iter::random_access_iterator_tag>;
+
+constexpr int middle () {
+    int values[] = {1, 2, 3, 4, 5};
+    return *ranges::next(values + 0, 2, values + 5);
+}
+static_assert(middle() == 3);
+}  // namespace
+
+SCENARIO (
+    "exfs::ranges::advance - by a count",
+    "[unit][ranges][iterator]"
+) {
+    int values[10]{};
+    Operation_Counts counts{};
+
+    GIVEN ("a forward iterator") {
+        Forward it{values, &counts};
+        ranges::advance(it, 4);
+
+        THEN ("it steps forward") {
+            CHECK(it.base() == values + 4);
+            CHECK(counts.increments == 4);
+        }
+    }
+
+    GIVEN ("a bidirectional iterator") {
+        Bidirectional it{values + 5, &counts};
+        ranges::advance(it, -3);
+
+        THEN ("it steps backward") {
+            CHECK(it.base() == values + 2);
+            CHECK(counts.decrements == 3);
+        }
+    }
+
+    GIVEN ("a random access iterator") {
+        Random_Access it{values, &counts};
+        ranges::advance(it, 7);
+
+        THEN ("it jumps") {
+            CHECK(it.base() == values + 7);
+            CHECK(counts.increments == 0);
+            CHECK(counts.jumps == 1);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::ranges::advance - to a bound",
+    "[unit][ranges][iterator]"
+) {
+    int values[10]{};
+    Operation_Counts counts{};
+
+    GIVEN ("a forward iterator and a sized sentinel") {
+        Forward it{values, &counts};
+        ranges::advance(it, counting_sentinel<true>{values + 6});
+
+        THEN ("it jumps by the distance to the sentinel") {
+            CHECK(it.base() == values + 6);
+            CHECK(counts.subtractions == 1);
+            CHECK(counts.increments == 6);
+        }
+    }
+
+    GIVEN ("a random access iterator and a sized sentinel") {
+        Random_Access it{values, &counts};
+        ranges::advance(it, counting_sentinel<true>{values + 6});
+
+        THEN ("it jumps in constant time") {
+            CHECK(it.base() == values + 6);
+            CHECK(counts.increments == 0);
+            CHECK(counts.jumps == 1);
+        }
+    }
+
+    GIVEN ("a random access iterator and an unsized sentinel") {
+        Random_Access it{values, &counts};
+        ranges::advance(it, counting_sentinel<false>{values + 6});
+
+        THEN ("it steps to the sentinel") {
+            CHECK(it.base() == values + 6);
+            CHECK(counts.increments == 6);
+        }
+    }
+
+    GIVEN ("a sentinel whose size is disabled") {
+        Random_Access it{values, &counts};
+        ranges::advance(it, disabled_sized_sentinel{values + 6});
+
+        THEN ("the subtraction is not used") {
+            CHECK(it.base() == values + 6);
+            CHECK(counts.subtractions == 0);
+            CHECK(counts.increments == 6);
+        }
+    }
+
+    GIVEN ("a bound of the iterator type") {
+        Forward it{values, &counts};
+        ranges::advance(it, Forward{values + 3, &counts});
+
+        THEN ("it is assigned") {
+            CHECK(it.base() == values + 3);
+            CHECK(counts.increments == 0);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::ranges::advance - by a count up to a bound",
+    "[unit][ranges][iterator]"
+) {
+    int values[10]{};
+    Operation_Counts counts{};
+
+    GIVEN ("a random access iterator and a sized sentinel") {
+        Random_Access it{values, &counts};
+        counting_sentinel<true> const bound{values + 5};
+
+        WHEN ("the count is less than the distance to the bound") {
+            auto const left = ranges::advance(it, 3, bound);
+
+            THEN ("it jumps by the count") {
+                CHECK(left == 0);
+                CHECK(it.base() == values + 3);
+                CHECK(counts.increments == 0);
+            }
+        }
+
+        WHEN ("the count is more than the distance to the bound") {
+            auto const left = ranges::advance(it, 8, bound);
+
+            THEN ("it jumps to the bound and returns the rest") {
+                CHECK(left == 3);
+                CHECK(it.base() == values + 5);
+                CHECK(counts.increments == 0);
+                CHECK(counts.subtractions == 1);
+            }
+        }
+    }
+
+    GIVEN ("a random access iterator moving backward to a bound") {
+        Random_Access it{values + 6, &counts};
+        Random_Access const bound{values + 2, &counts};
+        auto const left = ranges::advance(it, -7, bound);
+
+        THEN ("it stops at the bound") {
+            CHECK(left == -3);
+            CHECK(it.base() == values + 2);
+            CHECK(counts.decrements == 0);
+        }
+    }
+
+    GIVEN ("a forward iterator and an unsized sentinel") {
+        Forward it{values, &counts};
+        counting_sentinel<false> const bound{values + 4};
+
+        WHEN ("the count is more than the distance to the bound") {
+            auto const left = ranges::advance(it, 6, bound);
+
+            THEN ("it steps to the bound") {
+                CHECK(left == 2);
+                CHECK(it.base() == values + 4);
+                CHECK(counts.increments == 4);
+            }
+        }
+
+        WHEN ("the count is less than the distance to the bound") {
+            auto const left = ranges::advance(it, 2, bound);
+
+            THEN ("it steps by the count") {
+                CHECK(left == 0);
+                CHECK(counts.increments == 2);
+            }
+        }
+    }
+
+    GIVEN ("a bidirectional iterator moving backward to a bound") {
+        Bidirectional it{values + 5, &counts};
+        Bidirectional const bound{values + 3, &counts};
+        auto const left = ranges::advance(it, -4, bound);
+
+        THEN ("it steps back to the bound") {
+            CHECK(left == -2);
+            CHECK(it.base() == values + 3);
+            CHECK(counts.decrements == 2);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::ranges::distance",
+    "[unit][ranges][iterator]"
+) {
+    int values[10]{};
+    Operation_Counts counts{};
+
+    GIVEN ("a forward iterator and a sized sentinel") {
+        Forward const it{values, &counts};
+        auto const d = ranges::distance(
+            it,
+            counting_sentinel<true>{values + 8}
+        );
+
+        THEN ("the distance is computed by subtraction") {
+            CHECK(d == 8);
+            CHECK(counts.increments == 0);
+            CHECK(counts.subtractions == 1);
+        }
+    }
+
+    GIVEN ("a forward iterator and an unsized sentinel") {
+        Forward const it{values, &counts};
+        auto const d = ranges::distance(
+            it,
+            counting_sentinel<false>{values + 8}
+        );
+
+        THEN ("the distance is counted") {
+            CHECK(d == 8);
+            CHECK(counts.increments == 8);
+        }
+    }
+
+    GIVEN ("a counted range over a forward list") {
+        std::forward_list<int> list{1, 2, 3, 4};
+
+        THEN ("its distance is known from the count") {
+            CHECK(ranges::distance(
+                iter::counted_iterator{list.begin(), 3},
+                iter::default_sentinel
+            ) == 3);
+        }
+    }
+
+    GIVEN ("ranges") {
+        std::list<int> const list{1, 2, 3};
+        std::forward_list<int> const forward_list{1, 2};
+
+        THEN ("their sizes are returned") {
+            CHECK(ranges::distance(values) == 10);
+            CHECK(ranges::distance(list) == 3);
+            CHECK(ranges::distance(forward_list) == 2);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::ranges::next and prev",
+    "[unit][ranges][iterator]"
+) {
+    int values[10]{};
+    Operation_Counts counts{};
+
+    GIVEN ("a bidirectional iterator") {
+        Bidirectional const it{values + 5, &counts};
+
+        THEN ("next and prev return moved copies") {
+            CHECK(ranges::next(it).base() == values + 6);
+            CHECK(ranges::next(it, 2).base() == values + 7);
+            CHECK(ranges::prev(it).base() == values + 4);
+            CHECK(ranges::prev(it, 3).base() == values + 2);
+            CHECK(it.base() == values + 5);
+        }
+
+        THEN ("next and prev stop at a bound") {
+            CHECK(ranges::next(it, 9, Bidirectional{values + 8, &counts})
+                .base() == values + 8);
+            CHECK(ranges::prev(it, 9, Bidirectional{values + 1, &counts})
+                .base() == values + 1);
+        }
+    }
+
+    GIVEN ("a random access iterator and a sized sentinel") {
+        Random_Access const it{values, &counts};
+        auto const last = ranges::next(it, counting_sentinel<true>{values + 9});
+
+        THEN ("next jumps to the sentinel") {
+            CHECK(last.base() == values + 9);
+            CHECK(counts.increments == 0);
+        }
+    }
+}
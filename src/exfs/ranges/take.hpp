@@ -0,0 +1,170 @@
+#ifndef EXFS_RANGES_TAKE_HPP_
+#define EXFS_RANGES_TAKE_HPP_
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/iterator/counted_iterator.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/adaptor.hpp"
+#include "exfs/ranges/all.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/view_interface.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+/**
+ * A @c view of the first @c count elements of an underlying view, or of all
+ * its elements if it has fewer.
+ *
+ * When the underlying view is random access and sized, the view reuses its
+ * iterator type, so that e.g. taking from a contiguous range yields a
+ * contiguous range of pointers. Otherwise its iterator is a
+ * @c counted_iterator which also counts down the remaining elements.
+ *
+ * @tparam V The underlying view.
+ */
+template <view V>
+class take_view : public view_interface<take_view<V>> {
+    template <bool is_const>
+    class sentinel_ {
+        using base_range_ = __detail::__maybe_const_t<is_const, V>;
+
+      public:
+        sentinel_ () = default;
+
+        constexpr explicit sentinel_ (sentinel_t<base_range_> end)
+              : end_{exfs::move(end)} {}
+
+        /**
+         * Returns the underlying sentinel.
+         */
+        constexpr sentinel_t<base_range_> base () const { return end_; }
+
+        template <typename Iter>
+        requires iterator::sentinel_for<sentinel_t<base_range_>, Iter>
+        friend constexpr bool operator == (
+            iterator::counted_iterator<Iter> const& it,
+            sentinel_ const& s
+        ) {
+            return it.count() == 0 or it.base() == s.end_;
+        }
+
+      private:
+        sentinel_t<base_range_> end_{};
+    };
+
+  public:
+    /**
+     * Constructs a view of the first @p count elements of @p base.
+     *
+     * @warning It is undefined behavior if @p count is negative.
+     */
+    constexpr take_view (V base, range_difference_t<V> count)
+          : base_{exfs::move(base)},
+            count_{count} {}
+
+    /**
+     * Returns a copy of the underlying view.
+     */
+    constexpr V base () const& requires std::copy_constructible<V> {
+        return base_;
+    }
+
+    /**
+     * @overload base()
+     */
+    constexpr V base () && { return exfs::move(base_); }
+
+    constexpr auto begin () { return begin_(base_); }
+
+    constexpr auto begin () const requires range<V const> {
+        return begin_(base_);
+    }
+
+    constexpr auto end () { return end_(base_); }
+
+    constexpr auto end () const requires range<V const> {
+        return end_(base_);
+    }
+
+    constexpr auto size () requires sized_range<V> {
+        return size_(base_);
+    }
+
+    constexpr auto size () const requires sized_range<V const> {
+        return size_(base_);
+    }
+
+  private:
+    template <typename B>
+    constexpr auto size_ (B& base) const {
+        auto const size = ranges::size(base);
+        using size_type = std::remove_const_t<decltype(size)>;
+        auto const count = static_cast<size_type>(count_);
+        return count < size ? count : size;
+    }
+
+    template <typename B>
+    constexpr auto begin_ (B& base) const {
+        if constexpr (__detail::__sliceable<B>) {
+            return ranges::begin(base);
+        } else {
+            return iterator::counted_iterator{ranges::begin(base), count_};
+        }
+    }
+
+    template <typename B>
+    constexpr auto end_ (B& base) const {
+        if constexpr (__detail::__sliceable<B>) {
+            return ranges::begin(base) +
+                static_cast<range_difference_t<B>>(size_(base));
+        } else {
+            constexpr bool is_const = std::is_const_v<B>;
+            return sentinel_<is_const>{ranges::end(base)};
+        }
+    }
+
+    V base_;
+    range_difference_t<V> count_;
+};
+
+template <typename R>
+take_view (R&&, range_difference_t<views::all_t<R>>)
+    -> take_view<views::all_t<R>>;
+
+namespace __detail {
+struct __take_fn {
+    template <viewable_range R>
+    constexpr auto operator () (
+        R&& r,
+        range_difference_t<views::all_t<R>> count
+    ) const {
+        return take_view(exfs::forward<R>(r), count);
+    }
+
+    template <std::integral N>
+    constexpr auto operator () (N count) const {
+        return range_adaptor_closure{
+            [count] <viewable_range R> (R&& r) {
+                using difference_type = range_difference_t<views::all_t<R>>;
+                return take_view(
+                    exfs::forward<R>(r),
+                    static_cast<difference_type>(count)
+                );
+            }
+        };
+    }
+};
+}  // namespace __detail
+
+namespace views {
+/**
+ * Adapts a range into a @c take_view: `views::take(r, n)`, or
+ * `r | views::take(n)`.
+ */
+inline constexpr __detail::__take_fn take{};
+}  // namespace views
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_TAKE_HPP_
@@ -0,0 +1,116 @@
+#include "exfs/ranges/take.hpp"
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/filter.hpp"
+#include "exfs/static_vector.hpp"
+
+namespace {
+namespace ranges = exfs::ranges;
+namespace views = exfs::views;
+
+using Vector = exfs::static_vector<int, 8>;
+using Taken = ranges::take_view<ranges::ref_view<Vector>>;
+using Taken_List = ranges::take_view<ranges::ref_view<std::list<int>>>;
+
+// Slicing a contiguous range reuses its pointers.
+static_assert(std::is_same_v<ranges::iterator_t<Taken>, int*>);
+static_assert(ranges::contiguous_range<Taken>);
+static_assert(ranges::common_range<Taken>);
+static_assert(ranges::sized_range<Taken const>);
+
+static_assert(ranges::forward_range<Taken_List>);
+static_assert(ranges::bidirectional_range<Taken_List>);
+static_assert(not ranges::random_access_range<Taken_List>);
+static_assert(ranges::sized_range<Taken_List>);
+static_assert(not ranges::common_range<Taken_List>);
+
+template <typename R>
+std::vector<int> to_vector (R&& r) {
+    std::vector<int> result;
+    for (int x : r) {
+        result.push_back(x);
+    }
+    return result;
+}
+}  // namespace
+
+SCENARIO (
+    "exfs::views::take",
+    "[unit][ranges]"
+) {
+    GIVEN ("a static_vector") {
+        Vector values{{1, 2, 3, 4, 5}};
+
+        WHEN ("fewer elements than it holds are taken") {
+            auto view = views::take(values, 3);
+
+            THEN ("the view holds the first elements") {
+                CHECK(to_vector(view) == std::vector<int>{1, 2, 3});
+                CHECK(view.size() == 3u);
+                CHECK(view.data() == values.data());
+                CHECK(view.back() == 3);
+            }
+        }
+
+        WHEN ("more elements than it holds are taken") {
+            auto view = values | views::take(9);
+
+            THEN ("the view holds all its elements") {
+                CHECK(view.size() == 5u);
+                CHECK(view.end() == values.data() + 5);
+            }
+        }
+
+        WHEN ("no element is taken") {
+            auto view = values | views::take(0);
+
+            THEN ("the view is empty") {
+                CHECK(view.empty());
+            }
+        }
+    }
+
+    GIVEN ("a list") {
+        std::list<int> values{1, 2, 3, 4};
+
+        WHEN ("fewer elements than it holds are taken") {
+            auto view = values | views::take(2);
+
+            THEN ("the iterator counts the remaining elements") {
+                auto it = view.begin();
+                CHECK(it.count() == 2);
+                CHECK(to_vector(view) == std::vector<int>{1, 2});
+                CHECK(view.size() == 2u);
+            }
+        }
+
+        WHEN ("more elements than it holds are taken") {
+            auto view = values | views::take(7);
+
+            THEN ("the view ends with the list") {
+                CHECK(to_vector(view) == std::vector<int>{1, 2, 3, 4});
+                CHECK(view.size() == 4u);
+            }
+        }
+    }
+
+    GIVEN ("a filtered range, which is neither sized nor random access") {
+        std::forward_list<int> values{1, 2, 3, 4, 5, 6};
+
+        WHEN ("the first matching elements are taken") {
+            auto view = values |
+                views::filter([] (int x) { return x % 2 == 1; }) |
+                views::take(2);
+
+            THEN ("the search stops after them") {
+                CHECK(to_vector(view) == std::vector<int>{1, 3});
+            }
+        }
+    }
+}
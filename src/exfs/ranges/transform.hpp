@@ -0,0 +1,368 @@
+#ifndef EXFS_RANGES_TRANSFORM_HPP_
+#define EXFS_RANGES_TRANSFORM_HPP_
+
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/adaptor.hpp"
+#include "exfs/ranges/all.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/view_interface.hpp"
+#include "exfs/utility/compressed_pair.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs::ranges {
+/**
+ * A @c view of the results of applying a function to each element of an
+ * underlying view. The function is called on every dereference, so no
+ * intermediate storage is needed and a chain of adaptors compiles to a single
+ * loop.
+ *
+ * The view is random access, bidirectional or forward when the underlying
+ * view is, and sized when it is sized. It is never contiguous since its
+ * elements are computed.
+ *
+ * @tparam V The underlying view.
+ * @tparam F The function object applied to each element. It takes no space
+ *     when it is an empty class, such as a captureless lambda.
+ */
+template <input_range V, std::copy_constructible F>
+requires (
+    view<V> and
+    std::is_object_v<F> and
+    std::regular_invocable<F&, range_reference_t<V>>
+)
+class transform_view : public view_interface<transform_view<V, F>> {
+    template <bool is_const>
+    class sentinel_;
+
+    template <bool is_const>
+    class iterator_ {
+        friend class transform_view;
+
+        using parent_type_ =
+            __detail::__maybe_const_t<is_const, transform_view>;
+        using base_range_ = __detail::__maybe_const_t<is_const, V>;
+        using base_iter_ = iterator_t<base_range_>;
+        using fn_ = __detail::__maybe_const_t<is_const, F>;
+
+      public:
+        using iterator_concept  = __detail::__view_concept_t<base_range_>;
+        using iterator_category = std::conditional_t<
+            std::is_lvalue_reference_v<
+                std::invoke_result_t<fn_&, range_reference_t<base_range_>>
+            >,
+            iterator_concept,
+            iterator::input_iterator_tag
+        >;
+        using value_type        = std::remove_cvref_t<
+            std::invoke_result_t<fn_&, range_reference_t<base_range_>>
+        >;
+        using difference_type   = range_difference_t<base_range_>;
+        using pointer           = void;
+        using reference         =
+            std::invoke_result_t<fn_&, range_reference_t<base_range_>>;
+
+        iterator_ () = default;
+
+        constexpr iterator_ (parent_type_& parent, base_iter_ current)
+              : current_{exfs::move(current)},
+                parent_{&parent} {}
+
+        template <bool other_const>
+        requires (
+            is_const and
+            not other_const and
+            std::convertible_to<iterator_t<V>, base_iter_>
+        )
+        constexpr iterator_ (iterator_<other_const> other)
+              : current_{exfs::move(other.current_)},
+                parent_{other.parent_} {}
+
+        /**
+         * Returns the underlying iterator.
+         */
+        constexpr base_iter_ const& base () const& noexcept {
+            return current_;
+        }
+
+        /**
+         * @overload base()
+         */
+        constexpr base_iter_ base () && { return exfs::move(current_); }
+
+        constexpr reference operator * () const {
+            return std::invoke(parent_->members_.second(), *current_);
+        }
+
+        constexpr reference operator [] (difference_type n) const
+        requires random_access_range<base_range_> {
+            return std::invoke(parent_->members_.second(), current_[n]);
+        }
+
+        constexpr iterator_& operator ++ () {
+            ++current_;
+            return *this;
+        }
+
+        constexpr void operator ++ (int) { ++current_; }
+
+        constexpr iterator_ operator ++ (int)
+        requires forward_range<base_range_> {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        constexpr iterator_& operator -- ()
+        requires bidirectional_range<base_range_> {
+            --current_;
+            return *this;
+        }
+
+        constexpr iterator_ operator -- (int)
+        requires bidirectional_range<base_range_> {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        constexpr iterator_& operator += (difference_type n)
+        requires random_access_range<base_range_> {
+            current_ += n;
+            return *this;
+        }
+
+        constexpr iterator_& operator -= (difference_type n)
+        requires random_access_range<base_range_> {
+            current_ -= n;
+            return *this;
+        }
+
+        friend constexpr iterator_ operator + (iterator_ it, difference_type n)
+        requires random_access_range<base_range_> {
+            return it += n;
+        }
+
+        friend constexpr iterator_ operator + (difference_type n, iterator_ it)
+        requires random_access_range<base_range_> {
+            return it += n;
+        }
+
+        friend constexpr iterator_ operator - (iterator_ it, difference_type n)
+        requires random_access_range<base_range_> {
+            return it -= n;
+        }
+
+        friend constexpr difference_type operator - (
+            iterator_ const& a,
+            iterator_ const& b
+        ) requires iterator::sized_sentinel_for<base_iter_, base_iter_> {
+            return a.current_ - b.current_;
+        }
+
+        friend constexpr bool operator == (
+            iterator_ const& a,
+            iterator_ const& b
+        ) requires std::equality_comparable<base_iter_> {
+            return a.current_ == b.current_;
+        }
+
+        friend constexpr auto operator <=> (
+            iterator_ const& a,
+            iterator_ const& b
+        ) requires random_access_range<base_range_> {
+            if (a.current_ < b.current_) {
+                return std::strong_ordering::less;
+            }
+            if (b.current_ < a.current_) {
+                return std::strong_ordering::greater;
+            }
+            return std::strong_ordering::equal;
+        }
+
+        friend constexpr decltype(auto) iter_move (iterator_ const& it)
+        noexcept(noexcept(*it)) {
+            if constexpr (std::is_lvalue_reference_v<reference>) {
+                return exfs::move(*it);
+            } else {
+                return *it;
+            }
+        }
+
+      private:
+        base_iter_ current_{};
+        parent_type_* parent_ = nullptr;
+    };
+
+    template <bool is_const>
+    class sentinel_ {
+        friend class transform_view;
+
+        using base_range_ = __detail::__maybe_const_t<is_const, V>;
+
+      public:
+        sentinel_ () = default;
+
+        constexpr explicit sentinel_ (sentinel_t<base_range_> end)
+              : end_{exfs::move(end)} {}
+
+        template <bool other_const>
+        requires (
+            is_const and
+            not other_const and
+            std::convertible_to<sentinel_t<V>, sentinel_t<base_range_>>
+        )
+        constexpr sentinel_ (sentinel_<other_const> other)
+              : end_{exfs::move(other.end_)} {}
+
+        /**
+         * Returns the underlying sentinel.
+         */
+        constexpr sentinel_t<base_range_> base () const { return end_; }
+
+        template <bool other_const>
+        requires iterator::sentinel_for<
+            sentinel_t<base_range_>,
+            iterator_t<__detail::__maybe_const_t<other_const, V>>
+        >
+        friend constexpr bool operator == (
+            iterator_<other_const> const& it,
+            sentinel_ const& s
+        ) {
+            return it.base() == s.end_;
+        }
+
+        template <bool other_const>
+        requires iterator::sized_sentinel_for<
+            sentinel_t<base_range_>,
+            iterator_t<__detail::__maybe_const_t<other_const, V>>
+        >
+        friend constexpr range_difference_t<base_range_> operator - (
+            iterator_<other_const> const& it,
+            sentinel_ const& s
+        ) {
+            return it.base() - s.end_;
+        }
+
+        template <bool other_const>
+        requires iterator::sized_sentinel_for<
+            sentinel_t<base_range_>,
+            iterator_t<__detail::__maybe_const_t<other_const, V>>
+        >
+        friend constexpr range_difference_t<base_range_> operator - (
+            sentinel_ const& s,
+            iterator_<other_const> const& it
+        ) {
+            return s.end_ - it.base();
+        }
+
+      private:
+        sentinel_t<base_range_> end_{};
+    };
+
+  public:
+    /**
+     * Constructs a view applying @p fn to the elements of @p base.
+     */
+    constexpr transform_view (V base, F fn)
+          : members_{exfs::move(base), exfs::move(fn)} {}
+
+    /**
+     * Returns a copy of the underlying view.
+     */
+    constexpr V base () const& requires std::copy_constructible<V> {
+        return members_.first();
+    }
+
+    /**
+     * @overload base()
+     */
+    constexpr V base () && { return exfs::move(members_.first()); }
+
+    constexpr iterator_<false> begin () {
+        return iterator_<false>{*this, ranges::begin(members_.first())};
+    }
+
+    constexpr iterator_<true> begin () const
+    requires (
+        range<V const> and
+        std::regular_invocable<F const&, range_reference_t<V const>>
+    ) {
+        return iterator_<true>{*this, ranges::begin(members_.first())};
+    }
+
+    constexpr auto end () {
+        if constexpr (common_range<V>) {
+            return iterator_<false>{*this, ranges::end(members_.first())};
+        } else {
+            return sentinel_<false>{ranges::end(members_.first())};
+        }
+    }
+
+    constexpr auto end () const
+    requires (
+        range<V const> and
+        std::regular_invocable<F const&, range_reference_t<V const>>
+    ) {
+        if constexpr (common_range<V const>) {
+            return iterator_<true>{*this, ranges::end(members_.first())};
+        } else {
+            return sentinel_<true>{ranges::end(members_.first())};
+        }
+    }
+
+    constexpr auto size () requires sized_range<V> {
+        return ranges::size(members_.first());
+    }
+
+    constexpr auto size () const requires sized_range<V const> {
+        return ranges::size(members_.first());
+    }
+
+  private:
+    compressed_pair<V, F> members_;
+};
+
+template <typename R, typename F>
+transform_view (R&&, F) -> transform_view<views::all_t<R>, F>;
+
+namespace __detail {
+struct __transform_fn {
+    template <viewable_range R, typename F>
+    requires requires (R&& r, F fn) {
+        transform_view(exfs::forward<R>(r), exfs::move(fn));
+    }
+    constexpr auto operator () (R&& r, F fn) const {
+        return transform_view(exfs::forward<R>(r), exfs::move(fn));
+    }
+
+    template <typename F>
+    constexpr auto operator () (F fn) const {
+        return range_adaptor_closure{
+            [fn = exfs::move(fn)] <viewable_range R> (R&& r)
+            requires requires (F const& f) {
+                transform_view(exfs::forward<R>(r), f);
+            } {
+                return transform_view(exfs::forward<R>(r), fn);
+            }
+        };
+    }
+};
+}  // namespace __detail
+
+namespace views {
+/**
+ * Adapts a range into a @c transform_view: `views::transform(r, fn)`, or
+ * `r | views::transform(fn)`.
+ */
+inline constexpr __detail::__transform_fn transform{};
+}  // namespace views
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_TRANSFORM_HPP_
@@ -0,0 +1,232 @@
+#include "exfs/ranges/transform.hpp"
+
+#include <concepts>
+#include <forward_list>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/static_vector.hpp"
+
+namespace {
+namespace ranges = exfs::ranges;
+namespace views = exfs::views;
+
+constexpr auto twice = [] (int x) { return 2 * x; };
+
+using Vector = exfs::static_vector<int, 8>;
+using Doubled = ranges::transform_view<
+    ranges::ref_view<Vector>,
+    decltype(twice)
+>;
+
+static_assert(ranges::random_access_range<Doubled>);
+static_assert(ranges::sized_range<Doubled>);
+static_assert(ranges::common_range<Doubled>);
+static_assert(not ranges::contiguous_range<Doubled>);
+static_assert(sizeof(Doubled) == sizeof(Vector*));
+static_assert(ranges::bidirectional_range<
+    ranges::transform_view<ranges::ref_view<std::list<int>>, decltype(twice)>
+>);
+
+constexpr int sum_of_doubles () {
+    int values[] = {1, 2, 3};
+    int sum = 0;
+    for (int x : values | views::transform(twice)) {
+        sum += x;
+    }
+    return sum;
+}
+static_assert(sum_of_doubles() == 12);
+
+// A non-common view whose mutable and const iterators each compare only with
+// the sentinel of the same constness.
+template <typename I>
+struct Exact_Sentinel {
+    I end;
+
+    template <std::same_as<I> J>
+    friend constexpr bool operator == (J const& it, Exact_Sentinel const& s) {
+        return it == s.end;
+    }
+};
+
+struct Const_Split_View : ranges::view_interface<Const_Split_View> {
+    int* first;
+    int* last;
+
+    constexpr int* begin () { return first; }
+    constexpr int const* begin () const { return first; }
+    constexpr Exact_Sentinel<int*> end () { return {last}; }
+    constexpr Exact_Sentinel<int const*> end () const { return {last}; }
+};
+
+template <typename I, typename S>
+concept comparable_with_sentinel = requires (I const& it, S const& s) {
+    it == s;
+};
+
+template <typename R>
+constexpr bool compares_only_with_same_constness =
+    comparable_with_sentinel<ranges::iterator_t<R>, ranges::sentinel_t<R>> and
+    comparable_with_sentinel<
+        ranges::iterator_t<R const>,
+        ranges::sentinel_t<R const>
+    > and
+    not comparable_with_sentinel<
+        ranges::iterator_t<R const>,
+        ranges::sentinel_t<R>
+    > and
+    not comparable_with_sentinel<
+        ranges::iterator_t<R>,
+        ranges::sentinel_t<R const>
+    >;
+
+static_assert(not ranges::common_range<Const_Split_View>);
+static_assert(compares_only_with_same_constness<
+    ranges::transform_view<Const_Split_View, decltype(twice)>
+>);
+
+struct Point {
+    int x;
+    int y;
+
+    int sum () const { return x + y; }
+};
+}  // namespace
+
+SCENARIO (
+    "exfs::views::transform",
+    "[unit][ranges]"
+) {
+    GIVEN ("a static_vector") {
+        Vector values{{1, 2, 3, 4}};
+
+        WHEN ("it is transformed") {
+            auto view = views::transform(values, twice);
+
+            THEN ("the elements are computed on access") {
+                CHECK(std::vector<int>(view.begin(), view.end())
+                    == std::vector<int>{2, 4, 6, 8});
+                CHECK(view.size() == 4u);
+                CHECK(view[2] == 6);
+                CHECK(view.back() == 8);
+                CHECK(view.end() - view.begin() == 4);
+            }
+
+            THEN ("changes to the vector are visible through the view") {
+                values[0] = 10;
+                CHECK(view.front() == 20);
+            }
+
+            THEN ("the iterators support random access") {
+                auto it = view.begin() + 3;
+                CHECK(*it == 8);
+                CHECK(*--it == 6);
+                CHECK(it[-2] == 2);
+                CHECK(view.begin() < it);
+            }
+        }
+
+        WHEN ("the function returns a reference") {
+            auto view = values | views::transform([] (int& x) -> int& {
+                return x;
+            });
+            for (int& x : view) {
+                x += 1;
+            }
+
+            THEN ("the elements can be written through the view") {
+                CHECK(values[0] == 2);
+                CHECK(values[3] == 5);
+            }
+        }
+    }
+
+    GIVEN ("a forward list, which is not sized") {
+        std::forward_list<std::string> words{"a", "bb", "ccc"};
+
+        WHEN ("it is transformed") {
+            auto view = words | views::transform([] (std::string const& s) {
+                return s.size();
+            });
+
+            THEN ("the view is iterated to its end") {
+                CHECK(std::vector<std::size_t>(view.begin(), view.end())
+                    == std::vector<std::size_t>{1u, 2u, 3u});
+            }
+        }
+    }
+
+    GIVEN ("a function with state") {
+        int const offset = 5;
+        auto add = [offset] (int x) { return x + offset; };
+        int values[] = {1, 2};
+
+        WHEN ("it is used through a const view") {
+            auto const view = values | views::transform(add);
+
+            THEN ("it is applied") {
+                CHECK(view[0] == 6);
+                CHECK(view[1] == 7);
+            }
+        }
+    }
+
+    GIVEN ("a pointer to a data member") {
+        Point points[] = {{1, 2}, {3, 4}};
+
+        WHEN ("it is used as the function") {
+            auto view = points | views::transform(&Point::y);
+
+            THEN ("it projects the member of each element") {
+                CHECK(view[0] == 2);
+                CHECK(view[1] == 4);
+            }
+
+            THEN ("the member can be written through the view") {
+                view[1] = 7;
+                CHECK(points[1].y == 7);
+            }
+        }
+    }
+
+    GIVEN ("a pointer to a member function") {
+        Point points[] = {{1, 2}, {3, 4}};
+
+        WHEN ("it is used as the function") {
+            auto view = ranges::transform_view(points, &Point::sum);
+
+            THEN ("it is called on each element") {
+                CHECK(std::vector<int>(view.begin(), view.end())
+                    == std::vector<int>{3, 7});
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::views - adaptor composition",
+    "[unit][ranges]"
+) {
+    GIVEN ("a static_vector") {
+        Vector values{{1, 2, 3, 4, 5}};
+
+        WHEN ("adaptors are composed before they are applied") {
+            auto const quadruple = views::transform(twice) |
+                views::transform(twice);
+            auto view = values | quadruple;
+
+            THEN ("the result is the same as applying them in turn") {
+                auto expected = values | views::transform(twice) |
+                    views::transform(twice);
+                CHECK(std::vector<int>(view.begin(), view.end())
+                    == std::vector<int>(expected.begin(), expected.end()));
+                CHECK(view[4] == 20);
+            }
+        }
+    }
+}
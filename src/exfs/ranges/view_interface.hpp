@@ -0,0 +1,164 @@
+#ifndef EXFS_RANGES_VIEW_INTERFACE_HPP_
+#define EXFS_RANGES_VIEW_INTERFACE_HPP_
+
+#include <concepts>
+#include <memory>
+#include <type_traits>
+
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/concepts.hpp"
+
+namespace exfs::ranges {
+/**
+ * Base class template for defining views with the curiously recurring template
+ * pattern. A derived class @p D needs only to provide @c begin() and @c end();
+ * @c view_interface then derives the remaining members from whatever its
+ * iterators support.
+ *
+ * @tparam D The derived view type.
+ */
+template <typename D>
+requires std::is_class_v<D> and std::same_as<D, std::remove_cv_t<D>>
+class view_interface {
+    constexpr D& derived_ () noexcept {
+        return static_cast<D&>(*this);
+    }
+
+    constexpr D const& derived_ () const noexcept {
+        return static_cast<D const&>(*this);
+    }
+
+  public:
+    /**
+     * Checks whether the view has no elements.
+     */
+    constexpr bool empty () requires forward_range<D> {
+        return ranges::begin(derived_()) == ranges::end(derived_());
+    }
+
+    /**
+     * @overload empty()
+     */
+    constexpr bool empty () const requires forward_range<D const> {
+        return ranges::begin(derived_()) == ranges::end(derived_());
+    }
+
+    /**
+     * Checks whether the view has elements.
+     */
+    constexpr explicit operator bool () requires forward_range<D> {
+        return not empty();
+    }
+
+    /**
+     * @overload operator bool()
+     */
+    constexpr explicit operator bool () const
+    requires forward_range<D const> {
+        return not empty();
+    }
+
+    /**
+     * Returns a pointer to the first element of a contiguous view.
+     */
+    constexpr auto data ()
+    requires iterator::contiguous_iterator<iterator_t<D>> {
+        return std::to_address(ranges::begin(derived_()));
+    }
+
+    /**
+     * @overload data()
+     */
+    constexpr auto data () const
+    requires (
+        range<D const> and
+        iterator::contiguous_iterator<iterator_t<D const>>
+    ) {
+        return std::to_address(ranges::begin(derived_()));
+    }
+
+    /**
+     * Returns the number of elements in the view, when its sentinel can be
+     * subtracted from its iterator.
+     */
+    constexpr auto size ()
+    requires (
+        forward_range<D> and
+        iterator::sized_sentinel_for<sentinel_t<D>, iterator_t<D>>
+    ) {
+        return static_cast<std::make_unsigned_t<range_difference_t<D>>>(
+            ranges::end(derived_()) - ranges::begin(derived_())
+        );
+    }
+
+    /**
+     * @overload size()
+     */
+    constexpr auto size () const
+    requires (
+        forward_range<D const> and
+        iterator::sized_sentinel_for<sentinel_t<D const>, iterator_t<D const>>
+    ) {
+        return static_cast<std::make_unsigned_t<range_difference_t<D const>>>(
+            ranges::end(derived_()) - ranges::begin(derived_())
+        );
+    }
+
+    /**
+     * Returns the first element of the view.
+     *
+     * @warning Calling @c front() on an empty view is undefined behavior.
+     */
+    constexpr decltype(auto) front () requires forward_range<D> {
+        return *ranges::begin(derived_());
+    }
+
+    /**
+     * @overload front()
+     */
+    constexpr decltype(auto) front () const requires forward_range<D const> {
+        return *ranges::begin(derived_());
+    }
+
+    /**
+     * Returns the last element of the view.
+     *
+     * @warning Calling @c back() on an empty view is undefined behavior.
+     */
+    constexpr decltype(auto) back ()
+    requires bidirectional_range<D> and common_range<D> {
+        auto last = ranges::end(derived_());
+        return *--last;
+    }
+
+    /**
+     * @overload back()
+     */
+    constexpr decltype(auto) back () const
+    requires bidirectional_range<D const> and common_range<D const> {
+        auto last = ranges::end(derived_());
+        return *--last;
+    }
+
+    /**
+     * Returns the element at offset @p n of a random-access view.
+     *
+     * @warning Accessing a nonexistent element is undefined behavior.
+     */
+    template <random_access_range R = D>
+    constexpr decltype(auto) operator [] (range_difference_t<R> n) {
+        return ranges::begin(derived_())[n];
+    }
+
+    /**
+     * @overload operator[]()
+     */
+    template <random_access_range R = D const>
+    constexpr decltype(auto) operator [] (range_difference_t<R> n) const {
+        return ranges::begin(derived_())[n];
+    }
+};
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_VIEW_INTERFACE_HPP_
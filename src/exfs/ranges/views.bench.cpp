@@ -0,0 +1,120 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/ranges/filter.hpp"
+#include "exfs/ranges/take.hpp"
+#include "exfs/ranges/transform.hpp"
+#include "exfs/ranges/zip.hpp"
+#include "exfs/static_vector.hpp"
+
+namespace {
+// The same pipeline is computed lazily, as a single pass through a chain of
+// views, and eagerly, as one pass per stage through intermediate
+// static_vectors as a hand-written embedded loop would.
+constexpr std::size_t capacity = 1024u;
+
+using Samples = exfs::static_vector<std::int32_t, capacity>;
+using Gains = exfs::static_vector<std::int32_t, capacity>;
+
+constexpr auto is_positive = [] (std::int32_t x) { return x > 0; };
+constexpr auto square = [] (std::int32_t x) { return x * x; };
+
+void fill_samples (Samples& samples, Gains& gains) {
+    std::uint32_t state = 0x12345678u;
+    for (std::size_t i = 0u; i < capacity; ++i) {
+        state = state * 1664525u + 1013904223u;
+        samples.push_back(static_cast<std::int32_t>(state >> 24) - 128);
+        gains.push_back(static_cast<std::int32_t>(i % 7u));
+    }
+}
+
+void filter_transform_lazy (benchmark::State& state) {
+    Samples samples;
+    Gains gains;
+    fill_samples(samples, gains);
+    auto const count = state.range(0);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(samples.data());
+        std::int64_t sum = 0;
+        for (std::int32_t x : samples |
+            exfs::views::filter(is_positive) |
+            exfs::views::transform(square) |
+            exfs::views::take(count)
+        ) {
+            sum += x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(filter_transform_lazy)->Arg(64)->Arg(512);
+
+void filter_transform_eager (benchmark::State& state) {
+    Samples samples;
+    Gains gains;
+    fill_samples(samples, gains);
+    auto const count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(samples.data());
+        Samples positive;
+        for (std::int32_t x : samples) {
+            if (is_positive(x)) {
+                positive.push_back(x);
+            }
+        }
+        Samples squared;
+        for (std::int32_t x : positive) {
+            squared.push_back(square(x));
+        }
+        std::int64_t sum = 0;
+        for (std::size_t i = 0u; i < count and i < squared.size(); ++i) {
+            sum += squared[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(filter_transform_eager)->Arg(64)->Arg(512);
+
+void zip_dot_lazy (benchmark::State& state) {
+    Samples samples;
+    Gains gains;
+    fill_samples(samples, gains);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(samples.data());
+        std::int64_t sum = 0;
+        for (std::int32_t product : exfs::views::zip(samples, gains) |
+            exfs::views::transform([] (auto const& t) {
+                return exfs::get<0>(t) * exfs::get<1>(t);
+            })
+        ) {
+            sum += product;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(zip_dot_lazy);
+
+void zip_dot_eager (benchmark::State& state) {
+    Samples samples;
+    Gains gains;
+    fill_samples(samples, gains);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(samples.data());
+        Samples products;
+        for (std::size_t i = 0u; i < samples.size(); ++i) {
+            products.push_back(samples[i] * gains[i]);
+        }
+        std::int64_t sum = 0;
+        for (std::int32_t product : products) {
+            sum += product;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(zip_dot_eager);
+}  // namespace
@@ -0,0 +1,388 @@
+#ifndef EXFS_RANGES_ZIP_HPP_
+#define EXFS_RANGES_ZIP_HPP_
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/ranges/access.hpp"
+#include "exfs/ranges/all.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/view_interface.hpp"
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/integer_sequence.hpp"
+#include "exfs/utility/tuple.hpp"
+
+namespace exfs::ranges {
+namespace __detail {
+template <bool is_const, typename... Vs>
+concept __all_random_access =
+    (random_access_range<__maybe_const_t<is_const, Vs>> and ...);
+
+template <bool is_const, typename... Vs>
+concept __all_bidirectional =
+    (bidirectional_range<__maybe_const_t<is_const, Vs>> and ...);
+
+template <bool is_const, typename... Vs>
+concept __all_forward =
+    (forward_range<__maybe_const_t<is_const, Vs>> and ...);
+
+// The end of a zip of Vs can be computed as an iterator, in constant time,
+// from the size of its shortest range.
+template <bool is_const, typename... Vs>
+concept __zip_common =
+    (__sliceable<__maybe_const_t<is_const, Vs>> and ...);
+
+// Calls `fn(get<I>(ts)...)` for each index I of the tuples ts, in order.
+template <typename Fn, typename... Tuples>
+constexpr void __for_each_element (Fn&& fn, Tuples&... ts) {
+    constexpr std::size_t size = std::tuple_size_v<
+        std::remove_cv_t<exfs::__detail::__nth_type_t<0u, Tuples...>>
+    >;
+    auto const call_at = [&]<std::size_t I> (
+        std::integral_constant<std::size_t, I>
+    ) {
+        fn(exfs::get<I>(ts)...);
+    };
+    [&]<std::size_t... Is> (index_sequence<Is...>) {
+        (call_at(std::integral_constant<std::size_t, Is>{}), ...);
+    }(make_index_sequence<size>{});
+}
+
+// Returns `tuple<R...>{fn(get<I>(t))...}`.
+template <typename... Rs, typename Fn, typename Tuple>
+constexpr tuple<Rs...> __transform_elements (Fn&& fn, Tuple&& t) {
+    return [&]<std::size_t... Is> (index_sequence<Is...>) {
+        return tuple<Rs...>(fn(exfs::get<Is>(exfs::forward<Tuple>(t)))...);
+    }(index_sequence_for<Rs...>{});
+}
+}  // namespace __detail
+
+/**
+ * A @c view of tuples of the corresponding elements of several underlying
+ * views, as long as the shortest of them. Dereferencing a zip iterator yields
+ * an @c exfs::tuple of references into the underlying views, so that parallel
+ * buffers can be processed in a single loop without copying them into an
+ * array of structures.
+ *
+ * The view has the strongest iterator category which all the underlying views
+ * share, capped at random access. When all of them are random access and
+ * sized, the view is sized and its end is an iterator computed in constant
+ * time.
+ *
+ * @tparam Vs The underlying views.
+ */
+template <input_range... Vs>
+requires (sizeof...(Vs) > 0u and (view<Vs> and ...))
+class zip_view : public view_interface<zip_view<Vs...>> {
+    template <bool is_const>
+    class sentinel_;
+
+    template <bool is_const>
+    class iterator_ {
+        friend class zip_view;
+
+        using iterators_ = tuple<iterator_t<
+            __detail::__maybe_const_t<is_const, Vs>
+        >...>;
+
+      public:
+        using iterator_concept  = std::conditional_t<
+            __detail::__all_random_access<is_const, Vs...>,
+            iterator::random_access_iterator_tag,
+            std::conditional_t<
+                __detail::__all_bidirectional<is_const, Vs...>,
+                iterator::bidirectional_iterator_tag,
+                std::conditional_t<
+                    __detail::__all_forward<is_const, Vs...>,
+                    iterator::forward_iterator_tag,
+                    iterator::input_iterator_tag
+                >
+            >
+        >;
+        using iterator_category = iterator::input_iterator_tag;
+        using value_type        = tuple<
+            range_value_t<__detail::__maybe_const_t<is_const, Vs>>...
+        >;
+        using difference_type   = std::common_type_t<
+            range_difference_t<__detail::__maybe_const_t<is_const, Vs>>...
+        >;
+        using pointer           = void;
+        using reference         = tuple<
+            range_reference_t<__detail::__maybe_const_t<is_const, Vs>>...
+        >;
+
+        iterator_ () = default;
+
+        constexpr explicit iterator_ (iterators_ current)
+              : current_{exfs::move(current)} {}
+
+        template <bool other_const>
+        requires (
+            is_const and
+            not other_const and
+            (std::convertible_to<
+                iterator_t<Vs>,
+                iterator_t<Vs const>
+            > and ...)
+        )
+        constexpr iterator_ (iterator_<other_const> other)
+              : current_{exfs::move(other.current_)} {}
+
+        constexpr reference operator * () const {
+            return __detail::__transform_elements<
+                range_reference_t<__detail::__maybe_const_t<is_const, Vs>>...
+            >([] (auto const& it) -> decltype(auto) {
+                return *it;
+            }, current_);
+        }
+
+        constexpr reference operator [] (difference_type n) const
+        requires __detail::__all_random_access<is_const, Vs...> {
+            return *(*this + n);
+        }
+
+        constexpr iterator_& operator ++ () {
+            __detail::__for_each_element([] (auto& it) { ++it; }, current_);
+            return *this;
+        }
+
+        constexpr void operator ++ (int) { ++*this; }
+
+        constexpr iterator_ operator ++ (int)
+        requires __detail::__all_forward<is_const, Vs...> {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        constexpr iterator_& operator -- ()
+        requires __detail::__all_bidirectional<is_const, Vs...> {
+            __detail::__for_each_element([] (auto& it) { --it; }, current_);
+            return *this;
+        }
+
+        constexpr iterator_ operator -- (int)
+        requires __detail::__all_bidirectional<is_const, Vs...> {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        constexpr iterator_& operator += (difference_type n)
+        requires __detail::__all_random_access<is_const, Vs...> {
+            __detail::__for_each_element([n] (auto& it) {
+                it += static_cast<iterator::iter_difference_t<
+                    std::remove_reference_t<decltype(it)>
+                >>(n);
+            }, current_);
+            return *this;
+        }
+
+        constexpr iterator_& operator -= (difference_type n)
+        requires __detail::__all_random_access<is_const, Vs...> {
+            return *this += -n;
+        }
+
+        friend constexpr iterator_ operator + (iterator_ it, difference_type n)
+        requires __detail::__all_random_access<is_const, Vs...> {
+            return it += n;
+        }
+
+        friend constexpr iterator_ operator + (difference_type n, iterator_ it)
+        requires __detail::__all_random_access<is_const, Vs...> {
+            return it += n;
+        }
+
+        friend constexpr iterator_ operator - (iterator_ it, difference_type n)
+        requires __detail::__all_random_access<is_const, Vs...> {
+            return it -= n;
+        }
+
+        // All the underlying iterators move in lockstep, so the distance
+        // between two zip iterators is that between their first iterators.
+        friend constexpr difference_type operator - (
+            iterator_ const& a,
+            iterator_ const& b
+        ) requires __detail::__all_random_access<is_const, Vs...> {
+            return static_cast<difference_type>(
+                exfs::get<0u>(a.current_) - exfs::get<0u>(b.current_)
+            );
+        }
+
+        friend constexpr bool operator == (
+            iterator_ const& a,
+            iterator_ const& b
+        ) requires __detail::__all_forward<is_const, Vs...> {
+            return exfs::get<0u>(a.current_) == exfs::get<0u>(b.current_);
+        }
+
+        friend constexpr auto operator <=> (
+            iterator_ const& a,
+            iterator_ const& b
+        ) requires __detail::__all_random_access<is_const, Vs...> {
+            auto const distance = a - b;
+            if (distance < 0) {
+                return std::strong_ordering::less;
+            }
+            if (distance > 0) {
+                return std::strong_ordering::greater;
+            }
+            return std::strong_ordering::equal;
+        }
+
+        friend constexpr auto iter_move (iterator_ const& it) {
+            return __detail::__transform_elements<
+                range_rvalue_reference_t<
+                    __detail::__maybe_const_t<is_const, Vs>
+                >...
+            >(iterator::iter_move, it.current_);
+        }
+
+      private:
+        iterators_ current_{};
+    };
+
+    template <bool is_const>
+    class sentinel_ {
+        using sentinels_ = tuple<sentinel_t<
+            __detail::__maybe_const_t<is_const, Vs>
+        >...>;
+
+      public:
+        sentinel_ () = default;
+
+        constexpr explicit sentinel_ (sentinels_ end)
+              : end_{exfs::move(end)} {}
+
+        template <bool other_const>
+        requires (iterator::sentinel_for<
+            sentinel_t<__detail::__maybe_const_t<is_const, Vs>>,
+            iterator_t<__detail::__maybe_const_t<other_const, Vs>>
+        > and ...)
+        friend constexpr bool operator == (
+            iterator_<other_const> const& it,
+            sentinel_ const& s
+        ) {
+            return s.reached_by_(it);
+        }
+
+      private:
+        // The zip ends as soon as any of the underlying ranges ends.
+        template <bool other_const>
+        constexpr bool reached_by_ (iterator_<other_const> const& it) const {
+            bool at_end = false;
+            __detail::__for_each_element(
+                [&at_end] (auto const& iter, auto const& end) {
+                    at_end = at_end or iter == end;
+                },
+                it.current_,
+                end_
+            );
+            return at_end;
+        }
+
+        sentinels_ end_{};
+    };
+
+  public:
+    /**
+     * Constructs a view zipping the elements of @p views....
+     */
+    constexpr explicit zip_view (Vs... views)
+          : views_{exfs::move(views)...} {}
+
+    constexpr auto begin () { return begin_(views_); }
+
+    constexpr auto begin () const requires (range<Vs const> and ...) {
+        return begin_(views_);
+    }
+
+    constexpr auto end () { return end_(views_); }
+
+    constexpr auto end () const requires (range<Vs const> and ...) {
+        return end_(views_);
+    }
+
+    constexpr auto size () requires (sized_range<Vs> and ...) {
+        return size_(views_);
+    }
+
+    constexpr auto size () const requires (sized_range<Vs const> and ...) {
+        return size_(views_);
+    }
+
+  private:
+    template <typename Views>
+    static constexpr bool is_const_ =
+        std::is_const_v<std::remove_reference_t<Views>>;
+
+    template <typename Views>
+    static constexpr auto size_ (Views& views) {
+        using size_type = std::make_unsigned_t<std::common_type_t<
+            range_difference_t<
+                __detail::__maybe_const_t<is_const_<Views>, Vs>
+            >...
+        >>;
+        bool first = true;
+        size_type min = 0u;
+        __detail::__for_each_element([&] (auto& view) {
+            auto const size = static_cast<size_type>(ranges::size(view));
+            min = first or size < min ? size : min;
+            first = false;
+        }, views);
+        return min;
+    }
+
+    template <typename Views>
+    static constexpr auto begin_ (Views& views) {
+        constexpr bool is_const = is_const_<Views>;
+        return iterator_<is_const>{__detail::__transform_elements<
+            iterator_t<__detail::__maybe_const_t<is_const, Vs>>...
+        >(ranges::begin, views)};
+    }
+
+    template <typename Views>
+    static constexpr auto end_ (Views& views) {
+        constexpr bool is_const = is_const_<Views>;
+        if constexpr (__detail::__zip_common<is_const, Vs...>) {
+            using difference_type =
+                typename iterator_<is_const>::difference_type;
+            return begin_(views) + static_cast<difference_type>(size_(views));
+        } else {
+            return sentinel_<is_const>{__detail::__transform_elements<
+                sentinel_t<__detail::__maybe_const_t<is_const, Vs>>...
+            >(ranges::end, views)};
+        }
+    }
+
+    tuple<Vs...> views_;
+};
+
+template <typename... Rs>
+zip_view (Rs&&...) -> zip_view<views::all_t<Rs>...>;
+
+namespace __detail {
+struct __zip_fn {
+    template <viewable_range... Rs>
+    requires (sizeof...(Rs) > 0u)
+    constexpr auto operator () (Rs&&... rs) const {
+        return zip_view(exfs::forward<Rs>(rs)...);
+    }
+};
+}  // namespace __detail
+
+namespace views {
+/**
+ * Zips ranges into a @c zip_view: `views::zip(a, b, c)`. The result can be
+ * piped into further adaptors.
+ */
+inline constexpr __detail::__zip_fn zip{};
+}  // namespace views
+}  // namespace exfs::ranges
+
+#endif  // EXFS_RANGES_ZIP_HPP_
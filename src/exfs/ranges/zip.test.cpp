@@ -0,0 +1,224 @@
+#include "exfs/ranges/zip.hpp"
+
+#include <concepts>
+#include <forward_list>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/iter_move.hpp"
+#include "exfs/ranges/concepts.hpp"
+#include "exfs/ranges/filter.hpp"
+#include "exfs/ranges/take.hpp"
+#include "exfs/ranges/transform.hpp"
+#include "exfs/static_vector.hpp"
+
+namespace {
+namespace ranges = exfs::ranges;
+namespace views = exfs::views;
+
+using Ints = exfs::static_vector<int, 8>;
+using Floats = exfs::static_vector<float, 8>;
+using Zipped = ranges::zip_view<
+    ranges::ref_view<Ints>,
+    ranges::ref_view<Floats>
+>;
+using Zipped_List = ranges::zip_view<
+    ranges::ref_view<std::list<int>>,
+    ranges::ref_view<Ints>
+>;
+
+static_assert(ranges::random_access_range<Zipped>);
+static_assert(ranges::random_access_range<Zipped const>);
+static_assert(ranges::sized_range<Zipped>);
+static_assert(ranges::common_range<Zipped>);
+static_assert(std::is_same_v<
+    ranges::range_reference_t<Zipped>,
+    exfs::tuple<int&, float&>
+>);
+static_assert(std::is_same_v<
+    ranges::range_reference_t<Zipped const>,
+    exfs::tuple<int&, float&>
+>);
+static_assert(std::is_same_v<
+    ranges::range_value_t<Zipped>,
+    exfs::tuple<int, float>
+>);
+static_assert(std::is_same_v<
+    ranges::range_rvalue_reference_t<Zipped>,
+    exfs::tuple<int&&, float&&>
+>);
+static_assert(sizeof(Zipped) == 2u * sizeof(void*));
+
+static_assert(ranges::bidirectional_range<Zipped_List>);
+static_assert(not ranges::random_access_range<Zipped_List>);
+static_assert(not ranges::common_range<Zipped_List>);
+static_assert(ranges::forward_range<ranges::zip_view<
+    ranges::ref_view<std::forward_list<int>>,
+    ranges::ref_view<Ints>
+>>);
+
+// A non-common view whose mutable and const iterators each compare only with
+// the sentinel of the same constness.
+template <typename I>
+struct Exact_Sentinel {
+    I end;
+
+    template <std::same_as<I> J>
+    friend constexpr bool operator == (J const& it, Exact_Sentinel const& s) {
+        return it == s.end;
+    }
+};
+
+struct Const_Split_View : ranges::view_interface<Const_Split_View> {
+    int* first;
+    int* last;
+
+    constexpr int* begin () { return first; }
+    constexpr int const* begin () const { return first; }
+    constexpr Exact_Sentinel<int*> end () { return {last}; }
+    constexpr Exact_Sentinel<int const*> end () const { return {last}; }
+};
+
+template <typename I, typename S>
+concept comparable_with_sentinel = requires (I const& it, S const& s) {
+    it == s;
+};
+
+template <typename R>
+constexpr bool compares_only_with_same_constness =
+    comparable_with_sentinel<ranges::iterator_t<R>, ranges::sentinel_t<R>> and
+    comparable_with_sentinel<
+        ranges::iterator_t<R const>,
+        ranges::sentinel_t<R const>
+    > and
+    not comparable_with_sentinel<
+        ranges::iterator_t<R const>,
+        ranges::sentinel_t<R>
+    > and
+    not comparable_with_sentinel<
+        ranges::iterator_t<R>,
+        ranges::sentinel_t<R const>
+    >;
+
+static_assert(compares_only_with_same_constness<
+    ranges::zip_view<Const_Split_View, ranges::ref_view<Ints>>
+>);
+
+constexpr int dot_product () {
+    int a[] = {1, 2, 3};
+    int b[] = {4, 5, 6, 7};
+    int sum = 0;
+    for (auto [x, y] : views::zip(a, b)) {
+        sum += x * y;
+    }
+    return sum;
+}
+static_assert(dot_product() == 32);
+}  // namespace
+
+SCENARIO (
+    "exfs::views::zip",
+    "[unit][ranges]"
+) {
+    GIVEN ("parallel buffers of different lengths") {
+        Ints ints{{1, 2, 3, 4}};
+        Floats floats{{0.5f, 1.5f, 2.5f}};
+
+        WHEN ("they are zipped") {
+            auto view = views::zip(ints, floats);
+
+            THEN ("the view is as long as the shortest buffer") {
+                CHECK(view.size() == 3u);
+                CHECK(view.end() - view.begin() == 3);
+            }
+
+            THEN ("the elements are paired by position") {
+                auto [i, f] = view[2];
+                CHECK(i == 3);
+                CHECK(f == 2.5f);
+                CHECK(exfs::get<0>(view.back()) == 3);
+            }
+
+            THEN ("the buffers can be written through the view") {
+                for (auto [i, f] : view) {
+                    f += static_cast<float>(i);
+                }
+                CHECK(floats[0] == 1.5f);
+                CHECK(floats[2] == 5.5f);
+                CHECK(ints[3] == 4);
+            }
+
+            THEN ("the iterators support random access") {
+                auto it = view.begin();
+                it += 2;
+                CHECK(exfs::get<1>(*it) == 2.5f);
+                CHECK(exfs::get<0>(*(it - 1)) == 2);
+                CHECK(exfs::get<0>(it[-2]) == 1);
+                CHECK(view.begin() < it);
+                CHECK(it - view.begin() == 2);
+            }
+
+            THEN ("elements can be moved out of the view") {
+                auto moved = exfs::iterator::iter_move(view.begin());
+                CHECK(std::is_same_v<
+                    decltype(moved),
+                    exfs::tuple<int&&, float&&>
+                >);
+                CHECK(exfs::get<0>(moved) == 1);
+            }
+        }
+    }
+
+    GIVEN ("a list and a longer static_vector") {
+        std::list<std::string> names{"a", "b"};
+        Ints ints{{1, 2, 3}};
+
+        WHEN ("they are zipped") {
+            auto view = views::zip(names, ints);
+
+            THEN ("the iteration stops at the end of the list") {
+                std::vector<std::string> visited;
+                for (auto [name, i] : view) {
+                    visited.push_back(name + std::to_string(i));
+                }
+                CHECK(visited == std::vector<std::string>{"a1", "b2"});
+                CHECK(view.size() == 2u);
+            }
+
+            THEN ("the view can be iterated backward from an iterator") {
+                auto it = view.begin();
+                ++it;
+                --it;
+                CHECK(exfs::get<0>(*it) == "a");
+            }
+        }
+    }
+
+    GIVEN ("zipped buffers") {
+        Ints ints{{1, 2, 3, 4}};
+        Floats floats{{1.0f, 0.0f, 3.0f, 0.0f}};
+
+        WHEN ("further adaptors are applied") {
+            auto view = views::zip(ints, floats) |
+                views::filter([] (auto const& t) {
+                    return exfs::get<1>(t) != 0.0f;
+                }) |
+                views::transform([] (auto const& t) {
+                    return static_cast<float>(exfs::get<0>(t)) *
+                        exfs::get<1>(t);
+                }) |
+                views::take(5);
+
+            THEN ("they are applied to the tuples") {
+                std::vector<float> products;
+                for (float p : view) {
+                    products.push_back(p);
+                }
+                CHECK(products == std::vector<float>{1.0f, 9.0f});
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+#include "exfs/static_priority_queue.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/static_vector.hpp"
+#include "exfs/utility/comparison.hpp"
+
+namespace {
+constexpr std::size_t max_count = 1u << 16u;
+
+// Deadlines are pseudo-random so that the heap is exercised evenly.
+std::vector<std::uint32_t> const& deadlines () {
+    static std::vector<std::uint32_t> const values = [] {
+        std::vector<std::uint32_t> result(max_count);
+        std::uint32_t seed = 12345u;
+        for (auto& value : result) {
+            seed = seed * 1664525u + 1013904223u;
+            value = seed >> 4u;
+        }
+        return result;
+    }();
+    return values;
+}
+
+template <std::size_t Arity>
+using Queue = exfs::static_priority_queue<
+    std::uint32_t,
+    max_count,
+    exfs::greater,
+    Arity
+>;
+
+// Pushes `count` deadlines and then pops them all.
+template <std::size_t Arity>
+void push_pop (benchmark::State& state) {
+    static Queue<Arity> queue{};
+    auto const count = static_cast<std::size_t>(state.range(0));
+    auto const& values = deadlines();
+
+    for (auto _ : state) {
+        for (std::size_t idx = 0u; idx < count; ++idx) {
+            queue.push(values[idx]);
+        }
+        while (not queue.empty()) {
+            benchmark::DoNotOptimize(queue.top());
+            queue.pop();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(push_pop<2u>)->RangeMultiplier(8)->Range(64, max_count);
+BENCHMARK(push_pop<4u>)->RangeMultiplier(8)->Range(64, max_count);
+BENCHMARK(push_pop<8u>)->RangeMultiplier(8)->Range(64, max_count);
+
+void push_pop_std (benchmark::State& state) {
+    auto const count = static_cast<std::size_t>(state.range(0));
+    auto const& values = deadlines();
+    std::vector<std::uint32_t> container;
+    container.reserve(count);
+    std::priority_queue<
+        std::uint32_t,
+        std::vector<std::uint32_t>,
+        std::greater<>
+    > queue{std::greater<>{}, std::move(container)};
+
+    for (auto _ : state) {
+        for (std::size_t idx = 0u; idx < count; ++idx) {
+            queue.push(values[idx]);
+        }
+        while (not queue.empty()) {
+            benchmark::DoNotOptimize(queue.top());
+            queue.pop();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(push_pop_std)->RangeMultiplier(8)->Range(64, max_count);
+
+// The approach being replaced: a vector kept sorted by inserting each element
+// at its position, with the earliest deadline at the back.
+void push_pop_sorted_vector (benchmark::State& state) {
+    static exfs::static_vector<std::uint32_t, max_count> sorted{};
+    auto const count = static_cast<std::size_t>(state.range(0));
+    auto const& values = deadlines();
+
+    for (auto _ : state) {
+        for (std::size_t idx = 0u; idx < count; ++idx) {
+            std::size_t pos = sorted.size();
+            sorted.push_back(values[idx]);
+            while (pos > 0u and sorted[pos - 1u] < values[idx]) {
+                sorted[pos] = sorted[pos - 1u];
+                --pos;
+            }
+            sorted[pos] = values[idx];
+        }
+        while (not sorted.empty()) {
+            benchmark::DoNotOptimize(sorted.back());
+            sorted.pop_back();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(push_pop_sorted_vector)->RangeMultiplier(8)->Range(64, 4096);
+
+// Builds a heap from a range in linear time.
+template <std::size_t Arity>
+void make_heap (benchmark::State& state) {
+    static Queue<Arity> queue{};
+    auto const count = static_cast<std::size_t>(state.range(0));
+    auto const& values = deadlines();
+
+    for (auto _ : state) {
+        queue.assign(values.data(), values.data() + count);
+        benchmark::DoNotOptimize(queue.top());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(make_heap<2u>)->RangeMultiplier(8)->Range(64, max_count);
+BENCHMARK(make_heap<4u>)->RangeMultiplier(8)->Range(64, max_count);
+BENCHMARK(make_heap<8u>)->RangeMultiplier(8)->Range(64, max_count);
+
+// Moves every element to an earlier deadline through its handle, as when
+// rescheduling work.
+template <std::size_t Arity>
+void decrease_key (benchmark::State& state) {
+    static Queue<Arity> queue{};
+    auto const count = static_cast<std::size_t>(state.range(0));
+    auto const& values = deadlines();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        queue.assign(values.data(), values.data() + count);
+        state.ResumeTiming();
+
+        for (std::size_t idx = 0u; idx < count; ++idx) {
+            auto const handle = typename Queue<Arity>::handle{idx};
+            queue.decrease_key(handle, queue[handle] / 2u);
+        }
+        benchmark::DoNotOptimize(queue.top());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(decrease_key<2u>)->RangeMultiplier(8)->Range(64, max_count);
+BENCHMARK(decrease_key<4u>)->RangeMultiplier(8)->Range(64, max_count);
+BENCHMARK(decrease_key<8u>)->RangeMultiplier(8)->Range(64, max_count);
+}  // namespace
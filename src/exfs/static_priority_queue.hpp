@@ -0,0 +1,538 @@
+#ifndef EXFS_STATIC_PRIORITY_QUEUE_HPP_
+#define EXFS_STATIC_PRIORITY_QUEUE_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/static_vector.hpp"
+#include "exfs/utility/comparison.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace exfs {
+namespace __detail {
+/**
+ * The smallest unsigned type able to represent every index in [0, count).
+ */
+template <std::size_t count>
+using __heap_index_t = std::conditional_t<
+    (count <= 0x100u),
+    std::uint8_t,
+    std::conditional_t<
+        (count <= 0x10000u),
+        std::uint16_t,
+        std::conditional_t<(count <= 0x100000000u), std::uint32_t, std::size_t>
+    >
+>;
+}  // namespace __detail
+
+/**
+ * Container adaptor providing constant time lookup of the largest (by default)
+ * element, at the expense of logarithmic insertion and extraction, without
+ * dynamic allocation.
+ *
+ * The elements are kept in a @c static_vector arranged as an implicit d-ary
+ * heap: the children of the element at position @c i are at positions
+ * `i * Arity + 1` through `i * Arity + Arity`. Compared to a binary heap, a
+ * wider heap is shallower, so insertion touches fewer elements, and the
+ * children compared during extraction are adjacent in memory, which results
+ * in fewer cache misses for large queues.
+ *
+ * Every element is associated with a @c handle which stays valid while the
+ * element is in the queue, regardless of how it moves within the heap. The
+ * handle can be used to change the priority of an element in place
+ * (@c decrease_key, @c update) or to remove it (@c erase) in logarithmic
+ * time. Handles are reused after their element is removed.
+ *
+ * As with @c std::priority_queue, @p Compare defines a strict weak ordering
+ * and the element which compares greatest is at the top. Use @c exfs::greater
+ * to make the smallest element (e.g. the earliest deadline) the top.
+ *
+ * @tparam T The type of the stored elements.
+ * @tparam N The maximum number of elements.
+ * @tparam Compare The comparison function object type.
+ * @tparam Arity The number of children of every node in the heap.
+ */
+template <
+    typename T,
+    std::size_t N,
+    typename Compare = exfs::less,
+    std::size_t Arity = 4u
+>
+requires (Arity >= 2u and std::is_move_constructible_v<T>)
+class static_priority_queue {
+    using index_type_ = __detail::__heap_index_t<N>;
+
+  public:
+    using container_type  = static_vector<T, N>;
+    using value_compare   = Compare;
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = value_type&;
+    using const_reference = value_type const&;
+
+    /**
+     * The number of children of every node in the heap.
+     */
+    static constexpr size_type arity = Arity;
+
+    /**
+     * Stable reference to an element in the queue.
+     *
+     * A handle is valid from when its element is inserted until it is removed
+     * from the queue. Handles are small (the smallest unsigned type able to
+     * index @p N elements) and may be stored in place of pointers.
+     */
+    class handle {
+      public:
+        /**
+         * Creates a handle from a raw index previously obtained from
+         * @c index().
+         *
+         * When a queue is built from a range, the element at offset @c i of
+         * the range has the handle with index @c i.
+         */
+        constexpr explicit handle (size_type index) noexcept
+              : index_{static_cast<index_type_>(index)} {}
+
+        /**
+         * Returns the raw index of the handle, in the range [0, @p N).
+         */
+        constexpr size_type index () const noexcept {
+            return index_;
+        }
+
+        friend constexpr bool operator == (handle, handle) noexcept = default;
+
+      private:
+        friend class static_priority_queue;
+
+        index_type_ index_;
+    };
+
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Default constructor. Constructs an empty queue.
+     */
+    constexpr static_priority_queue ()
+    noexcept(std::is_nothrow_default_constructible_v<Compare>)
+    requires (std::is_default_constructible_v<Compare>)
+          : static_priority_queue(Compare{}) {}
+
+    /**
+     * Constructs an empty queue which orders elements with @p compare.
+     *
+     * @param[in] compare The comparison function object.
+     */
+    constexpr explicit static_priority_queue (Compare const& compare)
+    noexcept(std::is_nothrow_copy_constructible_v<Compare>)
+          : compare_{compare} {
+        reset_handles_();
+    }
+
+    /**
+     * Constructs a queue with the contents of the range [first, sentinel).
+     * The heap is built bottom-up in linear time rather than by repeated
+     * insertion.
+     *
+     * @warning It is undefined behavior if `distance(first, sentinel)` is
+     *     greater than @p N.
+     *
+     * @param[in] first The first item in the range to copy.
+     * @param[in] sentinel The sentinel value of the range.
+     * @param[in] compare The comparison function object.
+     */
+    template <
+        exfs::iterator::input_iterator Iterator,
+        exfs::iterator::sentinel_for<Iterator> Sentinel
+    >
+    constexpr static_priority_queue (
+        Iterator first,
+        Sentinel sentinel,
+        Compare const& compare = Compare{}
+    ) : heap_(first, sentinel), compare_{compare} {
+        reset_handles_();
+        make_heap_();
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Replaces the contents of the queue with the range [first, sentinel),
+     * building the heap in linear time. All existing handles are invalidated
+     * and the element at offset @c i of the range has the handle with index
+     * @c i.
+     *
+     * @warning It is undefined behavior if `distance(first, sentinel)` is
+     *     greater than @p N.
+     *
+     * @param[in] first The first item in the range to copy.
+     * @param[in] sentinel The sentinel value of the range.
+     */
+    template <
+        exfs::iterator::input_iterator Iterator,
+        exfs::iterator::sentinel_for<Iterator> Sentinel
+    >
+    constexpr void assign (Iterator first, Sentinel sentinel) {
+        heap_.clear();
+        for (; first != sentinel; ++first) {
+            heap_.emplace_back(*first);
+        }
+        // Resetting every handle is a sequential pass over all N entries, so
+        // it is only worth it when most of the queue is filled.
+        if (heap_.size() * 4u >= N) {
+            reset_handles_();
+        } else {
+            for (size_type idx = 0u; idx < heap_.size(); ++idx) {
+                claim_handle_(idx);
+            }
+        }
+        make_heap_();
+    }
+
+    /**
+     * @name Element Access
+     * @{
+     */
+
+    /**
+     * Accesses the top element, i.e. the element which compares greatest.
+     *
+     * @warning Calling @c top() on an empty queue is undefined.
+     *
+     * @return A reference to the top element.
+     */
+    constexpr const_reference top () const noexcept {
+        return heap_[0u];
+    }
+
+    /**
+     * Returns the handle of the top element.
+     *
+     * @warning Calling @c top_handle() on an empty queue is undefined.
+     */
+    constexpr handle top_handle () const noexcept {
+        return handle{handle_at_[0u]};
+    }
+
+    /**
+     * Accesses the element referred to by @p h.
+     *
+     * @warning It is undefined behavior if @p h is not valid.
+     *
+     * @param[in] h The handle of the element.
+     * @return A reference to the element.
+     */
+    constexpr const_reference operator [] (handle h) const noexcept {
+        return heap_[position_of_[h.index_]];
+    }
+
+    /**
+     * Checks whether @p h refers to an element currently in the queue.
+     *
+     * Since handles are reused, this is only meaningful if @p h was valid
+     * at some point and no other element has been inserted since it was
+     * removed.
+     */
+    constexpr bool contains (handle h) const noexcept {
+        return position_of_[h.index_] < heap_.size();
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Size/Capacity
+     * @{
+     */
+
+    /**
+     * Checks if the queue has no elements.
+     * @return @c true if the queue is empty, @c false otherwise.
+     */
+    [[nodiscard]] constexpr bool empty () const noexcept {
+        return heap_.empty();
+    }
+
+    /**
+     * Returns the number of elements in the queue.
+     * @return The number of elements in the queue.
+     */
+    [[nodiscard]] constexpr size_type size () const noexcept {
+        return heap_.size();
+    }
+
+    /**
+     * Returns the maximum number of elements, which is always @p N.
+     */
+    static constexpr size_type capacity () noexcept { return N; }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Modifiers
+     * @{
+     */
+
+    /**
+     * Inserts an element constructed from @p args... and sorts the heap.
+     *
+     * @warning Calling this function when the queue is full is undefined
+     *     behavior.
+     *
+     * @param[in,out] args... Arguments to forward to the constructor of the
+     *     element.
+     *
+     * @return The handle of the inserted element.
+     */
+    template <typename... Args>
+    constexpr handle emplace (Args&&... args) {
+        size_type const pos = heap_.size();
+        index_type_ const h = handle_at_[pos];
+        heap_.emplace_back(exfs::forward<Args>(args)...);
+        sift_up_(pos);
+        return handle{h};
+    }
+
+    /**
+     * Inserts @p value and sorts the heap.
+     *
+     * @warning Calling this function when the queue is full is undefined
+     *     behavior.
+     *
+     * @param[in] value The value of the element to insert.
+     * @return The handle of the inserted element.
+     */
+    template <typename U>
+    requires (std::same_as<std::remove_cvref_t<U>, value_type>)
+    constexpr handle push (U&& value) {
+        return emplace(exfs::forward<U>(value));
+    }
+
+    /**
+     * Removes the top element. Its handle becomes invalid.
+     *
+     * @warning Calling this function on an empty queue is undefined behavior.
+     */
+    constexpr void pop () {
+        erase_at_(0u);
+    }
+
+    /**
+     * Removes the element referred to by @p h. The handle becomes invalid.
+     *
+     * @warning It is undefined behavior if @p h is not valid.
+     *
+     * @param[in] h The handle of the element to remove.
+     */
+    constexpr void erase (handle h) {
+        erase_at_(position_of_[h.index_]);
+    }
+
+    /**
+     * Raises the priority of the element referred to by @p h by replacing it
+     * with @p value. Only the path from the element towards the top of the
+     * heap is visited.
+     *
+     * The name follows the usual convention for min-heaps: with
+     * @c exfs::greater as @p Compare, the key of the element decreases.
+     *
+     * @warning It is undefined behavior if @p h is not valid or if the
+     *     current element compares greater than @p value.
+     *
+     * @param[in] h The handle of the element to change.
+     * @param[in] value The new value of the element.
+     */
+    template <typename U>
+    requires (std::is_assignable_v<value_type&, U>)
+    constexpr void decrease_key (handle h, U&& value) {
+        size_type const pos = position_of_[h.index_];
+        heap_[pos] = exfs::forward<U>(value);
+        sift_up_(pos);
+    }
+
+    /**
+     * Replaces the element referred to by @p h with @p value, which may have
+     * a higher or lower priority, and restores the heap.
+     *
+     * @warning It is undefined behavior if @p h is not valid.
+     *
+     * @param[in] h The handle of the element to change.
+     * @param[in] value The new value of the element.
+     */
+    template <typename U>
+    requires (std::is_assignable_v<value_type&, U>)
+    constexpr void update (handle h, U&& value) {
+        size_type const pos = position_of_[h.index_];
+        heap_[pos] = exfs::forward<U>(value);
+        restore_(pos);
+    }
+
+    /**
+     * Removes all elements. All handles are invalidated.
+     */
+    constexpr void clear () noexcept {
+        heap_.clear();
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Returns the comparison function object.
+     */
+    constexpr value_compare value_comp () const {
+        return compare_;
+    }
+
+  private:
+    constexpr void reset_handles_ () noexcept {
+        for (size_type idx = 0u; idx < N; ++idx) {
+            handle_at_[idx] = static_cast<index_type_>(idx);
+            position_of_[idx] = static_cast<index_type_>(idx);
+        }
+    }
+
+    // Swaps handles so that position `pos` has the handle with index `pos`.
+    // Handles stay a permutation of [0, N), so this only touches two entries
+    // instead of resetting every handle.
+    constexpr void claim_handle_ (size_type pos) noexcept {
+        index_type_ const other = handle_at_[pos];
+        size_type const from = position_of_[pos];
+        handle_at_[from] = other;
+        position_of_[other] = static_cast<index_type_>(from);
+        handle_at_[pos] = static_cast<index_type_>(pos);
+        position_of_[pos] = static_cast<index_type_>(pos);
+    }
+
+    // Places `value` with handle `h` at `pos`, which holds a moved-from
+    // element.
+    constexpr void place_ (size_type pos, T&& value, index_type_ h) {
+        heap_[pos] = exfs::move(value);
+        handle_at_[pos] = h;
+        position_of_[h] = static_cast<index_type_>(pos);
+    }
+
+    constexpr void move_entry_ (size_type from, size_type to) {
+        place_(to, exfs::move(heap_[from]), handle_at_[from]);
+    }
+
+    // Moves the element at `pos` towards the top while it compares greater
+    // than its parent. Parents are shifted down into the hole instead of
+    // swapping at every level.
+    constexpr void sift_up_ (size_type pos) {
+        if (pos == 0u) {
+            return;
+        }
+
+        size_type parent = (pos - 1u) / Arity;
+        if (not compare_(heap_[parent], heap_[pos])) {
+            return;
+        }
+
+        T value = exfs::move(heap_[pos]);
+        index_type_ const h = handle_at_[pos];
+        do {
+            move_entry_(parent, pos);
+            pos = parent;
+            parent = (pos - 1u) / Arity;
+        } while (pos > 0u and compare_(heap_[parent], value));
+        place_(pos, exfs::move(value), h);
+    }
+
+    // Moves the element at `pos` towards the bottom while any of its
+    // children compares greater than it.
+    constexpr void sift_down_ (size_type pos) {
+        size_type const count = heap_.size();
+        size_type child = select_child_(pos, count);
+        if (child == pos or not compare_(heap_[pos], heap_[child])) {
+            return;
+        }
+
+        T value = exfs::move(heap_[pos]);
+        index_type_ const h = handle_at_[pos];
+        do {
+            move_entry_(child, pos);
+            pos = child;
+            child = select_child_(pos, count);
+        } while (child != pos and compare_(value, heap_[child]));
+        place_(pos, exfs::move(value), h);
+    }
+
+    // Returns the position of the greatest child of `pos`, or `pos` if it
+    // is a leaf.
+    constexpr size_type select_child_ (size_type pos, size_type count) const {
+        size_type const first = pos * Arity + 1u;
+        if (first >= count) {
+            return pos;
+        }
+
+        size_type const last = count - first < Arity ? count : first + Arity;
+        size_type best = first;
+        for (size_type child = first + 1u; child < last; ++child) {
+            if (compare_(heap_[best], heap_[child])) {
+                best = child;
+            }
+        }
+        return best;
+    }
+
+    constexpr void restore_ (size_type pos) {
+        if (pos > 0u and compare_(heap_[(pos - 1u) / Arity], heap_[pos])) {
+            sift_up_(pos);
+        } else {
+            sift_down_(pos);
+        }
+    }
+
+    // Removes the element at `pos` by moving the last element into its place.
+    // The removed handle ends up just past the end, where the next insertion
+    // picks it up.
+    constexpr void erase_at_ (size_type pos) {
+        size_type const last = heap_.size() - 1u;
+        if (pos != last) {
+            index_type_ const h = handle_at_[pos];
+            move_entry_(last, pos);
+            handle_at_[last] = h;
+            position_of_[h] = static_cast<index_type_>(last);
+            heap_.pop_back();
+            restore_(pos);
+        } else {
+            heap_.pop_back();
+        }
+    }
+
+    // Floyd's bottom-up heap construction: sifting down every internal node,
+    // starting from the last, takes linear time in total.
+    constexpr void make_heap_ () {
+        size_type const count = heap_.size();
+        if (count < 2u) {
+            return;
+        }
+
+        size_type pos = (count - 2u) / Arity + 1u;
+        while (pos-- > 0u) {
+            sift_down_(pos);
+        }
+    }
+
+    container_type heap_;
+    index_type_ handle_at_[N];
+    index_type_ position_of_[N];
+    [[no_unique_address]] Compare compare_;
+};
+}  // namespace exfs
+
+#endif  // EXFS_STATIC_PRIORITY_QUEUE_HPP_
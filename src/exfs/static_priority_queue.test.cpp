@@ -0,0 +1,314 @@
+#include "exfs/static_priority_queue.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/utility/comparison.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace {
+std::vector<int> pseudo_random_values (std::size_t count) {
+    std::vector<int> values;
+    std::uint32_t seed = 2654435761u;
+    for (std::size_t idx = 0u; idx < count; ++idx) {
+        seed = seed * 1664525u + 1013904223u;
+        values.push_back(static_cast<int>((seed >> 8u) % 1000u));
+    }
+    return values;
+}
+
+template <typename Queue>
+std::vector<int> drain (Queue& queue) {
+    std::vector<int> result;
+    while (not queue.empty()) {
+        result.push_back(queue.top());
+        queue.pop();
+    }
+    return result;
+}
+
+struct Deadline {
+    std::uint32_t time;
+    std::string task;
+
+    friend bool operator < (Deadline const& a, Deadline const& b) {
+        return a.time < b.time;
+    }
+};
+
+struct Earlier_Deadline {
+    bool operator () (Deadline const& a, Deadline const& b) const {
+        return b < a;
+    }
+};
+}  // namespace
+
+TEST_CASE (
+    "exfs::static_priority_queue - type properties",
+    "[unit][static_priority_queue]"
+) {
+    using Queue = exfs::static_priority_queue<int, 100u>;
+
+    CHECK(std::is_same_v<Queue::value_type, int>);
+    CHECK(std::is_same_v<Queue::value_compare, exfs::less>);
+    CHECK(std::is_same_v<
+        Queue::container_type,
+        exfs::static_vector<int, 100u>
+    >);
+    CHECK(Queue::arity == 4u);
+    CHECK(Queue::capacity() == 100u);
+
+    // Handles use the smallest index type for the capacity.
+    CHECK(sizeof(Queue::handle) == 1u);
+    CHECK(sizeof(exfs::static_priority_queue<int, 256u>::handle) == 1u);
+    CHECK(sizeof(exfs::static_priority_queue<int, 257u>::handle) == 2u);
+    CHECK(sizeof(exfs::static_priority_queue<int, 70000u>::handle) == 4u);
+}
+
+TEMPLATE_TEST_CASE_SIG (
+    "exfs::static_priority_queue - ordering matches std::priority_queue",
+    "[unit][std-parity][static_priority_queue]",
+    ((std::size_t Arity), Arity),
+    2u, 3u, 4u, 8u
+) {
+    auto const values = pseudo_random_values(200u);
+
+    using Max_Queue =
+        exfs::static_priority_queue<int, 256u, exfs::less, Arity>;
+    using Min_Queue =
+        exfs::static_priority_queue<int, 256u, exfs::greater, Arity>;
+
+    GIVEN ("a max queue and a min queue filled by repeated insertion") {
+        Max_Queue max_queue{};
+        Min_Queue min_queue{};
+        std::priority_queue<int> std_max{};
+        std::priority_queue<int, std::vector<int>, std::greater<>> std_min{};
+
+        for (int value : values) {
+            max_queue.push(value);
+            min_queue.push(value);
+            std_max.push(value);
+            std_min.push(value);
+        }
+
+        THEN ("the elements are extracted in the same order") {
+            REQUIRE(max_queue.size() == values.size());
+            CHECK(drain(max_queue) == drain(std_max));
+            CHECK(drain(min_queue) == drain(std_min));
+            CHECK(max_queue.empty());
+        }
+    }
+
+    GIVEN ("a queue built from a range") {
+        Max_Queue queue{values.begin(), values.end()};
+
+        THEN ("the elements are extracted in sorted order") {
+            auto expected = values;
+            std::sort(expected.begin(), expected.end(), std::greater<>{});
+            CHECK(drain(queue) == expected);
+        }
+    }
+
+    GIVEN ("a queue where elements are interleaved with extraction") {
+        Max_Queue queue{};
+        std::priority_queue<int> std_queue{};
+
+        std::vector<int> popped;
+        std::vector<int> std_popped;
+        for (std::size_t idx = 0u; idx < values.size(); ++idx) {
+            queue.push(values[idx]);
+            std_queue.push(values[idx]);
+            if (idx % 3u == 2u) {
+                popped.push_back(queue.top());
+                queue.pop();
+                std_popped.push_back(std_queue.top());
+                std_queue.pop();
+            }
+        }
+
+        THEN ("the elements are extracted in the same order") {
+            CHECK(popped == std_popped);
+            CHECK(drain(queue) == drain(std_queue));
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::static_priority_queue - handles",
+    "[unit][static_priority_queue]"
+) {
+    using namespace std::literals::string_literals;
+    using Queue =
+        exfs::static_priority_queue<Deadline, 16u, Earlier_Deadline, 2u>;
+
+    GIVEN ("a queue of deadlines") {
+        Queue queue{};
+        auto const flush = queue.push(Deadline{50u, "flush"s});
+        auto const poll = queue.push(Deadline{20u, "poll"s});
+        auto const blink = queue.push(Deadline{30u, "blink"s});
+        auto const sleep = queue.push(Deadline{90u, "sleep"s});
+
+        THEN ("the earliest deadline is at the top") {
+            CHECK(queue.top().task == "poll");
+            CHECK(queue.top_handle() == poll);
+        }
+
+        THEN ("handles refer to their element wherever it is in the heap") {
+            CHECK(queue[flush].task == "flush");
+            CHECK(queue[poll].task == "poll");
+            CHECK(queue[blink].task == "blink");
+            CHECK(queue[sleep].task == "sleep");
+            CHECK(queue.contains(sleep));
+        }
+
+        WHEN ("the key of an element is decreased") {
+            queue.decrease_key(sleep, Deadline{10u, "sleep"s});
+
+            THEN ("it moves to the top") {
+                CHECK(queue.top_handle() == sleep);
+                CHECK(queue[sleep].time == 10u);
+                CHECK(queue[poll].task == "poll");
+            }
+        }
+
+        WHEN ("an element is updated to a later deadline") {
+            queue.update(poll, Deadline{70u, "poll"s});
+
+            THEN ("it moves down the heap") {
+                CHECK(queue.top().task == "blink");
+                CHECK(queue[poll].time == 70u);
+            }
+        }
+
+        WHEN ("an element is erased") {
+            queue.erase(blink);
+
+            THEN ("the remaining elements are unaffected") {
+                CHECK(queue.size() == 3u);
+                CHECK(not queue.contains(blink));
+                CHECK(queue[flush].task == "flush");
+                CHECK(queue[sleep].task == "sleep");
+            }
+
+            AND_WHEN ("a new element is inserted") {
+                auto const wake = queue.push(Deadline{5u, "wake"s});
+
+                THEN ("the handle is reused") {
+                    CHECK(wake == blink);
+                    CHECK(queue.top().task == "wake");
+                }
+            }
+        }
+
+        WHEN ("the top element is popped") {
+            queue.pop();
+
+            THEN ("its handle is invalidated") {
+                CHECK(not queue.contains(poll));
+                CHECK(queue.top_handle() == blink);
+            }
+        }
+    }
+
+    GIVEN ("a queue built from a range") {
+        using Int_Queue = exfs::static_priority_queue<int, 8u>;
+        std::vector<int> const values{5, 1, 9, 3, 7};
+        Int_Queue queue{values.begin(), values.end()};
+
+        THEN ("the handle of each element is its offset in the range") {
+            for (std::size_t idx = 0u; idx < values.size(); ++idx) {
+                CHECK(queue[Int_Queue::handle{idx}] == values[idx]);
+            }
+            CHECK(queue.top() == 9);
+        }
+
+        WHEN ("the queue is assigned a new range") {
+            std::vector<int> const others{4, 8};
+            queue.assign(others.begin(), others.end());
+
+            THEN ("the queue only holds the new elements") {
+                CHECK(queue.size() == 2u);
+                CHECK(queue.top() == 8);
+                CHECK(queue[Int_Queue::handle{0u}] == 4);
+            }
+        }
+    }
+
+    GIVEN ("a large queue whose handles have been shuffled") {
+        using Large_Queue = exfs::static_priority_queue<int, 64u>;
+        auto const values = pseudo_random_values(40u);
+        Large_Queue queue{};
+        for (int value : values) {
+            queue.push(value);
+        }
+        for (int idx = 0; idx < 25; ++idx) {
+            queue.pop();
+        }
+
+        WHEN ("a small range is assigned") {
+            std::vector<int> const others{6, 2, 8, 4};
+            queue.assign(others.begin(), others.end());
+
+            THEN ("the handle of each element is its offset in the range") {
+                for (std::size_t idx = 0u; idx < others.size(); ++idx) {
+                    CHECK(queue[Large_Queue::handle{idx}] == others[idx]);
+                }
+            }
+
+            AND_WHEN ("more elements are pushed") {
+                std::vector<std::size_t> handles;
+                for (int value : {5, 7, 1}) {
+                    handles.push_back(queue.push(value).index());
+                }
+
+                THEN ("every handle is distinct") {
+                    std::sort(handles.begin(), handles.end());
+                    CHECK(handles[0] >= others.size());
+                    CHECK(handles[0] != handles[1]);
+                    CHECK(handles[1] != handles[2]);
+                    CHECK(
+                        drain(queue) == std::vector<int>{8, 7, 6, 5, 4, 2, 1}
+                    );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::static_priority_queue - move-only elements",
+    "[unit][static_priority_queue]"
+) {
+    struct Less_Pointee {
+        bool operator () (
+            std::unique_ptr<int> const& a,
+            std::unique_ptr<int> const& b
+        ) const {
+            return *a < *b;
+        }
+    };
+
+    GIVEN ("a queue of unique pointers") {
+        exfs::static_priority_queue<std::unique_ptr<int>, 8u, Less_Pointee> q{};
+        for (int value : {3, 8, 1, 6}) {
+            q.emplace(std::make_unique<int>(value));
+        }
+
+        THEN ("elements are extracted in order") {
+            std::vector<int> result;
+            while (not q.empty()) {
+                result.push_back(*q.top());
+                q.pop();
+            }
+            CHECK(result == std::vector<int>{8, 6, 3, 1});
+        }
+    }
+}
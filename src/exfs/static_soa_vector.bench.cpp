@@ -0,0 +1,122 @@
+#include "exfs/static_soa_vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/static_vector.hpp"
+
+namespace {
+// A typical sensor record, of which a filter only reads one field. The kernel
+// counts the samples over a threshold, which the compiler can vectorize.
+struct Record {
+    std::uint64_t timestamp;
+    float x;
+    float y;
+    float z;
+    std::uint16_t channel;
+    std::uint16_t status;
+};
+
+template <std::size_t N>
+using Records_AoS = exfs::static_vector<Record, N>;
+
+template <std::size_t N>
+using Records_SoA = exfs::static_soa_vector<
+    N,
+    std::uint64_t,
+    float,
+    float,
+    float,
+    std::uint16_t,
+    std::uint16_t
+>;
+
+constexpr float threshold = -10.0f;
+
+Record make_record (std::size_t idx) {
+    auto const value = static_cast<float>(idx % 100u) * 0.25f;
+    return Record{
+        idx * 1000u,
+        value,
+        -value,
+        value * 2.0f,
+        static_cast<std::uint16_t>(idx % 8u),
+        0u,
+    };
+}
+
+template <std::size_t N>
+void column_count_aos (benchmark::State& state) {
+    static Records_AoS<N> records{};
+    records.clear();
+    for (std::size_t idx = 0u; idx < N; ++idx) {
+        records.push_back(make_record(idx));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(records);
+        std::uint32_t count = 0u;
+        for (std::size_t idx = 0u; idx < records.size(); ++idx) {
+            count += records[idx].y > threshold;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(column_count_aos<256u>);
+BENCHMARK(column_count_aos<4096u>);
+BENCHMARK(column_count_aos<65536u>);
+
+template <std::size_t N>
+void column_count_soa (benchmark::State& state) {
+    static Records_SoA<N> records{};
+    records.clear();
+    for (std::size_t idx = 0u; idx < N; ++idx) {
+        auto const r = make_record(idx);
+        records.emplace_back(r.timestamp, r.x, r.y, r.z, r.channel, r.status);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(records);
+        std::uint32_t count = 0u;
+        for (float const y : records.template column<2>()) {
+            count += y > threshold;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(column_count_soa<256u>);
+BENCHMARK(column_count_soa<4096u>);
+BENCHMARK(column_count_soa<65536u>);
+
+// Counting through the row iterators, which only touches the one column too
+// but goes through the proxy references.
+template <std::size_t N>
+void column_count_soa_rows (benchmark::State& state) {
+    static Records_SoA<N> records{};
+    records.clear();
+    for (std::size_t idx = 0u; idx < N; ++idx) {
+        auto const r = make_record(idx);
+        records.emplace_back(r.timestamp, r.x, r.y, r.z, r.channel, r.status);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(records);
+        std::uint32_t count = 0u;
+        for (auto const row : records) {
+            count += row.template get<2>() > threshold;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * N);
+}
+BENCHMARK(column_count_soa_rows<256u>);
+BENCHMARK(column_count_soa_rows<4096u>);
+BENCHMARK(column_count_soa_rows<65536u>);
+}  // namespace
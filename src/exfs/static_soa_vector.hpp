@@ -0,0 +1,727 @@
+#ifndef EXFS_STATIC_SOA_VECTOR_HPP_
+#define EXFS_STATIC_SOA_VECTOR_HPP_
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "exfs/iterator/category_tags.hpp"
+#include "exfs/iterator/reverse_iterator.hpp"
+#include "exfs/memory/storage.hpp"
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/integer_sequence.hpp"
+
+namespace exfs {
+namespace __detail {
+template <std::size_t I, typename T>
+struct __soa_field {
+    T value;
+
+    friend constexpr bool
+    operator == (__soa_field const&, __soa_field const&) = default;
+};
+
+template <typename Indices, typename... Ts>
+struct __soa_fields;
+
+template <std::size_t... Is, typename... Ts>
+struct __soa_fields<index_sequence<Is...>, Ts...> : __soa_field<Is, Ts>... {
+    friend constexpr bool
+    operator == (__soa_fields const&, __soa_fields const&) = default;
+};
+
+template <std::size_t I, typename T>
+constexpr T& __soa_get (__soa_field<I, T>& field) noexcept {
+    return field.value;
+}
+
+template <std::size_t I, typename T>
+constexpr T const& __soa_get (__soa_field<I, T> const& field) noexcept {
+    return field.value;
+}
+
+template <std::size_t I, typename T, std::size_t N>
+struct __soa_column {
+    exfs::memory::storage<T> slots[N];
+};
+
+template <std::size_t N, typename Indices, typename... Ts>
+struct __soa_columns;
+
+template <std::size_t N, std::size_t... Is, typename... Ts>
+struct __soa_columns<N, index_sequence<Is...>, Ts...>
+      : __soa_column<Is, Ts, N>... {};
+
+template <std::size_t I, typename T, std::size_t N>
+constexpr exfs::memory::storage<T>*
+__soa_slots (__soa_column<I, T, N>& column) noexcept {
+    return column.slots;
+}
+
+template <std::size_t I, typename T, std::size_t N>
+constexpr exfs::memory::storage<T> const*
+__soa_slots (__soa_column<I, T, N> const& column) noexcept {
+    return column.slots;
+}
+
+template <std::size_t I, typename T, std::size_t N>
+T __soa_column_type (__soa_column<I, T, N> const&);
+}  // namespace __detail
+
+/**
+ * One row of a @c static_soa_vector held by value: an aggregate with one
+ * member of each of the types @p Ts..., accessed by index with @c get.
+ */
+template <typename... Ts>
+struct soa_row : __detail::__soa_fields<index_sequence_for<Ts...>, Ts...> {
+    template <std::size_t I>
+    constexpr auto& get () & noexcept {
+        return __detail::__soa_get<I>(*this);
+    }
+
+    template <std::size_t I>
+    constexpr auto const& get () const& noexcept {
+        return __detail::__soa_get<I>(*this);
+    }
+
+    friend constexpr bool
+    operator == (soa_row const&, soa_row const&) = default;
+};
+
+/**
+ * Sequence container with a variable size but pre-allocated memory which
+ * stores its rows as a structure of arrays.
+ *
+ * Each row is made of one member of each of the types @p Ts.... Rather than
+ * storing whole rows contiguously like `static_vector<Record, N>`, each
+ * member is stored in its own contiguous column of @p N elements. Code which
+ * only touches a few members of every row, such as a filter over one field of
+ * a sensor record, then only loads the columns it needs. Each column is
+ * available as a @c std::span for loops which the compiler can vectorize.
+ *
+ * Rows are accessed through proxy references which refer to a row by its
+ * position in the container. A proxy reference provides access to the
+ * members with @c get, converts to a @c soa_row holding a copy of the row and
+ * can be assigned a @c soa_row to overwrite the row. The row iterators model
+ * @c exfs::iterator::random_access_iterator.
+ *
+ * @tparam N The capacity of the container.
+ * @tparam Ts The types of the members of each row.
+ */
+template <std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0u and (std::is_object_v<Ts> and ...))
+class static_soa_vector {
+    using indices_ = index_sequence_for<Ts...>;
+    using column_set_ = __detail::__soa_columns<N, indices_, Ts...>;
+
+    template <typename U>
+    using rev_iter_ = exfs::iterator::reverse_iterator<U>;
+
+    template <bool is_const>
+    using columns_pointer_ = std::conditional_t<
+        is_const,
+        column_set_ const*,
+        column_set_*
+    >;
+
+  public:
+    using value_type      = soa_row<Ts...>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     * The type of the elements of column @p I.
+     */
+    template <std::size_t I>
+    using column_type = decltype(
+        __detail::__soa_column_type<I>(exfs::declval<column_set_ const&>())
+    );
+
+  private:
+    template <bool is_const>
+    class row_reference_ {
+      public:
+        /**
+         * Converts a mutable reference to a const reference.
+         */
+        template <bool other_const>
+        requires (is_const and not other_const)
+        constexpr row_reference_ (row_reference_<other_const> other) noexcept
+              : columns_{other.columns_},
+                index_{other.index_} {}
+
+        /**
+         * Access member @p I of the referenced row.
+         */
+        template <std::size_t I>
+        constexpr auto& get () const noexcept {
+            return __detail::__soa_slots<I>(*columns_)[index_].object();
+        }
+
+        /**
+         * Copies the referenced row.
+         */
+        constexpr operator value_type () const {
+            return [&]<std::size_t... Is> (index_sequence<Is...>) {
+                return value_type{{{get<Is>()}...}};
+            }(indices_{});
+        }
+
+        /**
+         * Assigns each member of @p row to the referenced row.
+         */
+        constexpr row_reference_ const& operator = (value_type const& row)
+        const requires (not is_const) {
+            [&]<std::size_t... Is> (index_sequence<Is...>) {
+                ((get<Is>() = row.template get<Is>()), ...);
+            }(indices_{});
+            return *this;
+        }
+
+        /**
+         * @overload operator=()
+         */
+        constexpr row_reference_ const& operator = (value_type&& row)
+        const requires (not is_const) {
+            [&]<std::size_t... Is> (index_sequence<Is...>) {
+                ((get<Is>() = exfs::move(row.template get<Is>())), ...);
+            }(indices_{});
+            return *this;
+        }
+
+        /**
+         * Assigns the row referenced by @p other to the referenced row, as
+         * opposed to rebinding this reference.
+         */
+        constexpr row_reference_ const& operator = (
+            row_reference_ const& other
+        ) const requires (not is_const) {
+            [&]<std::size_t... Is> (index_sequence<Is...>) {
+                ((get<Is>() = other.template get<Is>()), ...);
+            }(indices_{});
+            return *this;
+        }
+
+        /**
+         * Swaps the members of the rows referenced by @p a and @p b.
+         */
+        friend constexpr void swap (row_reference_ a, row_reference_ b)
+        requires (not is_const) {
+            [&]<std::size_t... Is> (index_sequence<Is...>) {
+                (exfs::swap(a.template get<Is>(), b.template get<Is>()), ...);
+            }(indices_{});
+        }
+
+      private:
+        friend class static_soa_vector;
+        friend class row_reference_<not is_const>;
+
+        constexpr row_reference_ (
+            columns_pointer_<is_const> columns,
+            size_type index
+        ) noexcept
+              : columns_{columns},
+                index_{index} {}
+
+        columns_pointer_<is_const> columns_;
+        size_type index_;
+    };
+
+    template <bool is_const>
+    class row_iterator_ {
+      public:
+        // The reference type is a proxy, so this is only an input iterator in
+        // the legacy taxonomy.
+        using iterator_concept  = exfs::iterator::random_access_iterator_tag;
+        using iterator_category = exfs::iterator::input_iterator_tag;
+        using value_type        = soa_row<Ts...>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = row_reference_<is_const>;
+
+        constexpr row_iterator_ () noexcept = default;
+
+        /**
+         * Converts a mutable iterator to a const iterator.
+         */
+        template <bool other_const>
+        requires (is_const and not other_const)
+        constexpr row_iterator_ (row_iterator_<other_const> other) noexcept
+              : columns_{other.columns_},
+                index_{other.index_} {}
+
+        constexpr reference operator * () const noexcept {
+            return reference{columns_, static_cast<size_type>(index_)};
+        }
+
+        constexpr reference operator [] (difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        constexpr row_iterator_& operator ++ () noexcept {
+            ++index_;
+            return *this;
+        }
+
+        constexpr row_iterator_ operator ++ (int) noexcept {
+            auto copy = *this;
+            ++index_;
+            return copy;
+        }
+
+        constexpr row_iterator_& operator -- () noexcept {
+            --index_;
+            return *this;
+        }
+
+        constexpr row_iterator_ operator -- (int) noexcept {
+            auto copy = *this;
+            --index_;
+            return copy;
+        }
+
+        constexpr row_iterator_& operator += (difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        constexpr row_iterator_& operator -= (difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend constexpr row_iterator_
+        operator + (row_iterator_ it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend constexpr row_iterator_
+        operator + (difference_type n, row_iterator_ it) noexcept {
+            return it += n;
+        }
+
+        friend constexpr row_iterator_
+        operator - (row_iterator_ it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend constexpr difference_type
+        operator - (row_iterator_ const& a, row_iterator_ const& b) noexcept {
+            return a.index_ - b.index_;
+        }
+
+        friend constexpr bool
+        operator == (row_iterator_ const& a, row_iterator_ const& b) noexcept {
+            return a.index_ == b.index_;
+        }
+
+        friend constexpr std::strong_ordering
+        operator <=> (row_iterator_ const& a, row_iterator_ const& b) noexcept {
+            return a.index_ <=> b.index_;
+        }
+
+        /**
+         * Moves the members of the referenced row into a @c soa_row.
+         */
+        friend constexpr value_type iter_move (row_iterator_ const& it) {
+            return [&]<std::size_t... Is> (index_sequence<Is...>) {
+                return value_type{{{exfs::move((*it).template get<Is>())}...}};
+            }(indices_{});
+        }
+
+        friend constexpr void
+        iter_swap (row_iterator_ const& a, row_iterator_ const& b)
+        requires (not is_const) {
+            swap(*a, *b);
+        }
+
+      private:
+        friend class static_soa_vector;
+        friend class row_iterator_<not is_const>;
+
+        constexpr row_iterator_ (
+            columns_pointer_<is_const> columns,
+            difference_type index
+        ) noexcept
+              : columns_{columns},
+                index_{index} {}
+
+        columns_pointer_<is_const> columns_ = nullptr;
+        difference_type index_ = 0;
+    };
+
+  public:
+    using reference              = row_reference_<false>;
+    using const_reference        = row_reference_<true>;
+    using iterator               = row_iterator_<false>;
+    using const_iterator         = row_iterator_<true>;
+    using reverse_iterator       = rev_iter_<iterator>;
+    using const_reverse_iterator = rev_iter_<const_iterator>;
+
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Default constructor. Constructs an empty container.
+     */
+    constexpr static_soa_vector () noexcept = default;
+
+    /**
+     * Constructs the container with the copy of the contents of @p other.
+     *
+     * @param[in] other The other container to copy from.
+     */
+    constexpr static_soa_vector (static_soa_vector const& other)
+    noexcept((std::is_nothrow_copy_constructible_v<Ts> and ...))
+          : size_{other.size_} {
+        for_each_column_([&]<std::size_t I> () {
+            auto* const slots = slots_<I>();
+            auto const* const others = other.template slots_<I>();
+            for (size_type idx = 0u; idx < size_; ++idx) {
+                slots[idx].construct(others[idx].object());
+            }
+        });
+    }
+
+    /**
+     * Constructs the container with the contents of other using move
+     * semantics. After the move, @p other is guaranteed to be @p empty().
+     *
+     * @param[in] other The other container to move from.
+     */
+    constexpr static_soa_vector (static_soa_vector&& other)
+    noexcept((std::is_nothrow_move_constructible_v<Ts> and ...))
+          : size_{other.size_} {
+        for_each_column_([&]<std::size_t I> () {
+            auto* const slots = slots_<I>();
+            auto* const others = other.template slots_<I>();
+            for (size_type idx = 0u; idx < size_; ++idx) {
+                slots[idx].construct(exfs::move(others[idx]).object());
+                others[idx].destroy();
+            }
+        });
+        other.size_ = 0u;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Destructs the elements of every column.
+     */
+    constexpr ~static_soa_vector () {
+        destroy_all_();
+    }
+
+    /**
+     * @name Assignment
+     * @{
+     */
+
+    /**
+     * Copy assignment operator. Replaces the contents with a copy of the
+     * contents of @p other.
+     */
+    constexpr static_soa_vector& operator = (static_soa_vector const& other)
+    noexcept((
+        (
+            std::is_nothrow_copy_assignable_v<Ts> and
+            std::is_nothrow_copy_constructible_v<Ts>
+        ) and ...
+    )) {
+        // As in static_vector, each column is walked in lock-step with the
+        // same column of other, doing the minimal action for each element.
+        for_each_column_([&]<std::size_t I> () {
+            auto* const slots = slots_<I>();
+            auto const* const others = other.template slots_<I>();
+            size_type idx = 0u;
+            for (; idx < size_ and idx < other.size_; ++idx) {
+                slots[idx].object() = others[idx].object();
+            }
+            for (; idx < other.size_; ++idx) {
+                slots[idx].construct(others[idx].object());
+            }
+            for (; idx < size_; ++idx) {
+                slots[idx].destroy();
+            }
+        });
+        size_ = other.size_;
+        return *this;
+    }
+
+    /**
+     * Move assignment operator. Replaces the contents with those of @p
+     * other. After this call, @p other will be empty.
+     */
+    constexpr static_soa_vector& operator = (static_soa_vector&& other)
+    noexcept((std::is_nothrow_move_constructible_v<Ts> and ...)) {
+        if (this != &other) {
+            clear();
+            for_each_column_([&]<std::size_t I> () {
+                auto* const slots = slots_<I>();
+                auto* const others = other.template slots_<I>();
+                for (size_type idx = 0u; idx < other.size_; ++idx) {
+                    slots[idx].construct(exfs::move(others[idx]).object());
+                }
+            });
+            size_ = other.size_;
+            other.clear();
+        }
+        return *this;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Iterators
+     * @{
+     */
+
+    constexpr iterator begin () noexcept { return iterator{&columns_, 0}; }
+    constexpr const_iterator begin () const noexcept {
+        return const_iterator{&columns_, 0};
+    }
+    constexpr const_iterator cbegin () const noexcept { return begin(); }
+
+    constexpr iterator end () noexcept {
+        return iterator{&columns_, static_cast<difference_type>(size_)};
+    }
+    constexpr const_iterator end () const noexcept {
+        return const_iterator{&columns_, static_cast<difference_type>(size_)};
+    }
+    constexpr const_iterator cend () const noexcept { return end(); }
+
+    constexpr reverse_iterator rbegin () noexcept {
+        return reverse_iterator{end()};
+    }
+    constexpr const_reverse_iterator rbegin () const noexcept {
+        return const_reverse_iterator{end()};
+    }
+    constexpr const_reverse_iterator crbegin () const noexcept {
+        return rbegin();
+    }
+
+    constexpr reverse_iterator rend () noexcept {
+        return reverse_iterator{begin()};
+    }
+    constexpr const_reverse_iterator rend () const noexcept {
+        return const_reverse_iterator{begin()};
+    }
+    constexpr const_reverse_iterator crend () const noexcept { return rend(); }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Size/Capacity
+     * @{
+     */
+
+    /**
+     * Checks if the container has no rows.
+     */
+    [[nodiscard]] constexpr bool empty () const noexcept {
+        return size_ == 0u;
+    }
+
+    /**
+     * Returns the number of rows in the container.
+     */
+    [[nodiscard]] constexpr size_type size () const noexcept {
+        return size_;
+    }
+
+    /**
+     * This is an alias for @p capacity() added for feature parity with @c
+     * static_vector.
+     */
+    static constexpr size_type max_size () noexcept { return capacity(); }
+
+    /**
+     * Returns the number of rows the container has space for, which is
+     * always @p N.
+     */
+    static constexpr size_type capacity () noexcept { return N; }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Element and Column Access
+     * @{
+     */
+
+    /**
+     * Returns a proxy reference to the row at @p pos. No bounds checking is
+     * performed.
+     *
+     * @warning Accessing a nonexistent row is undefined behavior.
+     */
+    constexpr reference operator [] (size_type pos) noexcept {
+        return reference{&columns_, pos};
+    }
+
+    /**
+     * @overload operator[]()
+     */
+    constexpr const_reference operator [] (size_type pos) const noexcept {
+        return const_reference{&columns_, pos};
+    }
+
+    /**
+     * @warning Calling @c front() on an empty container is undefined.
+     */
+    constexpr reference front () noexcept { return (*this)[0u]; }
+    constexpr const_reference front () const noexcept { return (*this)[0u]; }
+
+    /**
+     * @warning Calling @c back() on an empty container is undefined.
+     */
+    constexpr reference back () noexcept { return (*this)[size_ - 1u]; }
+    constexpr const_reference back () const noexcept {
+        return (*this)[size_ - 1u];
+    }
+
+    /**
+     * Returns the contiguous elements of column @p I, one per row.
+     */
+    template <std::size_t I>
+    constexpr std::span<column_type<I>> column () noexcept {
+        if (size_ == 0u) {
+            return {};
+        }
+        return {&slots_<I>()[0].object(), size_};
+    }
+
+    /**
+     * @overload column()
+     */
+    template <std::size_t I>
+    constexpr std::span<column_type<I> const> column () const noexcept {
+        if (size_ == 0u) {
+            return {};
+        }
+        return {&slots_<I>()[0].object(), size_};
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Modifiers
+     * @{
+     */
+
+    /**
+     * Appends a row whose members are initialized from @p args..., one
+     * argument per column.
+     *
+     * @warning Calling this function when the container is full is undefined
+     *     behavior.
+     *
+     * @return A proxy reference to the inserted row.
+     */
+    template <typename... Args>
+    requires (sizeof...(Args) == sizeof...(Ts))
+    constexpr reference emplace_back (Args&&... args)
+    noexcept((std::is_nothrow_constructible_v<Ts, Args> and ...)) {
+        [&]<std::size_t... Is> (index_sequence<Is...>) {
+            (slots_<Is>()[size_].construct(exfs::forward<Args>(args)), ...);
+        }(indices_{});
+        return (*this)[size_++];
+    }
+
+    /**
+     * Appends a copy of @p row.
+     *
+     * @warning Calling this function when the container is full is undefined
+     *     behavior.
+     */
+    constexpr void push_back (value_type const& row)
+    noexcept((std::is_nothrow_copy_constructible_v<Ts> and ...)) {
+        [&]<std::size_t... Is> (index_sequence<Is...>) {
+            emplace_back(row.template get<Is>()...);
+        }(indices_{});
+    }
+
+    /**
+     * @overload push_back()
+     */
+    constexpr void push_back (value_type&& row)
+    noexcept((std::is_nothrow_move_constructible_v<Ts> and ...)) {
+        [&]<std::size_t... Is> (index_sequence<Is...>) {
+            emplace_back(exfs::move(row.template get<Is>())...);
+        }(indices_{});
+    }
+
+    /**
+     * Removes the last row.
+     *
+     * @warning Calling this function on an empty container is undefined
+     *     behavior.
+     */
+    constexpr void pop_back () noexcept {
+        --size_;
+        for_each_column_([&]<std::size_t I> () {
+            slots_<I>()[size_].destroy();
+        });
+    }
+
+    /**
+     * Erases all rows from the container.
+     */
+    constexpr void clear () noexcept {
+        destroy_all_();
+        size_ = 0u;
+    }
+
+    /**
+     * @}
+     */
+
+  private:
+    template <std::size_t I>
+    constexpr auto* slots_ () noexcept {
+        return __detail::__soa_slots<I>(columns_);
+    }
+
+    template <std::size_t I>
+    constexpr auto const* slots_ () const noexcept {
+        return __detail::__soa_slots<I>(columns_);
+    }
+
+    template <typename Fn>
+    static constexpr void for_each_column_ (Fn&& fn) {
+        [&]<std::size_t... Is> (index_sequence<Is...>) {
+            (fn.template operator()<Is>(), ...);
+        }(indices_{});
+    }
+
+    constexpr void destroy_all_ () noexcept {
+        for_each_column_([&]<std::size_t I> () {
+            using type = column_type<I>;
+            if constexpr (not std::is_trivially_destructible_v<type>) {
+                auto* const slots = slots_<I>();
+                for (size_type idx = 0u; idx < size_; ++idx) {
+                    slots[idx].destroy();
+                }
+            }
+        });
+    }
+
+    column_set_ columns_;
+    size_type size_ = 0u;
+};
+}  // namespace exfs
+
+#endif  // EXFS_STATIC_SOA_VECTOR_HPP_
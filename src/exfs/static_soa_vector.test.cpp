@@ -0,0 +1,233 @@
+#include "exfs/static_soa_vector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/iterator/concepts.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace {
+using Records = exfs::static_soa_vector<
+    8u,
+    std::uint32_t,
+    float,
+    std::string
+>;
+
+template <typename Range>
+std::vector<std::string> names (Range const& range) {
+    std::vector<std::string> result;
+    for (auto row : range) {
+        result.push_back(row.template get<2>());
+    }
+    return result;
+}
+}  // namespace
+
+TEST_CASE (
+    "exfs::static_soa_vector - member aliases and iterator properties",
+    "[unit][static_soa_vector]"
+) {
+    CHECK(std::is_same_v<
+        Records::value_type,
+        exfs::soa_row<std::uint32_t, float, std::string>
+    >);
+    CHECK(std::is_same_v<Records::column_type<1>, float>);
+    CHECK(std::is_same_v<
+        decltype(exfs::declval<Records&>().column<0>()),
+        std::span<std::uint32_t>
+    >);
+    CHECK(std::is_same_v<
+        decltype(exfs::declval<Records const&>().column<2>()),
+        std::span<std::string const>
+    >);
+    CHECK(Records::capacity() == 8u);
+
+    CHECK(exfs::iterator::random_access_iterator<Records::iterator>);
+    CHECK(exfs::iterator::random_access_iterator<Records::const_iterator>);
+    CHECK(exfs::iterator::random_access_iterator<Records::reverse_iterator>);
+    CHECK(std::random_access_iterator<Records::iterator>);
+    CHECK(exfs::iterator::indirectly_writable<
+        Records::iterator,
+        Records::value_type
+    >);
+    CHECK(not exfs::iterator::indirectly_writable<
+        Records::const_iterator,
+        Records::value_type
+    >);
+    CHECK(std::is_convertible_v<Records::iterator, Records::const_iterator>);
+
+    // Each column is a plain array with no padding between rows.
+    using Samples = exfs::static_soa_vector<16u, std::uint8_t, double>;
+    CHECK(sizeof(Samples) == 16u + 16u * sizeof(double) + sizeof(std::size_t));
+}
+
+SCENARIO (
+    "exfs::static_soa_vector - rows and columns",
+    "[unit][static_soa_vector]"
+) {
+    using namespace std::literals::string_literals;
+
+    GIVEN ("an empty container") {
+        Records records{};
+
+        THEN ("it has no rows and empty columns") {
+            CHECK(records.empty());
+            CHECK(records.size() == 0u);
+            CHECK(records.begin() == records.end());
+            CHECK(records.column<1>().empty());
+        }
+    }
+
+    GIVEN ("a container with several rows") {
+        Records records{};
+        records.emplace_back(3u, 0.5f, "gyro"s);
+        records.push_back({{{1u}, {2.0f}, {"accel"s}}});
+        Records::value_type const mag{{{7u}, {-1.5f}, {"mag"s}}};
+        records.push_back(mag);
+
+        THEN ("rows are accessed through proxy references") {
+            CHECK(records.size() == 3u);
+            CHECK(records[0].get<0>() == 3u);
+            CHECK(records[1].get<2>() == "accel");
+            CHECK(records.front().get<1>() == 0.5f);
+            CHECK(records.back().get<2>() == "mag");
+            CHECK(Records::value_type{records[2]} == mag);
+        }
+
+        THEN ("each column holds one member of every row contiguously") {
+            auto const ids = records.column<0>();
+            auto const gains = records.column<1>();
+            CHECK(std::vector<std::uint32_t>(ids.begin(), ids.end()) ==
+                std::vector<std::uint32_t>{3u, 1u, 7u});
+            CHECK(std::accumulate(gains.begin(), gains.end(), 0.0f) == 1.0f);
+            CHECK(&gains[2] == &gains[0] + 2);
+        }
+
+        WHEN ("a column is modified through its span") {
+            for (auto& gain : records.column<1>()) {
+                gain *= 2.0f;
+            }
+
+            THEN ("the rows see the new values") {
+                CHECK(records[0].get<1>() == 1.0f);
+                CHECK(records[2].get<1>() == -3.0f);
+            }
+        }
+
+        WHEN ("a row is assigned") {
+            records[1] = records[2];
+            records[2] = Records::value_type{{{9u}, {0.0f}, {"baro"s}}};
+
+            THEN ("the members are overwritten") {
+                CHECK(names(records) == std::vector{
+                    "gyro"s,
+                    "mag"s,
+                    "baro"s
+                });
+                CHECK(records[1].get<0>() == 7u);
+            }
+        }
+
+        WHEN ("the rows are sorted by one column") {
+            std::ranges::sort(records, {}, [] (auto const& row) {
+                return row.template get<0>();
+            });
+
+            THEN ("every column is permuted together") {
+                CHECK(names(records) == std::vector{
+                    "accel"s,
+                    "gyro"s,
+                    "mag"s
+                });
+                CHECK(records[0].get<1>() == 2.0f);
+            }
+        }
+
+        WHEN ("iterating in reverse") {
+            std::vector<std::string> result;
+            for (auto it = records.crbegin(); it != records.crend(); ++it) {
+                result.push_back((*it).get<2>());
+            }
+
+            THEN ("rows are visited back to front") {
+                CHECK(result == std::vector{"mag"s, "accel"s, "gyro"s});
+            }
+        }
+
+        WHEN ("using random access on iterators") {
+            auto const first = records.cbegin();
+            auto const last = records.cend();
+
+            THEN ("they behave like indices") {
+                CHECK(last - first == 3);
+                CHECK(first[2].get<2>() == "mag");
+                CHECK((*(first + 1)).get<2>() == "accel");
+                CHECK(first < last);
+                CHECK(last - 1 == first + 2);
+            }
+        }
+
+        WHEN ("the container is copied") {
+            Records copy{records};
+
+            THEN ("the copy has equal rows") {
+                CHECK(names(copy) == names(records));
+                CHECK(copy.column<0>().data() != records.column<0>().data());
+            }
+        }
+
+        WHEN ("the container is copy assigned over larger and smaller ones") {
+            Records larger{records};
+            larger.push_back(Records::value_type{{{9u}, {0.0f}, {"baro"s}}});
+            larger = records;
+            Records smaller{};
+            smaller.push_back(Records::value_type{{{9u}, {0.0f}, {"baro"s}}});
+            smaller = records;
+
+            THEN ("both have equal rows") {
+                CHECK(names(larger) == names(records));
+                CHECK(larger.column<2>().size() == 3u);
+                CHECK(names(smaller) == names(records));
+                CHECK(smaller[0].get<0>() == 3u);
+            }
+        }
+
+        WHEN ("the container is moved") {
+            Records moved{exfs::move(records)};
+
+            THEN ("the rows are transferred") {
+                CHECK(names(moved) == std::vector{"gyro"s, "accel"s, "mag"s});
+                CHECK(records.empty());
+            }
+
+            AND_WHEN ("it is move assigned back") {
+                records = exfs::move(moved);
+
+                THEN ("the rows are transferred again") {
+                    CHECK(records.size() == 3u);
+                    CHECK(moved.empty());
+                }
+            }
+        }
+
+        WHEN ("rows are popped and the container is cleared") {
+            records.pop_back();
+            CHECK(names(records) == std::vector{"gyro"s, "accel"s});
+            records.clear();
+
+            THEN ("it is empty") {
+                CHECK(records.empty());
+                CHECK(records.column<2>().empty());
+            }
+        }
+    }
+}
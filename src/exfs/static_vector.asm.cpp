@@ -0,0 +1,28 @@
+// Probes of the code generated for exfs::static_vector, checked by the
+// assembly test (see tools/check_assembly.py).
+#include "exfs/static_vector.hpp"
+
+#include <cstddef>
+
+namespace {
+using Vector = exfs::static_vector<int, 8>;
+}  // namespace
+
+extern "C" {
+// Reading the size, storing the element and storing the new size.
+// ASSEMBLY probe_static_vector_push_back: loads=1 stores=2 calls=0
+void probe_static_vector_push_back (Vector& vector, int value) {
+    vector.push_back(value);
+}
+
+// ASSEMBLY probe_static_vector_subscript: instructions=1 loads=1 calls=0
+int probe_static_vector_subscript (Vector const& vector, std::size_t idx) {
+    return vector[idx];
+}
+
+// Copying a vector of integers goes through a single call to memmove.
+// ASSEMBLY probe_static_vector_copy: calls=1
+void probe_static_vector_copy (Vector& dest, Vector const& source) {
+    dest = source;
+}
+}
@@ -0,0 +1,222 @@
+#include "exfs/static_vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/testing/Counted_Object.hpp"
+
+namespace {
+using exfs::testing::Counted_Object;
+
+// Each operation is measured on trivially copyable elements, which take the
+// memory builtin fast paths, and on short strings, which are constructed one
+// by one. std::vector, with its storage reserved up front, is the reference
+// for push_back. Copies and moves are also measured on Counted_Object, for
+// which the copies and moves of elements per element are reported.
+constexpr std::size_t capacity = 256u;
+
+template <typename T>
+T make_value (std::size_t idx) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return std::string(idx % 15u, 'x');
+    } else if constexpr (std::is_same_v<T, Counted_Object>) {
+        return Counted_Object{static_cast<int>(idx)};
+    } else {
+        return static_cast<T>(idx);
+    }
+}
+
+template <typename T>
+exfs::static_vector<T, capacity> make_vector () {
+    exfs::static_vector<T, capacity> vector;
+    for (std::size_t idx = 0u; idx < capacity; ++idx) {
+        vector.push_back(make_value<T>(idx));
+    }
+    return vector;
+}
+
+// Accumulates the element operations of the timed regions of a benchmark of
+// Counted_Object elements, and reports them per element processed. For other
+// element types, it does nothing.
+template <typename T>
+class Operation_Counts {
+  public:
+    void start () {
+        if constexpr (counted) {
+            Counted_Object::reset();
+        }
+    }
+
+    void stop () {
+        if constexpr (counted) {
+            copies_ += Counted_Object::counts().copies();
+            moves_ += Counted_Object::counts().moves();
+        }
+    }
+
+    void report (benchmark::State& state) const {
+        if constexpr (counted) {
+            auto const elements =
+                static_cast<double>(state.iterations() * capacity);
+            state.counters["copies_per_element"] =
+                static_cast<double>(copies_) / elements;
+            state.counters["moves_per_element"] =
+                static_cast<double>(moves_) / elements;
+        }
+    }
+
+  private:
+    static constexpr bool counted = std::is_same_v<T, Counted_Object>;
+
+    std::size_t copies_ = 0u;
+    std::size_t moves_ = 0u;
+};
+
+template <typename T>
+void static_vector_construct_fill (benchmark::State& state) {
+    auto const value = make_value<T>(7u);
+
+    for (auto _ : state) {
+        exfs::static_vector<T, capacity> vector(capacity, value);
+        benchmark::DoNotOptimize(vector.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * capacity);
+}
+BENCHMARK_TEMPLATE(static_vector_construct_fill, std::uint32_t);
+BENCHMARK_TEMPLATE(static_vector_construct_fill, std::string);
+
+template <typename T>
+void static_vector_construct_range (benchmark::State& state) {
+    std::vector<T> source;
+    for (std::size_t idx = 0u; idx < capacity; ++idx) {
+        source.push_back(make_value<T>(idx));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(source.data());
+        exfs::static_vector<T, capacity> vector(source.begin(), source.end());
+        benchmark::DoNotOptimize(vector.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * capacity);
+}
+BENCHMARK_TEMPLATE(static_vector_construct_range, std::uint32_t);
+BENCHMARK_TEMPLATE(static_vector_construct_range, std::string);
+
+template <typename T>
+void static_vector_copy (benchmark::State& state) {
+    auto const source = make_vector<T>();
+    Operation_Counts<T> operations;
+    operations.start();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(source.data());
+        auto copy = source;
+        benchmark::DoNotOptimize(copy.data());
+    }
+
+    operations.stop();
+    operations.report(state);
+    state.SetItemsProcessed(state.iterations() * capacity);
+}
+BENCHMARK_TEMPLATE(static_vector_copy, std::uint32_t);
+BENCHMARK_TEMPLATE(static_vector_copy, std::string);
+BENCHMARK_TEMPLATE(static_vector_copy, Counted_Object);
+
+// Moving a static_vector moves each element into the new storage, so the
+// source is refilled outside of the timed region.
+template <typename T>
+void static_vector_move (benchmark::State& state) {
+    auto const source = make_vector<T>();
+    Operation_Counts<T> operations;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto moved_from = source;
+        operations.start();
+        state.ResumeTiming();
+        auto moved_to = std::move(moved_from);
+        benchmark::DoNotOptimize(moved_to.data());
+        state.PauseTiming();
+        operations.stop();
+        state.ResumeTiming();
+    }
+
+    operations.report(state);
+    state.SetItemsProcessed(state.iterations() * capacity);
+}
+BENCHMARK_TEMPLATE(static_vector_move, std::uint32_t);
+BENCHMARK_TEMPLATE(static_vector_move, std::string);
+BENCHMARK_TEMPLATE(static_vector_move, Counted_Object);
+
+// Move-assigns a full container to one holding half as many elements, so that
+// both the move-assignment and move-construction of elements are exercised.
+template <typename T>
+void static_vector_move_assign (benchmark::State& state) {
+    auto const source = make_vector<T>();
+    Operation_Counts<T> operations;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto moved_from = source;
+        exfs::static_vector<T, capacity> moved_to(
+            source.begin(),
+            source.begin() + capacity / 2u
+        );
+        operations.start();
+        state.ResumeTiming();
+        moved_to = std::move(moved_from);
+        benchmark::DoNotOptimize(moved_to.data());
+        state.PauseTiming();
+        operations.stop();
+        state.ResumeTiming();
+    }
+
+    operations.report(state);
+    state.SetItemsProcessed(state.iterations() * capacity);
+}
+BENCHMARK_TEMPLATE(static_vector_move_assign, std::uint32_t);
+BENCHMARK_TEMPLATE(static_vector_move_assign, std::string);
+BENCHMARK_TEMPLATE(static_vector_move_assign, Counted_Object);
+
+template <typename T>
+void static_vector_push_back (benchmark::State& state) {
+    auto const value = make_value<T>(7u);
+
+    for (auto _ : state) {
+        exfs::static_vector<T, capacity> vector;
+        for (std::size_t idx = 0u; idx < capacity; ++idx) {
+            vector.push_back(value);
+        }
+        benchmark::DoNotOptimize(vector.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * capacity);
+}
+BENCHMARK_TEMPLATE(static_vector_push_back, std::uint32_t);
+BENCHMARK_TEMPLATE(static_vector_push_back, std::string);
+
+template <typename T>
+void std_vector_push_back (benchmark::State& state) {
+    auto const value = make_value<T>(7u);
+
+    for (auto _ : state) {
+        std::vector<T> vector;
+        vector.reserve(capacity);
+        for (std::size_t idx = 0u; idx < capacity; ++idx) {
+            vector.push_back(value);
+        }
+        benchmark::DoNotOptimize(vector.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * capacity);
+}
+BENCHMARK_TEMPLATE(std_vector_push_back, std::uint32_t);
+BENCHMARK_TEMPLATE(std_vector_push_back, std::string);
+}  // namespace
@@ -0,0 +1,295 @@
+// Differential fuzz target for exfs::static_vector.
+//
+// The input is decoded into a sequence of operations which are run on two
+// static_vectors and, in lockstep, on two std::vectors. After each operation
+// the contents of each static_vector must equal those of its std::vector, and
+// the element operations it performed must be exactly those of the "minimal
+// action" documented for it: copy-assignment, for example, copy-assigns the
+// elements both containers hold, copy-constructs the remaining elements of the
+// source and destroys the surplus elements of the target. The std::vectors
+// only serve as the reference for the contents; their element operations,
+// which include reallocations, are not counted.
+//
+// Each operation takes one byte of the input. Its low bits select the
+// operation, bit 4 the container it acts on and, for operations which take a
+// second container, the other one is the source. Operations which would be
+// undefined behavior, such as pop_back() on an empty container, are skipped.
+#include "exfs/static_vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "exfs/testing/Counted_Object.hpp"
+#include "exfs/utility/functions.hpp"
+
+namespace {
+using exfs::testing::Counted_Object;
+using Counts = Counted_Object::Counts;
+
+constexpr std::size_t capacity = 16u;
+
+using Container = exfs::static_vector<Counted_Object, capacity>;
+using Reference = std::vector<Counted_Object>;
+
+enum class Operation : std::uint8_t {
+    emplace_back,
+    push_back_copy,
+    pop_back,
+    clear,
+    copy_construct,
+    move_construct,
+    copy_assign,
+    move_assign,
+    count,
+};
+
+// Reads the input one byte at a time. Reading past its end yields zeros.
+class Byte_Reader {
+  public:
+    Byte_Reader (std::uint8_t const* data, std::size_t size)
+      : data_{data},
+        size_{size}
+    {}
+
+    bool empty () const { return size_ == 0u; }
+
+    std::uint8_t next () {
+        if (size_ == 0u) {
+            return 0u;
+        }
+        --size_;
+        return *data_++;
+    }
+
+  private:
+    std::uint8_t const* data_;
+    std::size_t size_;
+};
+
+char const* name (Operation operation) {
+    constexpr char const* names[] = {
+        "emplace_back",
+        "push_back (copy)",
+        "pop_back",
+        "clear",
+        "copy construction",
+        "move construction",
+        "copy assignment",
+        "move assignment",
+    };
+    return names[static_cast<std::size_t>(operation)];
+}
+
+[[noreturn]] void fail (Operation operation, char const* message) {
+    std::fprintf(stderr, "%s: %s\n", name(operation), message);
+    std::abort();
+}
+
+void check_contents (
+    Operation operation,
+    Container const& actual,
+    Reference const& expected
+) {
+    if (actual.size() != expected.size()) {
+        std::fprintf(
+            stderr,
+            "size is %zu, expected %zu\n",
+            actual.size(),
+            expected.size()
+        );
+        fail(operation, "contents differ from std::vector");
+    }
+    for (std::size_t idx = 0u; idx < expected.size(); ++idx) {
+        if (actual[idx] != expected[idx]) {
+            std::fprintf(
+                stderr,
+                "element %zu is %d, expected %d\n",
+                idx,
+                actual[idx].data(),
+                expected[idx].data()
+            );
+            fail(operation, "contents differ from std::vector");
+        }
+    }
+}
+
+void check_counts (
+    Operation operation,
+    Counts const& actual,
+    Counts const& expected
+) {
+    if (actual == expected) {
+        return;
+    }
+
+    #define REPORT(FIELD)                                                      \
+    std::fprintf(                                                              \
+        stderr,                                                                \
+        "%-22s %4zu (expected %zu)\n",                                         \
+        #FIELD,                                                                \
+        actual.FIELD,                                                          \
+        expected.FIELD                                                         \
+    );
+
+    REPORT(default_constructions)
+    REPORT(copy_constructions)
+    REPORT(move_constructions)
+    REPORT(value_constructions)
+    REPORT(copy_assignments)
+    REPORT(move_assignments)
+    REPORT(destructions)
+
+    #undef REPORT
+
+    fail(operation, "element operations differ from the minimal action");
+}
+
+std::size_t min (std::size_t a, std::size_t b) { return a < b ? a : b; }
+
+// The number of elements by which a exceeds b.
+std::size_t excess (std::size_t a, std::size_t b) { return a > b ? a - b : 0u; }
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput (
+    std::uint8_t const* data,
+    std::size_t size
+) {
+    Byte_Reader input{data, size};
+    std::array<Container, 2u> actual{};
+    std::array<Reference, 2u> expected{};
+
+    while (not input.empty()) {
+        auto const byte = input.next();
+        auto const operation = static_cast<Operation>(
+            (byte & 0x0fu) % static_cast<std::uint8_t>(Operation::count)
+        );
+        std::size_t const target = (byte >> 4u) & 1u;
+        std::size_t const source = 1u - target;
+
+        auto& container = actual[target];
+        auto& reference = expected[target];
+        auto const target_size = container.size();
+        auto const source_size = actual[source].size();
+
+        switch (operation) {
+            case Operation::emplace_back: {
+                if (target_size == capacity) {
+                    break;
+                }
+                int const value = input.next();
+                Counted_Object::reset();
+                container.emplace_back(value);
+                check_counts(operation, Counted_Object::counts(), {
+                    .value_constructions = 1u,
+                });
+                reference.emplace_back(value);
+                break;
+            }
+
+            case Operation::push_back_copy: {
+                if (target_size == capacity) {
+                    break;
+                }
+                Counted_Object const value{input.next()};
+                Counted_Object::reset();
+                container.push_back(value);
+                check_counts(operation, Counted_Object::counts(), {
+                    .copy_constructions = 1u,
+                });
+                reference.push_back(value);
+                break;
+            }
+
+            case Operation::pop_back: {
+                if (target_size == 0u) {
+                    break;
+                }
+                Counted_Object::reset();
+                container.pop_back();
+                check_counts(operation, Counted_Object::counts(), {
+                    .destructions = 1u,
+                });
+                reference.pop_back();
+                break;
+            }
+
+            case Operation::clear: {
+                Counted_Object::reset();
+                container.clear();
+                check_counts(operation, Counted_Object::counts(), {
+                    .destructions = target_size,
+                });
+                reference.clear();
+                break;
+            }
+
+            case Operation::copy_construct: {
+                Counted_Object::reset();
+                {
+                    Container const copy{container};
+                    check_contents(operation, copy, reference);
+                }
+                check_counts(operation, Counted_Object::counts(), {
+                    .copy_constructions = target_size,
+                    .destructions = target_size,
+                });
+                break;
+            }
+
+            case Operation::move_construct: {
+                // The moved-to container is dropped, which leaves the target
+                // empty.
+                Counted_Object::reset();
+                {
+                    Container const moved{exfs::move(container)};
+                    check_contents(operation, moved, reference);
+                }
+                check_counts(operation, Counted_Object::counts(), {
+                    .move_constructions = target_size,
+                    .destructions = 2u * target_size,
+                });
+                reference.clear();
+                break;
+            }
+
+            case Operation::copy_assign: {
+                Counted_Object::reset();
+                container = actual[source];
+                check_counts(operation, Counted_Object::counts(), {
+                    .copy_constructions = excess(source_size, target_size),
+                    .copy_assignments = min(source_size, target_size),
+                    .destructions = excess(target_size, source_size),
+                });
+                reference = expected[source];
+                break;
+            }
+
+            case Operation::move_assign: {
+                // Every element of the source is destroyed after it is moved
+                // from, and the source is left empty.
+                Counted_Object::reset();
+                container = exfs::move(actual[source]);
+                check_counts(operation, Counted_Object::counts(), {
+                    .move_constructions = excess(source_size, target_size),
+                    .move_assignments = min(source_size, target_size),
+                    .destructions =
+                        excess(target_size, source_size) + source_size,
+                });
+                reference = exfs::move(expected[source]);
+                expected[source].clear();
+                break;
+            }
+
+            case Operation::count: break;
+        }
+
+        check_contents(operation, actual[target], expected[target]);
+        check_contents(operation, actual[source], expected[source]);
+    }
+
+    return 0;
+}
@@ -6,6 +6,8 @@
 #include <initializer_list>
 #include <type_traits>
 
+#include "exfs/algorithm/bitwise.hpp"
+#include "exfs/algorithm/copy.hpp"
 #include "exfs/iterator/concepts.hpp"
 #include "exfs/iterator/reverse_iterator.hpp"
 #include "exfs/memory/storage.hpp"
@@ -102,6 +104,16 @@ class static_vector {
      * Constructs the container with the contents of the range
      * [first, sentinel).
      *
+     * When the size of the range is known in constant time, as for a counted
+     * range `[counted_iterator{it, n}, default_sentinel)`, it is computed once
+     * up front and the elements are copied without comparing @p first with
+     * @p sentinel at every step. Trivially copyable elements of a contiguous
+     * range are then copied with a single @c memmove, including when they are
+     * moved through a @c move_iterator.
+     *
+     * Moving the elements of another container in with @c move_iterator
+     * move-constructs them instead of copying them.
+     *
      * @warning It is undefined behavior if `distance(first, sentinel)` is
      *     greater than the static capacity of the container.
      *
@@ -114,9 +126,34 @@ class static_vector {
     >
     constexpr static_vector (Iterator first, Sentinel sentinel)
     noexcept(std::is_nothrow_constructible_v<T, decltype(*first)>) {
-        for (size_ = 0u; first != sentinel; ++size_, ++first) {
-            storage_[size_].construct(*first);
+        size_type count = 0u;
+        if constexpr (exfs::iterator::sized_sentinel_for<Sentinel, Iterator>) {
+            auto const size = static_cast<size_type>(sentinel - first);
+            if constexpr (
+                algorithm::__detail::__bitwise_copyable<
+                    algorithm::__detail::__unwrap_move_t<Iterator>,
+                    pointer
+                >
+            ) {
+                if (not std::is_constant_evaluated()) {
+                    algorithm::__detail::__memmove_n(
+                        algorithm::__detail::__unwrap(first),
+                        static_cast<difference_type>(size),
+                        data()
+                    );
+                    size_ = size;
+                    return;
+                }
+            }
+            for (; count < size; ++count, ++first) {
+                storage_[count].construct(*first);
+            }
+        } else {
+            for (; first != sentinel; ++count, ++first) {
+                storage_[count].construct(*first);
+            }
         }
+        size_ = count;
     }
 
     /**
@@ -195,7 +232,8 @@ class static_vector {
 
     /**
      * Copy assignment operator. Replaces the contents with a copy of the
-     * contents of other.
+     * contents of other. Trivially copyable elements are copied with a single
+     * @c memmove.
      * @param[in] other The container object to copy from.
      * @return A reference to the current container object.
      */
@@ -204,6 +242,18 @@ class static_vector {
         std::is_nothrow_copy_assignable_v<value_type> and
         std::is_nothrow_copy_constructible_v<value_type>
     ) {
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            if (not std::is_constant_evaluated()) {
+                algorithm::__detail::__memmove_n(
+                    other.data(),
+                    static_cast<difference_type>(other.size_),
+                    data()
+                );
+                size_ = other.size_;
+                return *this;
+            }
+        }
+
         // This implementation assumes that copy-assigning T is cheaper than T's
         // destructor + copy-constructor. The approach here is to iterate over
         // the two containers in lock-step doing the minimal action required.
@@ -230,8 +280,9 @@ class static_vector {
 
     /**
      * Move assignment operator. Replaces the contents with those of @p other
-     * using element-wise move construction/assignment. After this call, @p
-     * other will be empty.
+     * using element-wise move construction/assignment, or a single @c memmove
+     * for trivially copyable elements. After this call, @p other will be
+     * empty.
      * @param[in] other The container object to move from.
      * @return A reference to the current container object.
      */
@@ -240,6 +291,18 @@ class static_vector {
         std::is_nothrow_move_assignable_v<value_type> and
         std::is_nothrow_move_constructible_v<value_type>
     ) {
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            if (not std::is_constant_evaluated()) {
+                algorithm::__detail::__memmove_n(
+                    other.data(),
+                    static_cast<difference_type>(other.size_),
+                    data()
+                );
+                size_ = exfs::exchange(other.size_, 0u);
+                return *this;
+            }
+        }
+
         // This implementation assumes that move-assigning T is cheaper than T's
         // destructor + move-constructor. The approach here is to iterator over
         // the two containers in lock-step doing the minimal action required.
@@ -281,18 +344,79 @@ class static_vector {
      * @{
      */
 
-    // constexpr iterator               begin()         noexcept;
-    // constexpr const_iterator         begin()   const noexcept;
-    // constexpr const_iterator         cbegin()  const noexcept;
-    // constexpr iterator               end()           noexcept;
-    // constexpr const_iterator         end()     const noexcept;
-    // constexpr const_iterator         cend()    const noexcept;
-    // constexpr reverse_iterator       rbegin()        noexcept;
-    // constexpr const_reverse_iterator rbegin()  const noexcept;
-    // constexpr const_reverse_iterator crbegin() const noexcept;
-    // constexpr reverse_iterator       rend()          noexcept;
-    // constexpr const_reverse_iterator rend()    const noexcept;
-    // constexpr const_reverse_iterator crend()   const noexcept;
+    /**
+     * Returns an iterator to the first element of the container. If the
+     * container is empty, the returned iterator is equal to @c end().
+     */
+    constexpr iterator begin () noexcept { return data(); }
+
+    /**
+     * @overload begin()
+     */
+    constexpr const_iterator begin () const noexcept { return data(); }
+
+    /**
+     * @overload begin()
+     */
+    constexpr const_iterator cbegin () const noexcept { return begin(); }
+
+    /**
+     * Returns an iterator one past the last element of the container.
+     */
+    constexpr iterator end () noexcept { return data() + size_; }
+
+    /**
+     * @overload end()
+     */
+    constexpr const_iterator end () const noexcept { return data() + size_; }
+
+    /**
+     * @overload end()
+     */
+    constexpr const_iterator cend () const noexcept { return end(); }
+
+    /**
+     * Returns a reverse iterator to the last element of the container.
+     */
+    constexpr reverse_iterator rbegin () noexcept {
+        return reverse_iterator{end()};
+    }
+
+    /**
+     * @overload rbegin()
+     */
+    constexpr const_reverse_iterator rbegin () const noexcept {
+        return const_reverse_iterator{end()};
+    }
+
+    /**
+     * @overload rbegin()
+     */
+    constexpr const_reverse_iterator crbegin () const noexcept {
+        return rbegin();
+    }
+
+    /**
+     * Returns a reverse iterator one before the first element of the
+     * container.
+     */
+    constexpr reverse_iterator rend () noexcept {
+        return reverse_iterator{begin()};
+    }
+
+    /**
+     * @overload rend()
+     */
+    constexpr const_reverse_iterator rend () const noexcept {
+        return const_reverse_iterator{begin()};
+    }
+
+    /**
+     * @overload rend()
+     */
+    constexpr const_reverse_iterator crend () const noexcept {
+        return rend();
+    }
 
     /**
      * @}
@@ -403,8 +527,21 @@ class static_vector {
         return this->operator[](size_ - 1);
     }
 
-    // constexpr       T* data()       noexcept;
-    // constexpr const T* data() const noexcept;
+    /**
+     * Returns a pointer to the underlying array of elements, such that
+     * `[data(), data() + size())` is a valid range even when the container is
+     * empty.
+     */
+    constexpr pointer data () noexcept {
+        return reinterpret_cast<pointer>(storage_);
+    }
+
+    /**
+     * @overload data()
+     */
+    constexpr const_pointer data () const noexcept {
+        return reinterpret_cast<const_pointer>(storage_);
+    }
 
     /**
      * @}
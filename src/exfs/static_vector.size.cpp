@@ -0,0 +1,72 @@
+// Instantiations of the operations of exfs::static_vector, measured by the
+// code_size target, for trivially copyable elements which are copied as bytes
+// and for elements with out-of-line copy and move operations.
+#include "exfs/static_vector.hpp"
+
+#include <cstdint>
+
+namespace code_size {
+struct Sample {
+    std::uint16_t channel;
+    std::uint16_t value;
+};
+
+// Its operations are only declared: the code size of the container, not of
+// the element, is measured.
+struct Handle {
+    Handle (Handle const& other);
+    Handle (Handle&& other) noexcept;
+    Handle& operator = (Handle const& other);
+    Handle& operator = (Handle&& other) noexcept;
+    ~Handle ();
+
+    void* resource;
+};
+
+using Samples = exfs::static_vector<Sample, 32>;
+using Handles = exfs::static_vector<Handle, 8>;
+}  // namespace code_size
+
+using code_size::Handle;
+using code_size::Handles;
+using code_size::Sample;
+using code_size::Samples;
+
+extern "C" {
+void code_size_static_vector_copy_assign_trivial (
+    Samples& dest,
+    Samples const& source
+) {
+    dest = source;
+}
+
+void code_size_static_vector_move_assign_trivial (
+    Samples& dest,
+    Samples& source
+) {
+    dest = static_cast<Samples&&>(source);
+}
+
+void code_size_static_vector_push_back_trivial (Samples& samples, Sample s) {
+    samples.push_back(s);
+}
+
+void code_size_static_vector_copy_assign (
+    Handles& dest,
+    Handles const& source
+) {
+    dest = source;
+}
+
+void code_size_static_vector_move_assign (Handles& dest, Handles& source) {
+    dest = static_cast<Handles&&>(source);
+}
+
+void code_size_static_vector_push_back (Handles& handles, Handle const& h) {
+    handles.push_back(h);
+}
+
+void code_size_static_vector_clear (Handles& handles) {
+    handles.clear();
+}
+}
@@ -11,7 +11,11 @@
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
 
+#include "exfs/iterator/counted_iterator.hpp"
+#include "exfs/iterator/move_iterator.hpp"
 #include "exfs/iterator/reverse_iterator.hpp"
+#include "exfs/iterator/sentinels.hpp"
+#include "exfs/testing/Counted_Object.hpp"
 #include "exfs/testing/Regular_Object.hpp"
 #include "exfs/utility/functions.hpp"
 
@@ -117,6 +121,36 @@ SCENARIO (
                 CHECK(container[1].id() == 3);
             }
         }
+
+        WHEN ("constructing a container by moving from the source range") {
+            REQUIRE_OBJECT_LIFETIME(move, 2, 0);
+            REQUIRE_OBJECT_LIFETIME(move, 3, 1);
+
+            Container container{
+                exfs::iterator::move_iterator{src.begin()},
+                exfs::iterator::move_iterator{src.end()}
+            };
+
+            THEN ("the objects are moved rather than copied") {
+                CHECK(container.size() == src.size());
+                CHECK(container[0].id() == 2);
+                CHECK(container[1].id() == 3);
+            }
+        }
+
+        WHEN ("constructing a container from a counted prefix of the range") {
+            REQUIRE_OBJECT_LIFETIME(copy, 2, 0);
+
+            Container container{
+                exfs::iterator::counted_iterator{src.begin(), 1},
+                exfs::iterator::default_sentinel
+            };
+
+            THEN ("the container has the counted objects") {
+                CHECK(container.size() == 1u);
+                CHECK(container[0].id() == 2);
+            }
+        }
     }
 
     GIVEN ("a container of 3 initial objects") {
@@ -444,6 +478,59 @@ SCENARIO (
     }
 }
 
+SCENARIO (
+    "exfs::static_vector - iterators",
+    "[unit][static_vector]"
+) {
+    using namespace std::literals::string_literals;
+    using Container = exfs::static_vector<std::string, 4u>;
+
+    GIVEN ("a container of 3 elements") {
+        Container container{{"first"s, "second"s, "third"s}};
+        Container const& ccont = container;
+
+        THEN ("the iterators span the elements in order") {
+            CHECK(container.end() - container.begin() == 3);
+            CHECK(container.begin() == container.data());
+            CHECK(&*container.begin() == &container.front());
+            CHECK(&*(ccont.end() - 1) == &container.back());
+            CHECK(std::is_same_v<decltype(ccont.begin()), std::string const*>);
+            CHECK(ccont.cbegin() == ccont.begin());
+            CHECK(ccont.cend() == ccont.end());
+        }
+
+        THEN ("the reverse iterators span the elements in reverse order") {
+            std::vector<std::string> const reversed(
+                container.rbegin(),
+                container.rend()
+            );
+            CHECK(reversed == std::vector{"third"s, "second"s, "first"s});
+            CHECK(*ccont.crbegin() == "third"s);
+            CHECK(ccont.crend() - ccont.crbegin() == 3);
+        }
+
+        WHEN ("elements are modified through an iterator") {
+            for (auto& elem : container) {
+                elem += "!";
+            }
+
+            THEN ("the changes are reflected in the container") {
+                CHECK(container[0] == "first!"s);
+                CHECK(container[2] == "third!"s);
+            }
+        }
+    }
+
+    GIVEN ("an empty container") {
+        Container container{};
+
+        THEN ("the begin and end iterators are equal") {
+            CHECK(container.begin() == container.end());
+            CHECK(container.rbegin() == container.rend());
+        }
+    }
+}
+
 SCENARIO (
     "exfs::static_vector - modifiers",
     "[unit][static_vector]"
@@ -560,3 +647,127 @@ SCENARIO (
 }
 
 #undef REQUIRE_OBJECT_LIFETIME
+
+SCENARIO (
+    "exfs::static_vector - trivially copyable range construction",
+    "[unit][static_vector]"
+) {
+    GIVEN ("a buffer of integers") {
+        std::array<int, 6u> const src{1, 2, 3, 4, 5, 6};
+
+        WHEN ("constructing a container from a contiguous range") {
+            exfs::static_vector<int, 8u> const container(
+                src.begin() + 1,
+                src.end()
+            );
+
+            THEN ("the elements are copied") {
+                CHECK(container.size() == 5u);
+                CHECK(container.front() == 2);
+                CHECK(container.back() == 6);
+            }
+        }
+
+        WHEN ("constructing a container from a counted move range") {
+            exfs::static_vector<int, 8u> const container(
+                exfs::iterator::move_iterator{
+                    exfs::iterator::counted_iterator{src.data(), 3}
+                },
+                exfs::iterator::move_sentinel{exfs::iterator::default_sentinel}
+            );
+
+            THEN ("the counted elements are copied") {
+                CHECK(container.size() == 3u);
+                CHECK(container[0] == 1);
+                CHECK(container[2] == 3);
+            }
+        }
+    }
+
+    GIVEN ("containers of integers of different sizes") {
+        std::array<int, 6u> const src{1, 2, 3, 4, 5, 6};
+        exfs::static_vector<int, 8u> longer(src.begin(), src.end());
+        exfs::static_vector<int, 8u> shorter(src.begin(), src.begin() + 2);
+
+        WHEN ("the shorter one is copy-assigned to the longer one") {
+            longer = shorter;
+
+            THEN ("the longer one holds a copy of its elements") {
+                CHECK(longer.size() == 2u);
+                CHECK(longer[0] == 1);
+                CHECK(longer[1] == 2);
+                CHECK(shorter.size() == 2u);
+            }
+        }
+
+        WHEN ("the longer one is move-assigned to the shorter one") {
+            shorter = exfs::move(longer);
+
+            THEN ("the elements are transferred") {
+                CHECK(shorter.size() == 6u);
+                CHECK(shorter[0] == 1);
+                CHECK(shorter[5] == 6);
+                CHECK(longer.empty());
+            }
+        }
+
+        WHEN ("a container is assigned to itself") {
+            auto& self = longer;
+            longer = self;
+
+            THEN ("it is unchanged") {
+                CHECK(longer.size() == 6u);
+                CHECK(longer[3] == 4);
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::static_vector - operation counts",
+    "[unit][static_vector]"
+) {
+    using exfs::testing::Counted_Object;
+    using Container = exfs::static_vector<Counted_Object, 8u>;
+
+    GIVEN ("a container of five objects and a container of three") {
+        Container longer(5u, Counted_Object{1});
+        Container shorter(3u, Counted_Object{2});
+        Counted_Object::reset();
+
+        WHEN ("move-assigning the longer one to the shorter one") {
+            shorter = exfs::move(longer);
+
+            THEN ("each element is moved once and nothing is copied") {
+                auto const& counts = Counted_Object::counts();
+                CHECK(counts.copies() == 0u);
+                CHECK(counts.move_assignments == 3u);
+                CHECK(counts.move_constructions == 2u);
+                CHECK(counts.destructions == 5u);
+            }
+        }
+
+        WHEN ("move-constructing a new container from the longer one") {
+            Container moved{exfs::move(longer)};
+
+            THEN ("each element is moved once and nothing is copied") {
+                auto const& counts = Counted_Object::counts();
+                CHECK(counts.copies() == 0u);
+                CHECK(counts.move_constructions == 5u);
+                CHECK(counts.destructions == 5u);
+            }
+        }
+
+        WHEN ("copy-assigning the longer one to the shorter one") {
+            shorter = longer;
+
+            THEN ("each element is copied once and nothing is moved") {
+                auto const& counts = Counted_Object::counts();
+                CHECK(counts.moves() == 0u);
+                CHECK(counts.copy_assignments == 3u);
+                CHECK(counts.copy_constructions == 2u);
+                CHECK(counts.destructions == 0u);
+            }
+        }
+    }
+}
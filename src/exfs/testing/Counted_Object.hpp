@@ -0,0 +1,175 @@
+#ifndef EXFS_TESTING_COUNTED_OBJECT_HPP_
+#define EXFS_TESTING_COUNTED_OBJECT_HPP_
+
+#include <cstddef>
+
+#include <concepts>
+
+namespace exfs::testing {
+/**
+ * Type used as a stand-in for a [C++ Concept] "regular" type which counts its
+ * special member function calls.
+ *
+ * This is a lightweight companion to @c Regular_Object. Instead of reporting
+ * each call to a mock, it only increments a counter, so it can be used in
+ * benchmarks and large randomized tests. It conforms to the @c std::regular
+ * concept.
+ *
+ * Each instance holds an @c int representing the "data identity" of the
+ * object, which is copied, moved and assigned like that of @c Regular_Object.
+ * Instances have no ID.
+ *
+ * The counters are thread-local, so tests and benchmarks running on different
+ * threads do not see each other's operations. Call @c reset() before the
+ * operations to measure and read them with @c counts().
+ */
+class Counted_Object {
+  public:
+    /**
+     * The number of calls of each special member function since the last call
+     * to @c reset().
+     */
+    struct Counts {
+        std::size_t default_constructions = 0u;
+        std::size_t copy_constructions = 0u;
+        std::size_t move_constructions = 0u;
+        std::size_t value_constructions = 0u;
+        std::size_t copy_assignments = 0u;
+        std::size_t move_assignments = 0u;
+        std::size_t destructions = 0u;
+
+        /**
+         * The number of objects constructed in any way.
+         */
+        constexpr std::size_t constructions () const noexcept {
+            return default_constructions + copy_constructions +
+                move_constructions + value_constructions;
+        }
+
+        /**
+         * The number of copy constructions and copy assignments.
+         */
+        constexpr std::size_t copies () const noexcept {
+            return copy_constructions + copy_assignments;
+        }
+
+        /**
+         * The number of move constructions and move assignments.
+         */
+        constexpr std::size_t moves () const noexcept {
+            return move_constructions + move_assignments;
+        }
+
+        friend constexpr bool operator == (
+            Counts const&,
+            Counts const&
+        ) = default;
+    };
+
+    /**
+     * Reset all counters to zero.
+     */
+    static void reset () noexcept { counts_() = Counts{}; }
+
+    /**
+     * The counters of the calling thread.
+     */
+    static Counts const& counts () noexcept { return counts_(); }
+
+    /**
+     * Default construct a new object with a data value of zero.
+     */
+    Counted_Object () noexcept : data_{0} {
+        ++counts_().default_constructions;
+    }
+
+    /**
+     * Copy construct a new object with the data value of @p other_obj.
+     */
+    Counted_Object (Counted_Object const& other_obj) noexcept
+      : data_{other_obj.data_}
+    {
+        ++counts_().copy_constructions;
+    }
+
+    /**
+     * "Move" construct a new object with the data value of @p other_obj.
+     */
+    Counted_Object (Counted_Object&& other_obj) noexcept
+      : data_{other_obj.data_}
+    {
+        ++counts_().move_constructions;
+    }
+
+    /**
+     * Construct a new object using the given value.
+     */
+    explicit Counted_Object (int data) noexcept : data_{data} {
+        ++counts_().value_constructions;
+    }
+
+    /**
+     * "Destroy" the object. Nothing is actually cleaned up. This just counts
+     * the destructor call.
+     */
+    ~Counted_Object () { ++counts_().destructions; }
+
+    /**
+     * Copy assign the data value of @p other_obj.
+     */
+    Counted_Object& operator = (Counted_Object const& other_obj) noexcept {
+        ++counts_().copy_assignments;
+        data_ = other_obj.data_;
+
+        return *this;
+    }
+
+    /**
+     * "Move" assign the data value of @p other_obj.
+     */
+    Counted_Object& operator = (Counted_Object&& other_obj) noexcept {
+        ++counts_().move_assignments;
+        data_ = other_obj.data_;
+
+        return *this;
+    }
+
+    /**
+     * Value representing the "data identity" of the object.
+     */
+    int data () const noexcept { return data_; }
+
+  private:
+    int data_;
+
+    /**
+     * Helper function to get the counters of the calling thread.
+     */
+    static Counts& counts_ () noexcept {
+        thread_local Counts counts{};
+        return counts;
+    }
+};
+
+/**
+ * Compare two @c Counted_Object instances for semantic equality.
+ * @return @c true if they have the same data, else @c false.
+ */
+inline bool operator ==
+(Counted_Object const& obj_a, Counted_Object const& obj_b) {
+    return obj_a.data() == obj_b.data();
+}
+
+/**
+ * Compare two @c Counted_Object instances for semantic inequality.
+ * @return @c true if they have different data, else @c false.
+ */
+inline bool operator !=
+(Counted_Object const& obj_a, Counted_Object const& obj_b) {
+    return obj_a.data() != obj_b.data();
+}
+
+static_assert(std::regular<Counted_Object>);
+}  // namespace exfs::testing
+
+#endif  // EXFS_TESTING_COUNTED_OBJECT_HPP_
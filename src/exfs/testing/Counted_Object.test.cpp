@@ -0,0 +1,87 @@
+#include "exfs/testing/Counted_Object.hpp"
+
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/utility/functions.hpp"
+
+SCENARIO (
+    "exfs::testing::Counted_Object - operation counts",
+    "[unit][testing][counted_object]"
+) {
+    using exfs::testing::Counted_Object;
+    Counted_Object::reset();
+
+    GIVEN ("no operations since the counters were reset") {
+        THEN ("all counters are zero") {
+            CHECK(Counted_Object::counts() == Counted_Object::Counts{});
+        }
+    }
+
+    GIVEN ("an object constructed from a value") {
+        Counted_Object obj{7};
+
+        THEN ("one value construction is counted") {
+            CHECK(Counted_Object::counts().value_constructions == 1u);
+            CHECK(Counted_Object::counts().constructions() == 1u);
+            CHECK(obj.data() == 7);
+        }
+
+        WHEN ("copying and moving it into new objects") {
+            Counted_Object copy{obj};
+            Counted_Object moved{exfs::move(copy)};
+
+            THEN ("a copy and a move construction are counted") {
+                auto const& counts = Counted_Object::counts();
+                CHECK(counts.copy_constructions == 1u);
+                CHECK(counts.move_constructions == 1u);
+                CHECK(counts.copies() == 1u);
+                CHECK(counts.moves() == 1u);
+                CHECK(counts.constructions() == 3u);
+                CHECK(moved == obj);
+            }
+        }
+
+        WHEN ("assigning it to other objects") {
+            Counted_Object copied{};
+            Counted_Object moved{};
+            copied = obj;
+            moved = exfs::move(copied);
+
+            THEN ("a copy and a move assignment are counted") {
+                auto const& counts = Counted_Object::counts();
+                CHECK(counts.default_constructions == 2u);
+                CHECK(counts.copy_assignments == 1u);
+                CHECK(counts.move_assignments == 1u);
+                CHECK(counts.copies() == 1u);
+                CHECK(counts.moves() == 1u);
+                CHECK(moved.data() == 7);
+            }
+        }
+
+        WHEN ("the counters are reset") {
+            Counted_Object::reset();
+
+            THEN ("earlier operations are no longer counted") {
+                CHECK(Counted_Object::counts() == Counted_Object::Counts{});
+            }
+        }
+    }
+
+    GIVEN ("an object which goes out of scope") {
+        { Counted_Object obj{}; }
+
+        THEN ("its destruction is counted") {
+            CHECK(Counted_Object::counts().destructions == 1u);
+        }
+    }
+
+    GIVEN ("objects constructed on another thread") {
+        std::thread{[] { Counted_Object objs[3]{}; }}.join();
+
+        THEN ("the counters of this thread are unchanged") {
+            CHECK(Counted_Object::counts() == Counted_Object::Counts{});
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef EXFS_UTILITY_COMPARISON_HPP_
+#define EXFS_UTILITY_COMPARISON_HPP_
+
+#include <concepts>
+
+#include "exfs/utility/functions.hpp"
+
+namespace exfs {
+/**
+ * Function object performing `a < b`. Like @c std::ranges::less, the argument
+ * types are deduced at the call site, so it can compare any pair of types
+ * which are totally ordered with each other.
+ */
+struct less {
+    using is_transparent = void;
+
+    template <typename T, typename U>
+    requires (std::totally_ordered_with<T, U>)
+    constexpr bool operator () (T&& a, U&& b) const
+    noexcept(noexcept(bool(exfs::forward<T>(a) < exfs::forward<U>(b)))) {
+        return exfs::forward<T>(a) < exfs::forward<U>(b);
+    }
+};
+
+/**
+ * Function object performing `a > b`. Like @c std::ranges::greater, the
+ * argument types are deduced at the call site, so it can compare any pair of
+ * types which are totally ordered with each other.
+ */
+struct greater {
+    using is_transparent = void;
+
+    template <typename T, typename U>
+    requires (std::totally_ordered_with<T, U>)
+    constexpr bool operator () (T&& a, U&& b) const
+    noexcept(noexcept(bool(exfs::forward<U>(b) < exfs::forward<T>(a)))) {
+        return exfs::forward<U>(b) < exfs::forward<T>(a);
+    }
+};
+}  // namespace exfs
+
+#endif  // EXFS_UTILITY_COMPARISON_HPP_
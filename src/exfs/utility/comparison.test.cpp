@@ -0,0 +1,42 @@
+#include "exfs/utility/comparison.hpp"
+
+#include <functional>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+TEMPLATE_TEST_CASE (
+    "exfs::less",
+    "[unit][std-parity][utility]",
+    std::ranges::less,
+    exfs::less
+) {
+    TestType less{};
+
+    THEN ("it compares values with operator <") {
+        CHECK(less(1, 2));
+        CHECK(not less(2, 1));
+        CHECK(not less(2, 2));
+        CHECK(less(1, 2.5));
+        CHECK(less(std::string{"abc"}, std::string{"abd"}));
+        CHECK(noexcept(less(1, 2)));
+    }
+}
+
+TEMPLATE_TEST_CASE (
+    "exfs::greater",
+    "[unit][std-parity][utility]",
+    std::ranges::greater,
+    exfs::greater
+) {
+    TestType greater{};
+
+    THEN ("it compares values with reversed operator <") {
+        CHECK(greater(2, 1));
+        CHECK(not greater(1, 2));
+        CHECK(not greater(2, 2));
+        CHECK(greater(2.5, 1));
+        CHECK(greater(std::string{"abd"}, std::string{"abc"}));
+        CHECK(noexcept(greater(1, 2)));
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef EXFS_UTILITY_COMPRESSED_PAIR_HPP_
+#define EXFS_UTILITY_COMPRESSED_PAIR_HPP_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "exfs/utility/tuple.hpp"
+
+namespace exfs {
+/**
+ * Pair of values in which an element of an empty class type takes no space.
+ *
+ * This is meant for storing stateless policies such as comparators or
+ * allocators next to data: `compressed_pair<exfs::less, int*>` has the size
+ * of a pointer, whereas @c exfs::utility::pair would add a byte plus padding.
+ * Because an empty element may share its address with the other element, the
+ * elements are accessed through the @c first() and @c second() member
+ * functions (or @c get) rather than data members.
+ */
+template <typename T1, typename T2>
+class compressed_pair
+      : public __detail::__tuple_storage<index_sequence<0u, 1u>, T1, T2> {
+    using base_ = __detail::__tuple_storage<index_sequence<0u, 1u>, T1, T2>;
+
+  public:
+    using first_type  = T1;
+    using second_type = T2;
+
+    using base_::base_;
+
+    constexpr T1& first () noexcept { return exfs::get<0u>(*this); }
+    constexpr T1 const& first () const noexcept {
+        return exfs::get<0u>(*this);
+    }
+
+    constexpr T2& second () noexcept { return exfs::get<1u>(*this); }
+    constexpr T2 const& second () const noexcept {
+        return exfs::get<1u>(*this);
+    }
+};
+
+template <typename T1, typename T2>
+compressed_pair (T1, T2) -> compressed_pair<T1, T2>;
+}  // namespace exfs
+
+template <typename T1, typename T2>
+struct std::tuple_size<exfs::compressed_pair<T1, T2>>
+      : std::integral_constant<std::size_t, 2u> {};
+
+template <std::size_t I, typename T1, typename T2>
+struct std::tuple_element<I, exfs::compressed_pair<T1, T2>> {
+    using type = std::conditional_t<I == 0u, T1, T2>;
+};
+
+#endif  // EXFS_UTILITY_COMPRESSED_PAIR_HPP_
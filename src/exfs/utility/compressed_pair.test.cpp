@@ -0,0 +1,104 @@
+#include "exfs/utility/compressed_pair.hpp"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/utility/comparison.hpp"
+#include "exfs/utility/pair.hpp"
+
+namespace {
+struct Empty {};
+
+struct Counting_Deleter {
+    int* count;
+
+    void operator () (int* ptr) const {
+        ++*count;
+        delete ptr;
+    }
+};
+
+static_assert(sizeof(exfs::compressed_pair<exfs::less, int*>) == sizeof(int*));
+static_assert(sizeof(exfs::compressed_pair<int*, Empty>) == sizeof(int*));
+static_assert(
+    sizeof(exfs::utility::pair<exfs::less, int*>) == 2u * sizeof(int*)
+);
+static_assert(
+    sizeof(exfs::compressed_pair<Counting_Deleter, int*>) == 2u * sizeof(int*)
+);
+static_assert(std::is_trivially_copyable_v<exfs::compressed_pair<int, Empty>>);
+}  // namespace
+
+SCENARIO (
+    "exfs::compressed_pair",
+    "[unit][compressed_pair]"
+) {
+    using namespace std::literals::string_literals;
+
+    GIVEN ("a pair of a stateless comparator and a value") {
+        exfs::compressed_pair<exfs::less, int> pair{exfs::less{}, 5};
+
+        THEN ("both elements are accessible") {
+            CHECK(pair.first()(3, pair.second()));
+            CHECK(std::is_same_v<decltype(pair)::first_type, exfs::less>);
+            CHECK(std::is_same_v<decltype(pair)::second_type, int>);
+        }
+
+        WHEN ("the value is modified") {
+            pair.second() = 2;
+
+            THEN ("the change is visible through get") {
+                CHECK(exfs::get<1>(pair) == 2);
+            }
+        }
+    }
+
+    GIVEN ("a pair of non-empty elements") {
+        exfs::compressed_pair pair{"name"s, 3.5};
+
+        THEN ("it behaves like a regular pair") {
+            CHECK(pair.first() == "name");
+            CHECK(pair.second() == 3.5);
+            CHECK(std::is_same_v<
+                decltype(pair),
+                exfs::compressed_pair<std::string, double>
+            >);
+        }
+
+        WHEN ("it is decomposed with a structured binding") {
+            auto [name, value] = pair;
+
+            THEN ("the bindings are copies of the elements") {
+                CHECK(name == "name");
+                CHECK(value == 3.5);
+            }
+        }
+
+        WHEN ("it is copied") {
+            auto copy = pair;
+
+            THEN ("the copy compares equal") {
+                CHECK(copy == pair);
+            }
+        }
+    }
+
+    GIVEN ("a pair holding a stateful deleter") {
+        int deletions = 0;
+
+        WHEN ("the deleter is invoked through the pair") {
+            exfs::compressed_pair<Counting_Deleter, int*> pair{
+                Counting_Deleter{&deletions},
+                new int{4}
+            };
+            pair.first()(pair.second());
+
+            THEN ("the state is used") {
+                CHECK(deletions == 1);
+            }
+        }
+    }
+}
@@ -82,9 +82,9 @@ constexpr void swap (T& a, T& b) noexcept(
     std::is_nothrow_move_constructible_v<T> and
     std::is_nothrow_move_assignable_v<T>
 ) {
-    T tmp = move(a);
-    a = move(b);
-    b = move(tmp);
+    T tmp = exfs::move(a);
+    a = exfs::move(b);
+    b = exfs::move(tmp);
 }
 
 // TODO: swap() for built-in arrays
@@ -0,0 +1,44 @@
+#ifndef EXFS_UTILITY_IN_PLACE_HPP_
+#define EXFS_UTILITY_IN_PLACE_HPP_
+
+#include <cstddef>
+
+namespace exfs {
+/**
+ * Disambiguation tag that can be passed to the constructors of @c optional
+ * and @c variant to indicate that the contained object should be constructed
+ * in-place.
+ */
+struct in_place_t {
+    explicit in_place_t () = default;
+};
+
+inline constexpr in_place_t in_place{};
+
+/**
+ * Disambiguation tag that can be passed to the constructors of @c variant to
+ * indicate that the alternative of type @p T should be constructed in-place.
+ */
+template <typename T>
+struct in_place_type_t {
+    explicit in_place_type_t () = default;
+};
+
+template <typename T>
+inline constexpr in_place_type_t<T> in_place_type{};
+
+/**
+ * Disambiguation tag that can be passed to the constructors of @c variant to
+ * indicate that the alternative with index @p I should be constructed
+ * in-place.
+ */
+template <std::size_t I>
+struct in_place_index_t {
+    explicit in_place_index_t () = default;
+};
+
+template <std::size_t I>
+inline constexpr in_place_index_t<I> in_place_index{};
+}  // namespace exfs
+
+#endif  // EXFS_UTILITY_IN_PLACE_HPP_
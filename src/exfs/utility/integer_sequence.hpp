@@ -0,0 +1,59 @@
+#ifndef EXFS_UTILITY_INTEGER_SEQUENCE_HPP_
+#define EXFS_UTILITY_INTEGER_SEQUENCE_HPP_
+
+#include <cstddef>
+
+#include <concepts>
+
+namespace exfs {
+/**
+ * A compile-time sequence of integers. When used as an argument to a function
+ * template, the parameter pack @p ints can be deduced and used in pack
+ * expansion.
+ *
+ * @tparam T The integer type to use for the elements of the sequence.
+ * @tparam ints... The sequence of integers.
+ */
+template <std::integral T, T... ints>
+struct integer_sequence {
+    using value_type = T;
+
+    /**
+     * The number of elements in @p ints....
+     */
+    static constexpr std::size_t size () noexcept { return sizeof...(ints); }
+};
+
+/**
+ * Helper alias for the common case where @p T is @c std::size_t.
+ */
+template <std::size_t... ints>
+using index_sequence = integer_sequence<std::size_t, ints...>;
+
+/**
+ * Creates the sequence `0, 1, 2, ..., N - 1` of type @p T. Uses a compiler
+ * intrinsic so that instantiation is constant time regardless of @p N.
+ */
+#if __has_builtin(__make_integer_seq)
+template <typename T, T N>
+using make_integer_sequence = __make_integer_seq<integer_sequence, T, N>;
+#else  // __has_builtin(__make_integer_seq)
+template <typename T, T N>
+using make_integer_sequence = integer_sequence<T, __integer_pack(N)...>;
+#endif  // __has_builtin(__make_integer_seq)
+
+/**
+ * Helper alias for the common case where @p T is @c std::size_t.
+ */
+template <std::size_t N>
+using make_index_sequence = make_integer_sequence<std::size_t, N>;
+
+/**
+ * Converts the type parameter pack @p Ts... into an index sequence of the
+ * same length.
+ */
+template <typename... Ts>
+using index_sequence_for = make_index_sequence<sizeof...(Ts)>;
+}  // namespace exfs
+
+#endif  // EXFS_UTILITY_INTEGER_SEQUENCE_HPP_
@@ -0,0 +1,34 @@
+#include "exfs/utility/integer_sequence.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE (
+    "exfs::make_integer_sequence",
+    "[unit][utility]"
+) {
+    CHECK(std::is_same_v<
+        exfs::make_index_sequence<0u>,
+        exfs::index_sequence<>
+    >);
+    CHECK(std::is_same_v<
+        exfs::make_index_sequence<4u>,
+        exfs::index_sequence<0u, 1u, 2u, 3u>
+    >);
+    CHECK(std::is_same_v<
+        exfs::make_integer_sequence<short, 3>,
+        exfs::integer_sequence<short, 0, 1, 2>
+    >);
+    CHECK(std::is_same_v<
+        exfs::index_sequence_for<int, char, double>,
+        exfs::index_sequence<0u, 1u, 2u>
+    >);
+
+    CHECK(exfs::make_index_sequence<7u>::size() == 7u);
+    CHECK(std::is_same_v<
+        exfs::make_integer_sequence<long, 2>::value_type,
+        long
+    >);
+}
@@ -0,0 +1,112 @@
+#ifndef EXFS_UTILITY_SIMD_HPP_
+#define EXFS_UTILITY_SIMD_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace exfs::__detail {
+#if defined(__AVX2__) or defined(__SSE2__)
+#if defined(__AVX2__)
+using __simd_register = __m256i;
+#else
+using __simd_register = __m128i;
+#endif
+
+/**
+ * A vector register of integer lanes of type @p T_Lane, for the vectorized
+ * kernels of the library.
+ *
+ * Only the target selection, and moving values in and out of the register,
+ * are provided here: each kernel writes the operations it needs as free
+ * functions on the @c values member, with the intrinsics of each instruction
+ * set. It is 32 bytes wide when the target is compiled for AVX2 and 16 bytes
+ * wide for SSE2. It is not declared for other targets, so uses of it must be
+ * guarded by the same preprocessor conditions.
+ *
+ * @tparam T_Lane A 1, 2, 4 or 8-byte integer type.
+ */
+template <typename T_Lane>
+struct __simd_vector {
+    static_assert(
+        sizeof(T_Lane) == 1u or sizeof(T_Lane) == 2u or
+        sizeof(T_Lane) == 4u or sizeof(T_Lane) == 8u
+    );
+
+    /**
+     * The number of lanes.
+     */
+    static constexpr std::ptrdiff_t width =
+        sizeof(__simd_register) / sizeof(T_Lane);
+
+    __simd_register values;
+
+    /**
+     * Load @c width lanes from @p ptr, which does not need to be aligned.
+     */
+    static __simd_vector load (void const* ptr) noexcept {
+#if defined(__AVX2__)
+        return {_mm256_loadu_si256(static_cast<__m256i const*>(ptr))};
+#else
+        return {_mm_loadu_si128(static_cast<__m128i const*>(ptr))};
+#endif
+    }
+
+    /**
+     * Store the lanes to @p ptr, which does not need to be aligned.
+     */
+    void store (void* ptr) const noexcept {
+#if defined(__AVX2__)
+        _mm256_storeu_si256(static_cast<__m256i*>(ptr), values);
+#else
+        _mm_storeu_si128(static_cast<__m128i*>(ptr), values);
+#endif
+    }
+
+    /**
+     * A vector with every lane equal to @p value.
+     */
+    static __simd_vector splat (T_Lane value) noexcept {
+#if defined(__AVX2__)
+        if constexpr (sizeof(T_Lane) == 1u) {
+            return {_mm256_set1_epi8(static_cast<char>(value))};
+        } else if constexpr (sizeof(T_Lane) == 2u) {
+            return {_mm256_set1_epi16(static_cast<short>(value))};
+        } else if constexpr (sizeof(T_Lane) == 4u) {
+            return {_mm256_set1_epi32(static_cast<int>(value))};
+        } else {
+            return {_mm256_set1_epi64x(static_cast<long long>(value))};
+        }
+#else
+        if constexpr (sizeof(T_Lane) == 1u) {
+            return {_mm_set1_epi8(static_cast<char>(value))};
+        } else if constexpr (sizeof(T_Lane) == 2u) {
+            return {_mm_set1_epi16(static_cast<short>(value))};
+        } else if constexpr (sizeof(T_Lane) == 4u) {
+            return {_mm_set1_epi32(static_cast<int>(value))};
+        } else {
+            return {_mm_set1_epi64x(static_cast<long long>(value))};
+        }
+#endif
+    }
+
+    /**
+     * A vector with every lane zero.
+     */
+    static __simd_vector zero () noexcept {
+#if defined(__AVX2__)
+        return {_mm256_setzero_si256()};
+#else
+        return {_mm_setzero_si128()};
+#endif
+    }
+};
+#endif
+}  // namespace exfs::__detail
+
+#endif  // EXFS_UTILITY_SIMD_HPP_
@@ -0,0 +1,51 @@
+#include "exfs/utility/simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#if defined(__AVX2__) or defined(__SSE2__)
+TEMPLATE_TEST_CASE (
+    "exfs::__detail::__simd_vector",
+    "[unit][utility]",
+    unsigned char,
+    std::int16_t,
+    std::int32_t,
+    std::int64_t
+) {
+    using Vector = exfs::__detail::__simd_vector<TestType>;
+    constexpr auto width = static_cast<std::size_t>(Vector::width);
+
+    CHECK(width * sizeof(TestType) == sizeof(Vector));
+
+    // One lane of slack on each side catches loads and stores of the wrong
+    // width.
+    TestType values[width + 2u];
+    for (std::size_t i = 0u; i < width + 2u; ++i) {
+        values[i] = static_cast<TestType>(i * 37u + 1u);
+    }
+
+    SECTION ("unaligned loads and stores round trip") {
+        TestType out[width + 2u] = {};
+        Vector::load(values + 1).store(out + 1);
+        CHECK(out[0] == TestType{0});
+        for (std::size_t i = 1u; i <= width; ++i) {
+            CHECK(out[i] == values[i]);
+        }
+        CHECK(out[width + 1u] == TestType{0});
+    }
+
+    SECTION ("splat and zero fill every lane") {
+        TestType out[width];
+        Vector::splat(static_cast<TestType>(-3)).store(out);
+        for (auto const lane : out) {
+            CHECK(lane == static_cast<TestType>(-3));
+        }
+        Vector::zero().store(out);
+        for (auto const lane : out) {
+            CHECK(lane == TestType{0});
+        }
+    }
+}
+#endif
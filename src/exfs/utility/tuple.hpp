@@ -0,0 +1,333 @@
+#ifndef EXFS_UTILITY_TUPLE_HPP_
+#define EXFS_UTILITY_TUPLE_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/integer_sequence.hpp"
+
+namespace exfs {
+namespace __detail {
+template <std::size_t I, typename T, typename... Ts>
+struct __nth_type : __nth_type<I - 1u, Ts...> {};
+
+template <typename T, typename... Ts>
+struct __nth_type<0u, T, Ts...> {
+    using type = T;
+};
+
+template <std::size_t I, typename... Ts>
+using __nth_type_t = typename __nth_type<I, Ts...>::type;
+
+template <std::size_t I, typename U, typename... Us>
+constexpr decltype(auto) __nth_arg (U&& u, Us&&... us) noexcept {
+    if constexpr (I == 0u) {
+        return exfs::forward<U>(u);
+    } else {
+        return __nth_arg<I - 1u>(exfs::forward<Us>(us)...);
+    }
+}
+
+template <typename T>
+concept __ebo_candidate = std::is_empty_v<T> and not std::is_final_v<T>;
+
+// Holds the element with index I. Empty element types are inherited from so
+// that they take no space (the empty base optimization); other types are
+// stored as a member.
+template <std::size_t I, typename T, bool = __ebo_candidate<T>>
+class __tuple_leaf {
+  public:
+    constexpr __tuple_leaf () = default;
+
+    template <typename U>
+    requires (not std::same_as<std::remove_cvref_t<U>, __tuple_leaf>)
+    constexpr explicit __tuple_leaf (U&& u) : value_{exfs::forward<U>(u)} {}
+
+    constexpr T& __get () noexcept { return value_; }
+    constexpr T const& __get () const noexcept { return value_; }
+
+  private:
+    T value_{};
+};
+
+template <std::size_t I, typename T>
+class __tuple_leaf<I, T, true> : private T {
+  public:
+    constexpr __tuple_leaf () = default;
+
+    template <typename U>
+    requires (not std::same_as<std::remove_cvref_t<U>, __tuple_leaf>)
+    constexpr explicit __tuple_leaf (U&& u) : T(exfs::forward<U>(u)) {}
+
+    constexpr T& __get () noexcept { return *this; }
+    constexpr T const& __get () const noexcept { return *this; }
+};
+
+template <std::size_t N>
+struct __index_array {
+    std::size_t data[N > 0u ? N : 1u];
+};
+
+// The indices of Ts sorted by decreasing alignment of their leaves. The sort
+// is stable so that equally aligned elements keep their relative order.
+template <typename... Ts>
+constexpr __index_array<sizeof...(Ts)> __packed_order () noexcept {
+    constexpr std::size_t aligns[] = {alignof(__tuple_leaf<0u, Ts>)..., 0u};
+    __index_array<sizeof...(Ts)> order{};
+    for (std::size_t idx = 0u; idx < sizeof...(Ts); ++idx) {
+        std::size_t pos = idx;
+        while (pos > 0u and aligns[order.data[pos - 1u]] < aligns[idx]) {
+            order.data[pos] = order.data[pos - 1u];
+            --pos;
+        }
+        order.data[pos] = idx;
+    }
+    return order;
+}
+
+template <typename Positions, typename... Ts>
+struct __packed_sequence;
+
+template <std::size_t... Positions, typename... Ts>
+struct __packed_sequence<index_sequence<Positions...>, Ts...> {
+    static constexpr auto order = __packed_order<Ts...>();
+    using type = index_sequence<order.data[Positions]...>;
+};
+
+template <typename... Ts>
+using __packed_sequence_t = typename __packed_sequence<
+    index_sequence_for<Ts...>,
+    Ts...
+>::type;
+
+// Inherits one leaf per element, in the order given by Order. The order of
+// the bases determines the layout, while each leaf keeps its element index.
+template <typename Order, typename... Ts>
+class __tuple_storage;
+
+template <std::size_t... Order, typename... Ts>
+class __tuple_storage<index_sequence<Order...>, Ts...>
+      : public __tuple_leaf<Order, __nth_type_t<Order, Ts...>>... {
+  public:
+    constexpr __tuple_storage () = default;
+
+    template <typename... Us>
+    requires (
+        sizeof...(Us) == sizeof...(Ts) and
+        sizeof...(Us) > 0u and
+        (std::constructible_from<Ts, Us> and ...)
+    )
+    constexpr __tuple_storage (Us&&... args)
+          : __tuple_leaf<Order, __nth_type_t<Order, Ts...>>(
+                __nth_arg<Order>(exfs::forward<Us>(args)...)
+            )... {}
+
+    template <std::size_t I>
+    constexpr auto& __leaf () noexcept {
+        return static_cast<__tuple_leaf<I, __nth_type_t<I, Ts...>>&>(*this);
+    }
+
+    template <std::size_t I>
+    constexpr auto const& __leaf () const noexcept {
+        return static_cast<
+            __tuple_leaf<I, __nth_type_t<I, Ts...>> const&
+        >(*this);
+    }
+
+    friend constexpr bool
+    operator == (__tuple_storage const& a, __tuple_storage const& b)
+    requires (std::equality_comparable<Ts> and ...) {
+        return [&]<std::size_t... Is> (index_sequence<Is...>) {
+            return (
+                (a.template __leaf<Is>().__get() ==
+                    b.template __leaf<Is>().__get()) and ...
+            );
+        }(index_sequence_for<Ts...>{});
+    }
+};
+}  // namespace __detail
+
+/**
+ * @name get
+ *
+ * Extracts the element with index @p I from a @c tuple, @c packed_tuple or
+ * @c compressed_pair.
+ *
+ * @{
+ */
+
+template <std::size_t I, typename Order, typename... Ts>
+constexpr __detail::__nth_type_t<I, Ts...>&
+get (__detail::__tuple_storage<Order, Ts...>& t) noexcept {
+    return t.template __leaf<I>().__get();
+}
+
+template <std::size_t I, typename Order, typename... Ts>
+constexpr __detail::__nth_type_t<I, Ts...> const&
+get (__detail::__tuple_storage<Order, Ts...> const& t) noexcept {
+    return t.template __leaf<I>().__get();
+}
+
+template <std::size_t I, typename Order, typename... Ts>
+constexpr __detail::__nth_type_t<I, Ts...>&&
+get (__detail::__tuple_storage<Order, Ts...>&& t) noexcept {
+    using type = __detail::__nth_type_t<I, Ts...>;
+    return static_cast<type&&>(t.template __leaf<I>().__get());
+}
+
+template <std::size_t I, typename Order, typename... Ts>
+constexpr __detail::__nth_type_t<I, Ts...> const&&
+get (__detail::__tuple_storage<Order, Ts...> const&& t) noexcept {
+    using type = __detail::__nth_type_t<I, Ts...>;
+    return static_cast<type const&&>(t.template __leaf<I>().__get());
+}
+
+/**
+ * @}
+ */
+
+/**
+ * Fixed-size collection of heterogeneous values.
+ *
+ * Elements of empty class types take no space, so @c sizeof a tuple is the
+ * sum of the sizes of its non-empty elements plus padding. The elements are
+ * laid out in order; see @c packed_tuple for a layout which minimizes the
+ * padding. A tuple is trivially copyable when all of its element types are,
+ * and supports structured bindings.
+ *
+ * Elements are accessed with `get<I>(t)`.
+ */
+template <typename... Ts>
+class tuple
+      : public __detail::__tuple_storage<index_sequence_for<Ts...>, Ts...> {
+    using base_ = __detail::__tuple_storage<index_sequence_for<Ts...>, Ts...>;
+
+    template <typename Other, std::size_t... Is>
+    constexpr tuple (Other&& other, index_sequence<Is...>)
+          : base_(exfs::get<Is>(exfs::forward<Other>(other))...) {}
+
+  public:
+    using base_::base_;
+
+    /**
+     * @name Converting constructors
+     *
+     * Construct each element from the corresponding element of @p other, a
+     * tuple of the same size with different element types. For example, a
+     * tuple of references can be bound to the elements of a tuple of values.
+     *
+     * @{
+     */
+
+    template <typename... Us>
+    requires (
+        sizeof...(Us) == sizeof...(Ts) and
+        (std::constructible_from<Ts, Us&> and ...)
+    )
+    constexpr tuple (tuple<Us...>& other)
+          : tuple(other, index_sequence_for<Ts...>{}) {}
+
+    template <typename... Us>
+    requires (
+        sizeof...(Us) == sizeof...(Ts) and
+        (std::constructible_from<Ts, Us const&> and ...)
+    )
+    constexpr tuple (tuple<Us...> const& other)
+          : tuple(other, index_sequence_for<Ts...>{}) {}
+
+    template <typename... Us>
+    requires (
+        sizeof...(Us) == sizeof...(Ts) and
+        (std::constructible_from<Ts, Us&&> and ...)
+    )
+    constexpr tuple (tuple<Us...>&& other)
+          : tuple(exfs::move(other), index_sequence_for<Ts...>{}) {}
+
+    /**
+     * @}
+     */
+};
+
+template <typename... Ts>
+tuple (Ts...) -> tuple<Ts...>;
+
+/**
+ * Tuple whose elements are laid out in order of decreasing alignment to
+ * minimize padding, e.g. @c sizeof `packed_tuple<char, int, char>` is 8
+ * rather than 12. Only the layout differs from @c tuple: the elements keep
+ * their indices and are constructed from arguments in declaration order.
+ */
+template <typename... Ts>
+class packed_tuple
+      : public __detail::__tuple_storage<
+            __detail::__packed_sequence_t<Ts...>,
+            Ts...
+        > {
+    using base_ = __detail::__tuple_storage<
+        __detail::__packed_sequence_t<Ts...>,
+        Ts...
+    >;
+
+  public:
+    using base_::base_;
+};
+
+template <typename... Ts>
+packed_tuple (Ts...) -> packed_tuple<Ts...>;
+
+/**
+ * Creates a @c tuple holding copies of @p args....
+ */
+template <typename... Ts>
+constexpr tuple<std::decay_t<Ts>...> make_tuple (Ts&&... args) {
+    return tuple<std::decay_t<Ts>...>(exfs::forward<Ts>(args)...);
+}
+}  // namespace exfs
+
+template <typename... Ts>
+struct std::tuple_size<exfs::tuple<Ts...>>
+      : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <std::size_t I, typename... Ts>
+struct std::tuple_element<I, exfs::tuple<Ts...>> {
+    using type = exfs::__detail::__nth_type_t<I, Ts...>;
+};
+
+// The common reference of two tuples is the tuple of the common references of
+// their elements, e.g. `tuple<int&, char&>` for `tuple<int&, char&>` and
+// `tuple<int, char>&`. This lets a tuple of references be the reference type
+// of an iterator whose value type is a tuple of values.
+template <
+    typename... Ts,
+    typename... Us,
+    template <typename> typename TQual,
+    template <typename> typename UQual
+>
+requires (
+    sizeof...(Ts) == sizeof...(Us) and
+    requires { typename exfs::tuple<
+        std::common_reference_t<TQual<Ts>, UQual<Us>>...
+    >; }
+)
+struct std::basic_common_reference<
+    exfs::tuple<Ts...>,
+    exfs::tuple<Us...>,
+    TQual,
+    UQual
+> {
+    using type = exfs::tuple<std::common_reference_t<TQual<Ts>, UQual<Us>>...>;
+};
+
+template <typename... Ts>
+struct std::tuple_size<exfs::packed_tuple<Ts...>>
+      : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <std::size_t I, typename... Ts>
+struct std::tuple_element<I, exfs::packed_tuple<Ts...>> {
+    using type = exfs::__detail::__nth_type_t<I, Ts...>;
+};
+
+#endif  // EXFS_UTILITY_TUPLE_HPP_
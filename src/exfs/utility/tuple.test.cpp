@@ -0,0 +1,227 @@
+#include "exfs/utility/tuple.hpp"
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/utility/comparison.hpp"
+
+namespace {
+struct Empty {};
+struct Other_Empty {};
+
+// Size assertions on the layouts the tuples promise.
+static_assert(sizeof(exfs::tuple<int, Empty>) == sizeof(int));
+static_assert(sizeof(exfs::tuple<Empty, int, Other_Empty>) == sizeof(int));
+static_assert(sizeof(exfs::tuple<exfs::less, std::uint64_t>) == 8u);
+static_assert(sizeof(exfs::tuple<char, int, char>) == 12u);
+static_assert(sizeof(exfs::packed_tuple<char, int, char>) == 8u);
+static_assert(
+    sizeof(exfs::packed_tuple<char, double, short, Empty, int>) == 16u
+);
+static_assert(sizeof(exfs::tuple<Empty>) == 1u);
+
+static_assert(std::is_trivially_copyable_v<exfs::tuple<int, float, Empty>>);
+static_assert(std::is_trivially_copyable_v<exfs::packed_tuple<char, double>>);
+static_assert(not std::is_trivially_copyable_v<exfs::tuple<int, std::string>>);
+
+constexpr int constexpr_sum () {
+    exfs::tuple<int, char, long> t{1, 'a', 3l};
+    get<1>(t) = 'b';
+    auto const [a, b, c] = t;
+    return a + (b - 'a') + static_cast<int>(c);
+}
+static_assert(constexpr_sum() == 5);
+}  // namespace
+
+TEMPLATE_TEST_CASE (
+    "exfs::tuple - element access matches std::tuple",
+    "[unit][std-parity][tuple]",
+    (std::tuple<int, std::string, double>),
+    (exfs::tuple<int, std::string, double>),
+    (exfs::packed_tuple<int, std::string, double>)
+) {
+    using namespace std::literals::string_literals;
+    using std::get;
+
+    GIVEN ("a tuple constructed from values") {
+        TestType t{7, "seven"s, 7.5};
+
+        THEN ("each element is accessed by index") {
+            CHECK(get<0>(t) == 7);
+            CHECK(get<1>(t) == "seven");
+            CHECK(get<2>(t) == 7.5);
+            CHECK(std::tuple_size_v<TestType> == 3u);
+            CHECK(std::is_same_v<
+                std::tuple_element_t<1, TestType>,
+                std::string
+            >);
+        }
+
+        THEN ("the value categories of get match std::get") {
+            CHECK(std::is_same_v<decltype(get<1>(t)), std::string&>);
+            CHECK(std::is_same_v<
+                decltype(get<1>(std::as_const(t))),
+                std::string const&
+            >);
+            CHECK(std::is_same_v<
+                decltype(get<1>(std::move(t))),
+                std::string&&
+            >);
+        }
+
+        WHEN ("it is decomposed with a structured binding") {
+            auto& [number, name, value] = t;
+            name += "!";
+
+            THEN ("the bindings refer to the elements") {
+                CHECK(number == 7);
+                CHECK(get<1>(t) == "seven!");
+                CHECK(value == 7.5);
+            }
+        }
+
+        WHEN ("it is copied and compared") {
+            TestType copy = t;
+
+            THEN ("the copy is equal until modified") {
+                CHECK(copy == t);
+                get<0>(copy) = 8;
+                CHECK(not (copy == t));
+            }
+        }
+
+        WHEN ("an element is moved out") {
+            std::string moved = get<1>(std::move(t));
+
+            THEN ("the value is transferred") {
+                CHECK(moved == "seven");
+            }
+        }
+    }
+
+    GIVEN ("a default constructed tuple") {
+        TestType t{};
+
+        THEN ("the elements are value-initialized") {
+            CHECK(get<0>(t) == 0);
+            CHECK(get<1>(t).empty());
+            CHECK(get<2>(t) == 0.0);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::tuple - layout",
+    "[unit][tuple]"
+) {
+    GIVEN ("a packed tuple whose elements are reordered in memory") {
+        exfs::packed_tuple<char, double, short> t{'x', 2.5, short{3}};
+
+        THEN ("the elements keep their indices") {
+            CHECK(get<0>(t) == 'x');
+            CHECK(get<1>(t) == 2.5);
+            CHECK(get<2>(t) == 3);
+        }
+
+        THEN ("the most aligned element is first in memory") {
+            auto const* base = reinterpret_cast<char const*>(&t);
+            CHECK(reinterpret_cast<char const*>(&get<1>(t)) == base);
+            CHECK(sizeof(t) == 16u);
+        }
+    }
+
+    GIVEN ("a tuple holding a stateless comparator") {
+        exfs::tuple<exfs::less, int> t{exfs::less{}, 4};
+
+        THEN ("the comparator is usable and takes no space") {
+            CHECK(get<0>(t)(1, get<1>(t)));
+            CHECK(sizeof(t) == sizeof(int));
+        }
+    }
+
+    GIVEN ("tuples created with deduction") {
+        auto const made = exfs::make_tuple(1, 'c');
+        exfs::tuple deduced{2u, 1.5f};
+
+        THEN ("the element types are deduced") {
+            CHECK(std::is_same_v<decltype(made), exfs::tuple<int, char> const>);
+            CHECK(std::is_same_v<
+                decltype(deduced),
+                exfs::tuple<unsigned, float>
+            >);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::tuple - conversions",
+    "[unit][tuple]"
+) {
+    GIVEN ("a tuple of values") {
+        int i = 3;
+        std::string s = "three";
+        exfs::tuple<int, std::string> values{i, s};
+
+        WHEN ("a tuple of references is converted from it") {
+            exfs::tuple<int&, std::string&> refs{values};
+
+            THEN ("the references refer to its elements") {
+                get<0>(refs) = 4;
+                CHECK(get<0>(values) == 4);
+                CHECK(&get<1>(refs) == &get<1>(values));
+            }
+        }
+
+        WHEN ("a tuple of wider types is converted from it") {
+            exfs::tuple<long, std::string> const wide{
+                static_cast<exfs::tuple<int, std::string> const&>(values)
+            };
+
+            THEN ("the elements are converted") {
+                CHECK(get<0>(wide) == 3l);
+                CHECK(get<1>(wide) == "three");
+            }
+        }
+
+        WHEN ("a tuple of values is converted from a tuple of references") {
+            exfs::tuple<int&, std::string&> refs{i, s};
+            exfs::tuple<int, std::string> copy{refs};
+            get<0>(copy) = 5;
+
+            THEN ("the elements are copied") {
+                CHECK(i == 3);
+                CHECK(get<1>(copy) == "three");
+            }
+        }
+
+        WHEN ("a tuple is converted from an rvalue tuple") {
+            exfs::tuple<long, std::string> moved{exfs::move(values)};
+
+            THEN ("the elements are moved") {
+                CHECK(get<1>(moved) == "three");
+            }
+        }
+    }
+
+    THEN ("tuples of references and values have a common reference") {
+        CHECK(std::is_same_v<
+            std::common_reference_t<
+                exfs::tuple<int&, char&>,
+                exfs::tuple<int, char>&
+            >,
+            exfs::tuple<int&, char&>
+        >);
+        CHECK(std::is_same_v<
+            std::common_reference_t<
+                exfs::tuple<int&&>,
+                exfs::tuple<int> const&
+            >,
+            exfs::tuple<int const&>
+        >);
+    }
+}
@@ -0,0 +1,110 @@
+#include "exfs/variant.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <variant>
+
+#include <benchmark/benchmark.h>
+
+#include "exfs/optional.hpp"
+
+namespace {
+constexpr std::size_t element_count = 1024u;
+
+struct Sum {
+    std::int64_t operator () (std::int8_t value) const { return value; }
+    std::int64_t operator () (std::int16_t value) const { return value * 2; }
+    std::int64_t operator () (std::int32_t value) const { return value * 3; }
+    std::int64_t operator () (float value) const {
+        return static_cast<std::int64_t>(value);
+    }
+};
+
+// Alternatives are chosen pseudo-randomly so that the branch predictor cannot
+// learn the dispatch pattern.
+template <typename Variant>
+void fill (Variant (&elements)[element_count]) {
+    std::uint32_t seed = 12345u;
+    for (auto& element : elements) {
+        seed = seed * 1664525u + 1013904223u;
+        switch ((seed >> 16u) % 4u) {
+        case 0u: element = static_cast<std::int8_t>(seed); break;
+        case 1u: element = static_cast<std::int16_t>(seed); break;
+        case 2u: element = static_cast<std::int32_t>(seed); break;
+        default: element = static_cast<float>(seed & 0xffu); break;
+        }
+    }
+}
+
+template <typename Variant, typename Visit>
+void visit_all (benchmark::State& state, Visit visit) {
+    static Variant elements[element_count];
+    fill(elements);
+
+    for (auto _ : state) {
+        std::int64_t total = 0;
+        for (auto const& element : elements) {
+            total += visit(Sum{}, element);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * element_count);
+    state.SetBytesProcessed(state.iterations() * sizeof(elements));
+    state.counters["sizeof"] = sizeof(Variant);
+}
+
+void visit_std_variant (benchmark::State& state) {
+    using Variant = std::variant<std::int8_t, std::int16_t, std::int32_t, float>;
+    visit_all<Variant>(state, [] (auto&& vis, auto const& var) {
+        return std::visit(vis, var);
+    });
+}
+BENCHMARK(visit_std_variant);
+
+void visit_exfs_variant (benchmark::State& state) {
+    using Variant =
+        exfs::variant<std::int8_t, std::int16_t, std::int32_t, float>;
+    visit_all<Variant>(state, [] (auto&& vis, auto const& var) {
+        return exfs::visit(vis, var);
+    });
+}
+BENCHMARK(visit_exfs_variant);
+
+enum class Pin_Id : std::uint8_t { pa0, pa1, pa2, pa3, none = 0xffu };
+}  // namespace
+
+template <>
+struct exfs::niche<Pin_Id> : exfs::sentinel_niche<Pin_Id, Pin_Id::none> {};
+
+namespace {
+// An optional with a niche needs no engaged flag, so scanning a large array of
+// them touches half as much memory.
+constexpr std::size_t optional_count = 1u << 22u;
+
+template <typename Optional>
+void count_engaged (benchmark::State& state) {
+    static Optional elements[optional_count];
+    std::uint32_t seed = 12345u;
+    for (auto& element : elements) {
+        seed = seed * 1664525u + 1013904223u;
+        if ((seed >> 16u) % 3u != 0u) {
+            element = static_cast<Pin_Id>((seed >> 20u) % 4u);
+        }
+    }
+
+    for (auto _ : state) {
+        std::size_t engaged = 0u;
+        for (auto const& element : elements) {
+            engaged += element.has_value();
+        }
+        benchmark::DoNotOptimize(engaged);
+    }
+
+    state.SetItemsProcessed(state.iterations() * optional_count);
+    state.counters["sizeof"] = sizeof(Optional);
+}
+BENCHMARK(count_engaged<std::optional<Pin_Id>>);
+BENCHMARK(count_engaged<exfs::optional<Pin_Id>>);
+}  // namespace
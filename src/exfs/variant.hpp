@@ -0,0 +1,741 @@
+#ifndef EXFS_VARIANT_HPP_
+#define EXFS_VARIANT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <concepts>
+#include <type_traits>
+
+#include "exfs/memory/storage.hpp"
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/in_place.hpp"
+#include "exfs/utility/integer_sequence.hpp"
+
+namespace exfs {
+template <typename... Ts>
+class variant;
+
+/**
+ * Index of the alternative of a @c variant which is valueless by exception.
+ */
+inline constexpr std::size_t variant_npos = static_cast<std::size_t>(-1);
+
+/**
+ * @name variant_size
+ * @{
+ */
+
+/**
+ * Provides access to the number of alternatives in a possibly cv-qualified
+ * variant as a compile-time constant expression.
+ */
+template <typename Variant>
+struct variant_size;
+
+template <typename... Ts>
+struct variant_size<variant<Ts...>>
+      : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <typename Variant>
+struct variant_size<Variant const> : variant_size<Variant> {};
+
+template <typename Variant>
+inline constexpr std::size_t variant_size_v = variant_size<Variant>::value;
+
+/**
+ * @}
+ */
+
+/**
+ * @name variant_alternative
+ * @{
+ */
+
+/**
+ * Provides compile-time indexed access to the types of the alternatives of the
+ * possibly cv-qualified variant.
+ */
+template <std::size_t I, typename Variant>
+struct variant_alternative;
+
+template <std::size_t I, typename T, typename... Ts>
+struct variant_alternative<I, variant<T, Ts...>>
+      : variant_alternative<I - 1u, variant<Ts...>> {};
+
+template <typename T, typename... Ts>
+struct variant_alternative<0u, variant<T, Ts...>> {
+    using type = T;
+};
+
+template <std::size_t I, typename Variant>
+struct variant_alternative<I, Variant const> {
+    using type = typename variant_alternative<I, Variant>::type const;
+};
+
+template <std::size_t I, typename Variant>
+using variant_alternative_t = typename variant_alternative<I, Variant>::type;
+
+/**
+ * @}
+ */
+
+namespace __detail {
+/**
+ * The smallest unsigned type able to represent every alternative index as
+ * well as @c variant_npos.
+ */
+template <std::size_t count>
+using __variant_index_t = std::conditional_t<
+    (count < 0xffu),
+    std::uint8_t,
+    std::conditional_t<(count < 0xffffu), std::uint16_t, std::uint32_t>
+>;
+
+template <typename T, typename... Ts>
+inline constexpr std::size_t __count_of = (0u + ... + std::same_as<T, Ts>);
+
+template <typename T, typename... Ts>
+constexpr std::size_t __index_of () {
+    constexpr bool matches[] = {std::same_as<T, Ts>..., false};
+    std::size_t idx = 0u;
+    while (idx < sizeof...(Ts) and not matches[idx]) {
+        ++idx;
+    }
+    return idx;
+}
+
+template <typename... Ts>
+concept __all_copy_constructible = (... and std::copy_constructible<Ts>);
+
+template <typename... Ts>
+concept __all_copyable = (... and std::copyable<Ts>);
+
+template <typename... Ts>
+concept __all_move_constructible = (... and std::move_constructible<Ts>);
+
+template <typename... Ts>
+concept __all_movable = (... and std::movable<Ts>);
+
+template <typename... Ts>
+concept __all_trivially_copyable = (... and std::is_trivially_copyable_v<Ts>);
+
+template <typename... Ts>
+concept __all_trivially_move_constructible =
+    (... and std::is_trivially_move_constructible_v<Ts>);
+
+template <typename... Ts>
+concept __all_trivially_destructible =
+    (... and std::is_trivially_destructible_v<Ts>);
+
+template <std::size_t... sizes>
+inline constexpr std::size_t __max_of = [] {
+    std::size_t result = 0u;
+    ((result = sizes > result ? sizes : result), ...);
+    return result;
+}();
+
+/**
+ * Grants the free accessor functions access to the storage of a variant.
+ */
+struct __variant_access {
+    template <std::size_t I, typename Variant>
+    static constexpr auto& get (Variant& v) noexcept {
+        return v.template get_<I>();
+    }
+};
+
+template <std::size_t I, typename T>
+struct __alt_selector {
+    // Mirrors the imaginary function FUN(T_i) of [variant.ctor], including
+    // the rejection of narrowing conversions.
+    template <typename U>
+    requires requires (U&& u) { {T{exfs::forward<U>(u)}}; }
+    static std::integral_constant<std::size_t, I> select (T, U&&);
+};
+
+template <typename Sequence, typename... Ts>
+struct __alt_overloads;
+
+template <std::size_t... Is, typename... Ts>
+struct __alt_overloads<index_sequence<Is...>, Ts...>
+      : __alt_selector<Is, Ts>... {
+    using __alt_selector<Is, Ts>::select...;
+};
+
+template <typename U, typename... Ts>
+using __selected_alt = decltype(
+    __alt_overloads<index_sequence_for<Ts...>, Ts...>::select(
+        exfs::declval<U>(),
+        exfs::declval<U>()
+    )
+);
+}  // namespace __detail
+
+/**
+ * The class template @c variant represents a type-safe union. At any given
+ * time it holds a value of one of its alternative types, or in the case of an
+ * exception during construction, no value.
+ *
+ * The alternatives share a single buffer of @c exfs::memory::storage-style
+ * uninitialized memory. The active alternative is tracked with the smallest
+ * unsigned integer type that can represent all alternative indices, so a
+ * variant of up to 254 alternatives only adds a single byte (plus alignment
+ * padding) to the size of its largest alternative.
+ *
+ * The interface follows @c std::variant except that the accessors which would
+ * throw @c std::bad_variant_access have unchecked preconditions instead. Use
+ * @c get_if for checked access.
+ *
+ * @tparam Ts... The types that may be stored in this variant.
+ */
+template <typename... Ts>
+class variant {
+    static_assert(sizeof...(Ts) > 0u);
+    static_assert((... and (std::is_object_v<Ts> and not std::is_array_v<Ts>)));
+
+    using index_type_ = __detail::__variant_index_t<sizeof...(Ts)>;
+    static constexpr index_type_ npos_ = static_cast<index_type_>(-1);
+
+    template <std::size_t I>
+    using alt_ = variant_alternative_t<I, variant>;
+
+  public:
+    /**
+     * @name Constructors
+     * @{
+     */
+
+    /**
+     * Default constructor. Value-initializes the first alternative.
+     */
+    constexpr variant ()
+    noexcept(std::is_nothrow_default_constructible_v<alt_<0u>>)
+    requires (std::is_default_constructible_v<alt_<0u>>) {
+        construct_<0u>();
+    }
+
+    /**
+     * Copy constructor. Trivial if every alternative is trivially copyable.
+     */
+    constexpr variant (variant const&)
+    requires (
+        __detail::__all_copy_constructible<Ts...> and
+        __detail::__all_trivially_copyable<Ts...>
+    ) = default;
+
+    constexpr variant (variant const& other)
+    noexcept((... and std::is_nothrow_copy_constructible_v<Ts>))
+    requires (__detail::__all_copy_constructible<Ts...>) {
+        if (not other.valueless_by_exception()) {
+            dispatch_(other.index_, [&] <std::size_t I> () {
+                construct_<I>(other.template get_<I>());
+            });
+        }
+    }
+
+    /**
+     * Move constructor. Trivial if every alternative is trivially move
+     * constructible. The alternatives do not need to be move assignable.
+     */
+    constexpr variant (variant&&)
+    requires (
+        __detail::__all_move_constructible<Ts...> and
+        __detail::__all_trivially_move_constructible<Ts...>
+    ) = default;
+
+    constexpr variant (variant&& other)
+    noexcept((... and std::is_nothrow_move_constructible_v<Ts>))
+    requires (__detail::__all_move_constructible<Ts...>) {
+        if (not other.valueless_by_exception()) {
+            dispatch_(other.index_, [&] <std::size_t I> () {
+                construct_<I>(exfs::move(other.template get_<I>()));
+            });
+        }
+    }
+
+    /**
+     * Converting constructor. Constructs the alternative which would be
+     * selected by overload resolution for `F(exfs::forward<U>(value))` if there
+     * was an overload of imaginary function `F(T_i)` for every alternative,
+     * excluding narrowing conversions.
+     */
+    template <
+        typename U,
+        std::size_t I = __detail::__selected_alt<U, Ts...>::value
+    >
+    requires (
+        not std::same_as<std::remove_cvref_t<U>, variant> and
+        std::is_constructible_v<alt_<I>, U>
+    )
+    constexpr variant (U&& value)
+    noexcept(std::is_nothrow_constructible_v<alt_<I>, U>) {
+        construct_<I>(exfs::forward<U>(value));
+    }
+
+    /**
+     * Constructs the alternative of type @p T from @p args....
+     */
+    template <typename T, typename... Args>
+    requires (
+        __detail::__count_of<T, Ts...> == 1u and
+        std::is_constructible_v<T, Args...>
+    )
+    constexpr explicit variant (in_place_type_t<T>, Args&&... args) {
+        construct_<__detail::__index_of<T, Ts...>()>(
+            exfs::forward<Args>(args)...
+        );
+    }
+
+    /**
+     * Constructs the alternative with index @p I from @p args....
+     */
+    template <std::size_t I, typename... Args>
+    requires (
+        I < sizeof...(Ts) and
+        std::is_constructible_v<alt_<I>, Args...>
+    )
+    constexpr explicit variant (in_place_index_t<I>, Args&&... args) {
+        construct_<I>(exfs::forward<Args>(args)...);
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Destroys the contained value. Trivial if every alternative is trivially
+     * destructible.
+     */
+    constexpr ~variant ()
+    requires (__detail::__all_trivially_destructible<Ts...>) = default;
+
+    constexpr ~variant () {
+        reset_();
+    }
+
+    /**
+     * @name Assignment
+     * @{
+     */
+
+    /**
+     * Copy assignment. If both variants hold the same alternative, it is
+     * copy assigned. Otherwise the current alternative is destroyed and the
+     * new one is copy constructed.
+     */
+    constexpr variant& operator = (variant const&)
+    requires (
+        __detail::__all_copyable<Ts...> and
+        __detail::__all_trivially_copyable<Ts...>
+    ) = default;
+
+    constexpr variant& operator = (variant const& other)
+    requires (__detail::__all_copyable<Ts...>) {
+        if (other.valueless_by_exception()) {
+            reset_();
+        } else if (index_ == other.index_) {
+            dispatch_(index_, [&] <std::size_t I> () {
+                get_<I>() = other.template get_<I>();
+            });
+        } else {
+            dispatch_(other.index_, [&] <std::size_t I> () {
+                reset_();
+                construct_<I>(other.template get_<I>());
+            });
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment. If both variants hold the same alternative, it is
+     * move assigned. Otherwise the current alternative is destroyed and the
+     * new one is move constructed.
+     */
+    constexpr variant& operator = (variant&&)
+    requires (
+        __detail::__all_movable<Ts...> and
+        __detail::__all_trivially_copyable<Ts...>
+    ) = default;
+
+    constexpr variant& operator = (variant&& other)
+    noexcept(
+        (... and std::is_nothrow_move_constructible_v<Ts>) and
+        (... and std::is_nothrow_move_assignable_v<Ts>)
+    )
+    requires (__detail::__all_movable<Ts...>) {
+        if (other.valueless_by_exception()) {
+            reset_();
+        } else if (index_ == other.index_) {
+            dispatch_(index_, [&] <std::size_t I> () {
+                get_<I>() = exfs::move(other.template get_<I>());
+            });
+        } else {
+            dispatch_(other.index_, [&] <std::size_t I> () {
+                reset_();
+                construct_<I>(exfs::move(other.template get_<I>()));
+            });
+        }
+        return *this;
+    }
+
+    /**
+     * Converting assignment. Selects the alternative in the same way as the
+     * converting constructor. If it is already held, it is assigned,
+     * otherwise it is constructed in place of the current alternative.
+     */
+    template <
+        typename U,
+        std::size_t I = __detail::__selected_alt<U, Ts...>::value
+    >
+    requires (
+        not std::same_as<std::remove_cvref_t<U>, variant> and
+        std::is_constructible_v<alt_<I>, U> and
+        std::is_assignable_v<alt_<I>&, U>
+    )
+    constexpr variant& operator = (U&& value) {
+        if (index_ == I) {
+            get_<I>() = exfs::forward<U>(value);
+        } else {
+            emplace<I>(exfs::forward<U>(value));
+        }
+        return *this;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Observers
+     * @{
+     */
+
+    /**
+     * Returns the zero-based index of the alternative held by the variant, or
+     * @c variant_npos if the variant is valueless.
+     */
+    constexpr std::size_t index () const noexcept {
+        return index_ == npos_ ? variant_npos : index_;
+    }
+
+    /**
+     * Checks if the variant holds no value. This only happens if an exception
+     * is thrown while constructing a new alternative.
+     */
+    constexpr bool valueless_by_exception () const noexcept {
+        return index_ == npos_;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @name Modifiers
+     * @{
+     */
+
+    /**
+     * Destroys the current alternative and constructs the alternative with
+     * index @p I from @p args....
+     *
+     * @return A reference to the new alternative.
+     */
+    template <std::size_t I, typename... Args>
+    requires (
+        I < sizeof...(Ts) and
+        std::is_constructible_v<alt_<I>, Args...>
+    )
+    constexpr alt_<I>& emplace (Args&&... args) {
+        reset_();
+        construct_<I>(exfs::forward<Args>(args)...);
+        return get_<I>();
+    }
+
+    /**
+     * Destroys the current alternative and constructs the alternative of type
+     * @p T from @p args....
+     *
+     * @return A reference to the new alternative.
+     */
+    template <typename T, typename... Args>
+    requires (
+        __detail::__count_of<T, Ts...> == 1u and
+        std::is_constructible_v<T, Args...>
+    )
+    constexpr T& emplace (Args&&... args) {
+        return emplace<__detail::__index_of<T, Ts...>()>(
+            exfs::forward<Args>(args)...
+        );
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * Two variants are equal if they hold the same alternative and those
+     * alternatives compare equal, or if both are valueless.
+     */
+    friend constexpr bool operator == (variant const& lhs, variant const& rhs)
+    requires (... and std::equality_comparable<Ts>) {
+        if (lhs.index_ != rhs.index_) {
+            return false;
+        }
+        if (lhs.valueless_by_exception()) {
+            return true;
+        }
+
+        bool result = false;
+        dispatch_(lhs.index_, [&] <std::size_t I> () {
+            result = static_cast<bool>(
+                lhs.template get_<I>() == rhs.template get_<I>()
+            );
+        });
+        return result;
+    }
+
+  private:
+    friend struct __detail::__variant_access;
+
+    template <std::size_t I>
+    constexpr alt_<I>& get_ () noexcept {
+        return reinterpret_cast<memory::storage<alt_<I>>*>(data_)->object();
+    }
+
+    template <std::size_t I>
+    constexpr alt_<I> const& get_ () const noexcept {
+        return reinterpret_cast<memory::storage<alt_<I>> const*>(data_)
+            ->object();
+    }
+
+    template <std::size_t I, typename... Args>
+    constexpr void construct_ (Args&&... args) {
+        index_ = npos_;
+        reinterpret_cast<memory::storage<alt_<I>>*>(data_)->construct(
+            exfs::forward<Args>(args)...
+        );
+        index_ = static_cast<index_type_>(I);
+    }
+
+    constexpr void reset_ () noexcept {
+        if constexpr (not __detail::__all_trivially_destructible<Ts...>) {
+            if (not valueless_by_exception()) {
+                dispatch_(index_, [&] <std::size_t I> () {
+                    reinterpret_cast<memory::storage<alt_<I>>*>(data_)
+                        ->destroy();
+                });
+            }
+        }
+        index_ = npos_;
+    }
+
+    // Calls `fn.template operator()<index>()` through a jump table.
+    template <typename Fn>
+    static constexpr void dispatch_ (std::size_t index, Fn&& fn) {
+        [&] <std::size_t... Is> (index_sequence<Is...>) {
+            using thunk = void (*)(Fn&);
+            constexpr thunk table[] = {
+                [] (Fn& f) { f.template operator()<Is>(); }...
+            };
+            table[index](fn);
+        }(index_sequence_for<Ts...>{});
+    }
+
+    alignas(Ts...) std::byte data_[__detail::__max_of<sizeof(Ts)...>];
+    index_type_ index_ = npos_;
+};
+
+/**
+ * @name Access
+ * @{
+ */
+
+/**
+ * Checks if the variant @p v holds the alternative @p T. The call is
+ * ill-formed if @p T does not appear exactly once in @p Ts....
+ */
+template <typename T, typename... Ts>
+requires (__detail::__count_of<T, Ts...> == 1u)
+constexpr bool holds_alternative (variant<Ts...> const& v) noexcept {
+    return v.index() == __detail::__index_of<T, Ts...>();
+}
+
+/**
+ * Returns a reference to the alternative with index @p I.
+ * @warning The behavior is undefined if `v.index() != I`.
+ */
+template <std::size_t I, typename... Ts>
+constexpr variant_alternative_t<I, variant<Ts...>>&
+get (variant<Ts...>& v) noexcept {
+    return __detail::__variant_access::get<I>(v);
+}
+
+template <std::size_t I, typename... Ts>
+constexpr variant_alternative_t<I, variant<Ts...>> const&
+get (variant<Ts...> const& v) noexcept {
+    return __detail::__variant_access::get<I>(v);
+}
+
+template <std::size_t I, typename... Ts>
+constexpr variant_alternative_t<I, variant<Ts...>>&&
+get (variant<Ts...>&& v) noexcept {
+    return exfs::move(__detail::__variant_access::get<I>(v));
+}
+
+/**
+ * Returns a reference to the alternative of type @p T.
+ * @warning The behavior is undefined if @p v does not hold a @p T.
+ */
+template <typename T, typename... Ts>
+requires (__detail::__count_of<T, Ts...> == 1u)
+constexpr T& get (variant<Ts...>& v) noexcept {
+    return get<__detail::__index_of<T, Ts...>()>(v);
+}
+
+template <typename T, typename... Ts>
+requires (__detail::__count_of<T, Ts...> == 1u)
+constexpr T const& get (variant<Ts...> const& v) noexcept {
+    return get<__detail::__index_of<T, Ts...>()>(v);
+}
+
+template <typename T, typename... Ts>
+requires (__detail::__count_of<T, Ts...> == 1u)
+constexpr T&& get (variant<Ts...>&& v) noexcept {
+    return get<__detail::__index_of<T, Ts...>()>(exfs::move(v));
+}
+
+/**
+ * Returns a pointer to the alternative with index @p I if @p v holds it, or @c
+ * nullptr otherwise.
+ */
+template <std::size_t I, typename... Ts>
+constexpr std::add_pointer_t<variant_alternative_t<I, variant<Ts...>>>
+get_if (variant<Ts...>* v) noexcept {
+    return v != nullptr and v->index() == I
+        ? &__detail::__variant_access::get<I>(*v)
+        : nullptr;
+}
+
+template <std::size_t I, typename... Ts>
+constexpr std::add_pointer_t<variant_alternative_t<I, variant<Ts...>> const>
+get_if (variant<Ts...> const* v) noexcept {
+    return v != nullptr and v->index() == I
+        ? &__detail::__variant_access::get<I>(*v)
+        : nullptr;
+}
+
+/**
+ * Returns a pointer to the alternative of type @p T if @p v holds it, or @c
+ * nullptr otherwise.
+ */
+template <typename T, typename... Ts>
+requires (__detail::__count_of<T, Ts...> == 1u)
+constexpr T* get_if (variant<Ts...>* v) noexcept {
+    return get_if<__detail::__index_of<T, Ts...>()>(v);
+}
+
+template <typename T, typename... Ts>
+requires (__detail::__count_of<T, Ts...> == 1u)
+constexpr T const* get_if (variant<Ts...> const* v) noexcept {
+    return get_if<__detail::__index_of<T, Ts...>()>(v);
+}
+
+/**
+ * @}
+ */
+
+namespace __detail {
+/**
+ * Variants with at most this many alternatives are visited with an inlinable
+ * chain of comparisons, which the compiler lowers to a switch. Larger
+ * variants use a table of function pointers.
+ */
+inline constexpr std::size_t __visit_inline_limit = 16u;
+
+template <typename R, std::size_t I, std::size_t N, typename Visitor,
+          typename Variant>
+[[gnu::always_inline]] constexpr R
+__visit_chain (std::size_t index, Visitor&& visitor, Variant&& v) {
+    if constexpr (I + 1u == N) {
+        return exfs::forward<Visitor>(visitor)(
+            get<I>(exfs::forward<Variant>(v))
+        );
+    } else {
+        if (index == I) {
+            return exfs::forward<Visitor>(visitor)(
+                get<I>(exfs::forward<Variant>(v))
+            );
+        }
+        return __visit_chain<R, I + 1u, N>(
+            index,
+            exfs::forward<Visitor>(visitor),
+            exfs::forward<Variant>(v)
+        );
+    }
+}
+}  // namespace __detail
+
+/**
+ * Applies the @p visitor to the alternative held by @p v.
+ *
+ * Small variants are dispatched with a chain of comparisons which is fully
+ * inlined, so the compiler can lower it to a switch and inline the visitor.
+ * Larger variants dispatch with a single indirect call through a table of
+ * function pointers generated at compile time, one per alternative. Every
+ * invocation of @p visitor must have the same return type.
+ *
+ * Unlike @c std::visit, only a single variant may be visited at a time.
+ *
+ * @warning The behavior is undefined if @p v is valueless by exception.
+ *
+ * @param[in] visitor The callable to invoke with the held alternative.
+ * @param[in] v The variant to visit.
+ *
+ * @return The value returned by @p visitor.
+ */
+template <typename Visitor, typename Variant>
+requires requires { variant_size<std::remove_cvref_t<Variant>>::value; }
+constexpr decltype(auto) visit (Visitor&& visitor, Variant&& v) {
+    constexpr std::size_t count = variant_size_v<std::remove_cvref_t<Variant>>;
+    using result_type = decltype(exfs::forward<Visitor>(visitor)(
+        get<0u>(exfs::forward<Variant>(v))
+    ));
+
+    return [&] <std::size_t... Is> (index_sequence<Is...>) -> result_type {
+        static_assert(
+            (... and std::same_as<result_type, decltype(
+                exfs::forward<Visitor>(visitor)(
+                    get<Is>(exfs::forward<Variant>(v))
+                )
+            )>),
+            "The visitor must return the same type for every alternative."
+        );
+
+        if constexpr (count <= __detail::__visit_inline_limit) {
+            return __detail::__visit_chain<result_type, 0u, count>(
+                v.index(),
+                exfs::forward<Visitor>(visitor),
+                exfs::forward<Variant>(v)
+            );
+        } else {
+            using thunk = result_type (*)(Visitor&&, Variant&&);
+            constexpr thunk table[] = {
+                [] (Visitor&& vis, Variant&& var) -> result_type {
+                    return exfs::forward<Visitor>(vis)(
+                        get<Is>(exfs::forward<Variant>(var))
+                    );
+                }...
+            };
+            return table[v.index()](
+                exfs::forward<Visitor>(visitor),
+                exfs::forward<Variant>(v)
+            );
+        }
+    }(make_index_sequence<count>{});
+}
+
+}  // namespace exfs
+
+#endif  // EXFS_VARIANT_HPP_
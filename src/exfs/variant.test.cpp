@@ -0,0 +1,309 @@
+#include "exfs/variant.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include <catch2/catch.hpp>
+
+#include "exfs/utility/functions.hpp"
+#include "exfs/utility/in_place.hpp"
+#include "exfs/utility/integer_sequence.hpp"
+
+namespace {
+template <std::size_t I>
+struct Tag {
+    static constexpr std::size_t value = I;
+};
+
+// Alternatives which can be move constructed but not assigned.
+struct Move_Only_Unassignable {
+    Move_Only_Unassignable () = default;
+    Move_Only_Unassignable (Move_Only_Unassignable&&) = default;
+    Move_Only_Unassignable& operator = (Move_Only_Unassignable&&) = delete;
+};
+
+struct Const_Member {
+    int const value;
+    std::string* log;
+
+    Const_Member (int v, std::string* l) : value{v}, log{l} {}
+    Const_Member (Const_Member const& other)
+        : value{other.value}, log{other.log} {
+        *log += "copy ";
+    }
+    Const_Member (Const_Member&& other) noexcept
+        : value{other.value}, log{other.log} {
+        *log += "move ";
+    }
+};
+
+struct Length {
+    template <typename T>
+    std::size_t operator () (T const& value) const {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return value.size();
+        } else {
+            return sizeof(T);
+        }
+    }
+};
+}  // namespace
+
+TEST_CASE (
+    "exfs::variant - size and triviality",
+    "[unit][variant]"
+) {
+    // The index is stored in the smallest type which fits, so small variants
+    // are much smaller than their std counterparts.
+    CHECK(sizeof(exfs::variant<char, std::uint8_t>) == 2u);
+    CHECK(sizeof(exfs::variant<std::uint16_t, char>) == 4u);
+    CHECK(sizeof(exfs::variant<int, float>) == 8u);
+    CHECK(sizeof(exfs::variant<double, char>) == 16u);
+    CHECK(alignof(exfs::variant<double, char>) == alignof(double));
+
+    CHECK(std::is_trivially_copyable_v<exfs::variant<int, float>>);
+    CHECK(std::is_trivially_destructible_v<exfs::variant<int, float>>);
+    CHECK(not std::is_trivially_copyable_v<exfs::variant<int, std::string>>);
+    CHECK(not std::is_trivially_destructible_v<
+        exfs::variant<int, std::string>
+    >);
+
+    CHECK(not std::is_copy_constructible_v<
+        exfs::variant<int, std::unique_ptr<int>>
+    >);
+    CHECK(std::is_move_constructible_v<
+        exfs::variant<int, std::unique_ptr<int>>
+    >);
+
+    CHECK(std::is_move_constructible_v<
+        exfs::variant<int, Move_Only_Unassignable>
+    >);
+    CHECK(std::is_trivially_move_constructible_v<
+        exfs::variant<int, Move_Only_Unassignable>
+    >);
+    CHECK(not std::is_move_assignable_v<
+        exfs::variant<int, Move_Only_Unassignable>
+    >);
+    CHECK(std::is_nothrow_move_constructible_v<
+        exfs::variant<int, Const_Member>
+    >);
+    CHECK(not std::is_trivially_move_constructible_v<
+        exfs::variant<int, Const_Member>
+    >);
+
+    CHECK(exfs::variant_size_v<exfs::variant<int, float, char>> == 3u);
+    CHECK(exfs::variant_size_v<exfs::variant<int, float> const> == 2u);
+    CHECK(std::is_same_v<
+        exfs::variant_alternative_t<1u, exfs::variant<int, float, char>>,
+        float
+    >);
+}
+
+TEMPLATE_TEST_CASE (
+    "exfs::variant - basic usage",
+    "[unit][std-parity][variant]",
+    (std::variant<int, double, std::string>),
+    (exfs::variant<int, double, std::string>)
+) {
+    using namespace std::literals::string_literals;
+    using Variant = TestType;
+
+    WHEN ("default constructing a variant") {
+        Variant var{};
+
+        THEN ("it holds a value-initialized first alternative") {
+            CHECK(var.index() == 0u);
+            CHECK(get<int>(var) == 0);
+            CHECK(not var.valueless_by_exception());
+        }
+    }
+
+    WHEN ("constructing from a value") {
+        Variant var{"text"s};
+
+        THEN ("the matching alternative is held") {
+            CHECK(var.index() == 2u);
+            CHECK(holds_alternative<std::string>(var));
+            CHECK(get<2u>(var) == "text"s);
+            CHECK(get_if<std::string>(&var) != nullptr);
+            CHECK(get_if<int>(&var) == nullptr);
+        }
+
+        AND_WHEN ("it is copied") {
+            Variant copy{var};
+
+            THEN ("the copy holds an equal value") {
+                CHECK(copy.index() == 2u);
+                CHECK(get<std::string>(copy) == "text"s);
+                CHECK(copy == var);
+            }
+        }
+
+        AND_WHEN ("it is moved") {
+            Variant moved{exfs::move(var)};
+
+            THEN ("the value is moved") {
+                CHECK(get<std::string>(moved) == "text"s);
+            }
+        }
+
+        AND_WHEN ("a value of another alternative is assigned") {
+            var = 2.5;
+
+            THEN ("the held alternative changes") {
+                CHECK(var.index() == 1u);
+                CHECK(get<double>(var) == 2.5);
+            }
+        }
+
+        AND_WHEN ("another variant is copy assigned") {
+            Variant other{7};
+            var = other;
+
+            THEN ("the held alternative and value are copied") {
+                CHECK(var.index() == 0u);
+                CHECK(get<int>(var) == 7);
+                CHECK(var == other);
+            }
+        }
+
+        AND_WHEN ("an alternative is emplaced") {
+            auto& result = var.template emplace<int>(42);
+
+            THEN ("the new alternative is held") {
+                CHECK(var.index() == 0u);
+                CHECK(get<0u>(var) == 42);
+                CHECK(&result == get_if<0u>(&var));
+            }
+        }
+
+        THEN ("visiting calls the visitor with the held alternative") {
+            CHECK(visit(Length{}, var) == 4u);
+            var = 1;
+            CHECK(visit(Length{}, var) == sizeof(int));
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::variant - alternatives which cannot be assigned",
+    "[unit][variant]"
+) {
+    GIVEN ("a variant holding an alternative with a const member") {
+        std::string log;
+        exfs::variant<int, Const_Member> var{Const_Member{7, &log}};
+        log.clear();
+
+        WHEN ("the variant is move constructed") {
+            exfs::variant<int, Const_Member> moved{exfs::move(var)};
+
+            THEN ("the alternative is moved, not copied") {
+                CHECK(log == "move ");
+                CHECK(get<1u>(moved).value == 7);
+            }
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::variant - alternative selection",
+    "[unit][variant]"
+) {
+    GIVEN ("a variant of types with converting constructors") {
+        using Variant = exfs::variant<std::string, bool, long>;
+
+        THEN ("the best match without narrowing is selected") {
+            CHECK(Variant{"abc"}.index() == 0u);
+            CHECK(Variant{true}.index() == 1u);
+            CHECK(Variant{3}.index() == 2u);
+        }
+    }
+
+    GIVEN ("a variant constructed in place") {
+        exfs::variant<int, std::string> by_type{
+            exfs::in_place_type<std::string>,
+            "abcdef",
+            3u
+        };
+        exfs::variant<int, int> by_index{exfs::in_place_index<1u>, 9};
+
+        THEN ("the requested alternative is held") {
+            CHECK(get<std::string>(by_type) == "abc");
+            CHECK(by_index.index() == 1u);
+            CHECK(get<1u>(by_index) == 9);
+        }
+    }
+}
+
+SCENARIO (
+    "exfs::variant - visitation",
+    "[unit][variant]"
+) {
+    GIVEN ("a variant holding a value") {
+        exfs::variant<int, double> var{3};
+
+        WHEN ("visiting with a mutating visitor") {
+            exfs::visit([] (auto& value) { value *= 2; }, var);
+
+            THEN ("the held alternative is modified") {
+                CHECK(get<int>(var) == 6);
+            }
+        }
+
+        WHEN ("visiting with a visitor returning a value") {
+            auto result = exfs::visit(
+                [] (auto value) { return static_cast<long>(value) + 1; },
+                var
+            );
+
+            THEN ("the result of the visitor is returned") {
+                CHECK(result == 4L);
+            }
+        }
+    }
+
+    GIVEN ("a variant holding a move-only alternative") {
+        exfs::variant<int, std::unique_ptr<int>> var{
+            std::make_unique<int>(5)
+        };
+
+        WHEN ("visiting an rvalue") {
+            auto ptr = exfs::visit(
+                [] <typename T> (T&& value) -> std::unique_ptr<int> {
+                    if constexpr (std::is_same_v<T, int>) {
+                        return std::make_unique<int>(value);
+                    } else {
+                        return exfs::move(value);
+                    }
+                },
+                exfs::move(var)
+            );
+
+            THEN ("the alternative is moved out") {
+                REQUIRE(ptr != nullptr);
+                CHECK(*ptr == 5);
+                CHECK(get<1u>(var) == nullptr);
+            }
+        }
+    }
+
+    GIVEN ("a variant with too many alternatives to visit inline") {
+        using Variant = decltype([] <std::size_t... Is> (
+            exfs::index_sequence<Is...>
+        ) {
+            return exfs::variant<Tag<Is>...>{};
+        }(exfs::make_index_sequence<20u>{}));
+
+        Variant var{Tag<17u>{}};
+
+        THEN ("the visitor is dispatched through a table") {
+            CHECK(exfs::visit([] (auto tag) { return tag.value; }, var) == 17u);
+            var = Tag<3u>{};
+            CHECK(exfs::visit([] (auto tag) { return tag.value; }, var) == 3u);
+        }
+    }
+}
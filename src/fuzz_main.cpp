@@ -0,0 +1,129 @@
+// Standalone driver for the fuzz targets, used when they are not linked with
+// libFuzzer. It runs the target on each input file given on the command line,
+// then on randomly generated inputs, and takes the same flags as libFuzzer:
+//
+//   -runs=N     number of random inputs to run (default: 10000)
+//   -seed=N     seed of the random inputs (default: 1)
+//   -max_len=N  maximum length of a random input (default: 256)
+//
+// The random inputs depend only on the seed, so a run is reproducible
+// offline. A target reports a failure by aborting; the input it failed on is
+// then written to the file "crash-input" in the working directory, which can
+// be passed back to the driver to reproduce the failure.
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+extern "C" int LLVMFuzzerTestOneInput (
+    std::uint8_t const* data,
+    std::size_t size
+);
+
+namespace {
+// The input currently being run, which is written out if the target aborts.
+std::uint8_t const* current_data = nullptr;
+std::size_t current_size = 0u;
+
+extern "C" void write_crash_input (int signal) {
+    int const file = ::open("crash-input", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (file >= 0) {
+        auto const written = ::write(file, current_data, current_size);
+        static_cast<void>(written);
+        ::close(file);
+    }
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+void run (std::uint8_t const* data, std::size_t size) {
+    current_data = data;
+    current_size = size;
+    LLVMFuzzerTestOneInput(data, size);
+}
+
+// SplitMix64, which is small and has no bad seeds.
+class Random {
+  public:
+    explicit Random (std::uint64_t seed) : state_{seed} {}
+
+    std::uint64_t next () {
+        std::uint64_t z = (state_ += 0x9e37'79b9'7f4a'7c15u);
+        z = (z ^ (z >> 30u)) * 0xbf58'476d'1ce4'e5b9u;
+        z = (z ^ (z >> 27u)) * 0x94d0'49bb'1331'11ebu;
+        return z ^ (z >> 31u);
+    }
+
+  private:
+    std::uint64_t state_;
+};
+
+// Parses the value of the flag "-<name>=<value>" into @p value, if @p arg is
+// that flag.
+bool parse_flag (char const* arg, char const* name, unsigned long& value) {
+    auto const length = std::strlen(name);
+    if (arg[0] != '-' or std::strncmp(arg + 1, name, length) != 0 or
+        arg[length + 1] != '=') {
+        return false;
+    }
+    value = std::strtoul(arg + length + 2, nullptr, 10);
+    return true;
+}
+}  // namespace
+
+int main (int argc, char** argv) {
+    unsigned long runs = 10'000u;
+    unsigned long seed = 1u;
+    unsigned long max_len = 256u;
+    std::vector<char const*> files;
+
+    for (int idx = 1; idx < argc; ++idx) {
+        char const* const arg = argv[idx];
+        if (not parse_flag(arg, "runs", runs) and
+            not parse_flag(arg, "seed", seed) and
+            not parse_flag(arg, "max_len", max_len)) {
+            if (arg[0] == '-') {
+                std::fprintf(stderr, "unknown flag: %s\n", arg);
+                return 2;
+            }
+            files.push_back(arg);
+        }
+    }
+
+    std::signal(SIGABRT, write_crash_input);
+
+    for (char const* const path : files) {
+        std::ifstream file{path, std::ios::binary};
+        if (not file) {
+            std::fprintf(stderr, "cannot read %s\n", path);
+            return 2;
+        }
+        std::vector<std::uint8_t> const input{
+            std::istreambuf_iterator<char>{file},
+            std::istreambuf_iterator<char>{}
+        };
+        run(input.data(), input.size());
+        std::printf("ran %s (%zu bytes)\n", path, input.size());
+    }
+
+    Random random{seed};
+    std::vector<std::uint8_t> input;
+    for (unsigned long idx = 0u; idx < runs; ++idx) {
+        input.resize(random.next() % (max_len + 1u));
+        for (auto& byte : input) {
+            byte = static_cast<std::uint8_t>(random.next());
+        }
+        run(input.data(), input.size());
+    }
+    std::printf("ran %lu random inputs with seed %lu\n", runs, seed);
+
+    return 0;
+}
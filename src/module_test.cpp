@@ -0,0 +1,31 @@
+// Smoke test of the `arche` module, built when ARCHE_BUILD_MODULE is on. It
+// only checks that the module can be imported and that templates of both
+// libraries can be instantiated through it.
+#include <cstdint>
+#include <new>
+
+import arche;
+
+namespace {
+using Control_Register = arche::Register<
+    std::uintptr_t{0x4000'0000u},
+    std::uint32_t
+>;
+
+static_assert(arche::concepts::Register<Control_Register>);
+
+int sum_of_doubled_sorted () {
+    exfs::static_vector<int, 8u> values{3, 1, 2};
+    exfs::algorithm::sort(values.begin(), values.end());
+
+    int sum = 0;
+    for (int const value : values) {
+        sum += 2 * value;
+    }
+    return sum + values.front();
+}
+}  // namespace
+
+int main () {
+    return sum_of_doubled_sorted() == 13 ? 0 : 1;
+}
@@ -0,0 +1,240 @@
+#! /usr/bin/env python3
+
+"""
+Checks the x86-64 code generated for the probe functions of the *.asm.cpp
+files against the expectations written next to them.
+
+Each expectation is a comment above a probe function of the form
+
+    // ASSEMBLY <symbol>: <count>=<n> <count><=<n> ...
+
+where each count is one of "instructions" (excluding the final ret), "loads",
+"stores" and "calls", or an instruction mnemonic such as "or". Instructions
+which read and write memory, like "or DWORD PTR [rax], 8", count as both a
+load and a store; tail calls count as calls. The check fails if a count does
+not match, or if an expected symbol is not defined in the object file.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+_EXPECTATION = re.compile(r'//\s*ASSEMBLY\s+(\w+)\s*:(.*)$')
+_COUNT = re.compile(r'^([\w.]+)(=|<=)(\d+)$')
+_FUNCTION = re.compile(r'^[0-9a-f]+ <(.+)>:$')
+_INSTRUCTION = re.compile(r'^\s*[0-9a-f]+:\s+(.*)$')
+_RELOCATION = re.compile(r'^\s*[0-9a-f]+: R_')
+
+# Prefixes printed before the mnemonic of an instruction.
+_PREFIXES = {'bnd', 'cs', 'data16', 'lock', 'notrack', 'rep', 'repe', 'repz',
+    'repne', 'repnz'}
+
+# Instructions which only pad or mark the code, and do not count.
+_PADDING = {'nop', 'int3', 'endbr64', 'endbr32'}
+
+# Prefixes of the mnemonics of instructions whose first operand is only
+# written, so that it is not loaded even when it is in memory.
+_WRITE_ONLY = ('mov', 'vmov', 'set', 'stos')
+
+# Instructions which only read their operands, so that a memory operand is
+# never stored to.
+_READ_ONLY = {'cmp', 'test', 'bt', 'ucomiss', 'ucomisd', 'comiss', 'comisd',
+    'push', 'jmp', 'call'}
+
+
+def _source_path (path, source_dir):
+    """
+    Returns the path of the source file from which the object file at @p path
+    was compiled.
+    """
+    path = path.replace(os.sep, '/')
+    match = re.search(r'\.dir/(.*\.asm\.cpp)\.o(bj)?$', path)
+    if match is None:
+        return None
+    return os.path.join(source_dir, match.group(1))
+
+
+def _expectations (source):
+    """
+    Returns the expected counts of each probe function in the source file, as
+    a map from symbol to a list of (count, operator, value).
+    """
+    expectations = {}
+    with open(source, encoding = 'utf-8') as file:
+        for line in file:
+            match = _EXPECTATION.search(line)
+            if match is None:
+                continue
+            counts = []
+            for item in match.group(2).split():
+                count = _COUNT.match(item)
+                if count is None:
+                    raise ValueError(f'{source}: malformed count "{item}"')
+                counts.append(
+                    (count.group(1), count.group(2), int(count.group(3)))
+                )
+            expectations[match.group(1)] = counts
+    return expectations
+
+
+def _split_operands (operands):
+    """
+    Splits the operands of an instruction at the commas which are not inside
+    brackets.
+    """
+    result = []
+    depth = 0
+    current = ''
+    for char in operands:
+        if char == '[':
+            depth += 1
+        elif char == ']':
+            depth -= 1
+        if char == ',' and depth == 0:
+            result.append(current.strip())
+            current = ''
+        else:
+            current += char
+    if current.strip():
+        result.append(current.strip())
+    return result
+
+
+def _is_memory (operand):
+    return '[' in operand or 'PTR' in operand
+
+
+def _functions (objdump, path):
+    """
+    Returns the instructions of each function in the object file, as a map
+    from symbol to a list of (mnemonic, operands, relocated).
+    """
+    output = subprocess.run(
+        [objdump, '-dr', '--no-show-raw-insn', '-M', 'intel', path],
+        check = True,
+        capture_output = True,
+        text = True,
+    ).stdout
+
+    functions = {}
+    instructions = None
+    for line in output.splitlines():
+        function = _FUNCTION.match(line)
+        if function is not None:
+            instructions = functions.setdefault(function.group(1), [])
+            continue
+        if instructions is None:
+            continue
+        if _RELOCATION.match(line):
+            if instructions:
+                mnemonic, operands, _ = instructions[-1]
+                instructions[-1] = (mnemonic, operands, True)
+            continue
+        instruction = _INSTRUCTION.match(line)
+        if instruction is None:
+            continue
+        words = instruction.group(1).split(None, 1)
+        while words and words[0] in _PREFIXES:
+            words = words[1].split(None, 1) if len(words) > 1 else []
+        if not words:
+            continue
+        mnemonic = words[0]
+        operands = words[1].split('#')[0].strip() if len(words) > 1 else ''
+        if mnemonic in _PADDING or (
+            mnemonic == 'xchg' and operands == 'ax,ax'
+        ):
+            continue
+        instructions.append((mnemonic, operands, False))
+    return functions
+
+
+def _count (instructions):
+    """
+    Returns the counts of the instructions of a function.
+    """
+    counts = {'instructions': 0, 'loads': 0, 'stores': 0, 'calls': 0}
+    for index, (mnemonic, operands, relocated) in enumerate(instructions):
+        if mnemonic == 'ret' and index == len(instructions) - 1:
+            continue
+        counts['instructions'] += 1
+        counts[mnemonic] = counts.get(mnemonic, 0) + 1
+
+        if mnemonic == 'call' or (mnemonic == 'jmp' and relocated):
+            counts['calls'] += 1
+            continue
+
+        operands = _split_operands(operands)
+        if operands and _is_memory(operands[0]):
+            if mnemonic not in _READ_ONLY:
+                counts['stores'] += 1
+            if not mnemonic.startswith(_WRITE_ONLY):
+                counts['loads'] += 1
+        elif mnemonic != 'lea' and any(map(_is_memory, operands[1:])):
+            counts['loads'] += 1
+    return counts
+
+
+def _format (instructions):
+    return '\n'.join(
+        f'        {mnemonic} {operands}'.rstrip()
+        for mnemonic, operands, _ in instructions
+    )
+
+
+def main ():
+    parser = argparse.ArgumentParser(description = __doc__)
+    parser.add_argument(
+        'objects',
+        nargs = '+',
+        help = 'object files compiled from *.asm.cpp files',
+    )
+    parser.add_argument(
+        '--objdump',
+        default = 'objdump',
+        help = 'objdump executable',
+    )
+    parser.add_argument(
+        '--source-dir',
+        required = True,
+        help = 'directory the sources of the object files are relative to',
+    )
+    args = parser.parse_args()
+
+    failures = []
+    for path in sorted(args.objects):
+        source = _source_path(path, args.source_dir)
+        if source is None:
+            failures.append(f'{path}: not compiled from an *.asm.cpp file')
+            continue
+        expectations = _expectations(source)
+        functions = _functions(args.objdump, path)
+
+        for symbol, expected in expectations.items():
+            if symbol not in functions:
+                failures.append(f'{symbol}: not defined in {path}')
+                continue
+            counts = _count(functions[symbol])
+            mismatches = []
+            for name, operator, value in expected:
+                actual = counts.get(name, 0)
+                if operator == '=' and actual != value:
+                    mismatches.append(f'{name}={actual} (expected {value})')
+                elif operator == '<=' and actual > value:
+                    mismatches.append(
+                        f'{name}={actual} (expected at most {value})'
+                    )
+            status = 'FAILED' if mismatches else 'ok'
+            print(f'{symbol}: {status}')
+            if mismatches:
+                failures.append(f'{symbol}: {", ".join(mismatches)}')
+                print(_format(functions[symbol]))
+
+    for failure in failures:
+        print(f'error: {failure}')
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
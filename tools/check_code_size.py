@@ -0,0 +1,129 @@
+#! /usr/bin/env python3
+
+"""
+Reports the code size of the objects built by the code_size target and checks
+it against a budget.
+
+Each object file is one component: the instantiations in one *.size.cpp file.
+The size of a component is the total size of the functions defined in its
+object file, including the out-of-line template instantiations which the
+harness functions call. The check fails if any component is larger than its
+budget, or has no budget.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+# Symbol types of nm which denote code, either local or global.
+_CODE_SYMBOL_TYPES = set('TtWw')
+
+
+def _component_name (path):
+    """
+    Returns the name of the component built into the object file at @p path:
+    the path of its source file relative to src/, without extensions.
+    """
+    path = path.replace(os.sep, '/')
+    match = re.search(r'\.dir/(.*)\.size\.cpp\.o(bj)?$', path)
+    return match.group(1) if match else os.path.basename(path)
+
+
+def _code_symbols (nm, path):
+    """
+    Returns the (size, name) of each function defined in the object file.
+    """
+    output = subprocess.run(
+        [nm, '--print-size', '--demangle', '--defined-only', path],
+        check = True,
+        capture_output = True,
+        text = True,
+    ).stdout
+
+    symbols = []
+    for line in output.splitlines():
+        fields = line.split(maxsplit = 3)
+        if len(fields) == 4 and fields[2] in _CODE_SYMBOL_TYPES:
+            symbols.append((int(fields[1], 16), fields[3]))
+    return sorted(symbols, key = lambda symbol: symbol[1])
+
+
+def main ():
+    parser = argparse.ArgumentParser(description = __doc__)
+    parser.add_argument(
+        'objects',
+        nargs = '+',
+        help = 'object files to measure',
+    )
+    parser.add_argument('--nm', default = 'nm', help = 'nm executable')
+    parser.add_argument('--budget', required = True, help = 'budget file')
+    parser.add_argument(
+        '--toolchain',
+        default = '',
+        help = 'description of the compiler and target of the objects',
+    )
+    parser.add_argument(
+        '--update',
+        action = 'store_true',
+        help = 'write the current sizes to the budget file instead of checking',
+    )
+    args = parser.parse_args()
+
+    sizes = {}
+    for path in sorted(args.objects, key = _component_name):
+        component = _component_name(path)
+        symbols = _code_symbols(args.nm, path)
+        sizes[component] = sum(size for size, _ in symbols)
+        print(f'{component}: {sizes[component]} bytes')
+        for size, name in symbols:
+            print(f'    {size:6}  {name}')
+
+    if args.update:
+        with open(args.budget, 'w', encoding = 'utf-8') as file:
+            json.dump(
+                {'toolchain': args.toolchain, 'components': sizes},
+                file,
+                indent = 4,
+                sort_keys = True,
+            )
+            file.write('\n')
+        print(f'\nWrote the budget to {args.budget}.')
+        return 0
+
+    with open(args.budget, encoding = 'utf-8') as file:
+        budget = json.load(file)
+
+    if budget.get('toolchain') != args.toolchain:
+        print(
+            f'\nwarning: the budget was recorded with '
+            f'"{budget.get("toolchain")}", not "{args.toolchain}"; '
+            f'sizes may not be comparable.'
+        )
+
+    failures = []
+    print()
+    for component, size in sizes.items():
+        limit = budget['components'].get(component)
+        if limit is None:
+            failures.append(f'{component}: {size} bytes, no budget')
+        elif size > limit:
+            failures.append(
+                f'{component}: {size} bytes, over its budget of {limit} '
+                f'bytes by {size - limit}'
+            )
+        elif size < limit:
+            print(
+                f'{component}: {size} bytes, {limit - size} bytes under its '
+                f'budget; consider lowering it'
+            )
+
+    for failure in failures:
+        print(f'error: {failure}')
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,99 @@
+#! /usr/bin/env python3
+
+"""
+Compares two Google Benchmark JSON result files, such as those written by the
+bench_json target, and reports the benchmarks which got slower.
+
+The median CPU time of each benchmark is compared when the results hold
+aggregates of repetitions, and the mean of its runs otherwise. The script
+exits with status 1 if any benchmark of the baseline slowed down by more than
+the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+_NANOSECONDS_PER_UNIT = {
+    'ns': 1.0,
+    'us': 1e3,
+    'ms': 1e6,
+    's': 1e9,
+}
+
+
+def _load_times (path):
+    """
+    Returns the CPU time of each benchmark in the file, in nanoseconds.
+    """
+    with open(path, encoding = 'utf-8') as file:
+        results = json.load(file)
+
+    medians = {}
+    runs = {}
+    for entry in results.get('benchmarks', []):
+        name = entry.get('run_name', entry['name'])
+        time = entry['cpu_time'] * _NANOSECONDS_PER_UNIT[entry['time_unit']]
+        if entry.get('run_type') == 'aggregate':
+            if entry.get('aggregate_name') == 'median':
+                medians[name] = time
+        else:
+            runs.setdefault(name, []).append(time)
+
+    times = {name: sum(values) / len(values) for name, values in runs.items()}
+    times.update(medians)
+    return times
+
+
+def _format_time (nanoseconds):
+    for unit, scale in (('s', 1e9), ('ms', 1e6), ('us', 1e3)):
+        if nanoseconds >= scale:
+            return f'{nanoseconds / scale:.3g} {unit}'
+    return f'{nanoseconds:.3g} ns'
+
+
+def main ():
+    parser = argparse.ArgumentParser(description = __doc__)
+    parser.add_argument('baseline', help = 'results to compare against')
+    parser.add_argument('current', help = 'results of the current build')
+    parser.add_argument(
+        '--threshold',
+        type = float,
+        default = 0.10,
+        help = 'relative slowdown reported as a regression (default: 0.10)',
+    )
+    args = parser.parse_args()
+
+    baseline = _load_times(args.baseline)
+    current = _load_times(args.current)
+
+    regressions = []
+    width = max((len(name) for name in baseline), default = 0)
+    for name in sorted(baseline):
+        if name not in current:
+            print(f'{name:<{width}}  missing from the current results')
+            continue
+        change = current[name] / baseline[name] - 1.0
+        flag = ''
+        if change > args.threshold:
+            flag = '  REGRESSION'
+            regressions.append(name)
+        print(
+            f'{name:<{width}}  {_format_time(baseline[name]):>10} -> '
+            f'{_format_time(current[name]):>10}  {change:+7.1%}{flag}'
+        )
+
+    for name in sorted(set(current) - set(baseline)):
+        print(f'{name:<{width}}  new, not in the baseline')
+
+    if regressions:
+        print(
+            f'\n{len(regressions)} benchmark(s) slowed down by more than '
+            f'{args.threshold:.0%}.'
+        )
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
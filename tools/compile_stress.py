@@ -0,0 +1,124 @@
+#! /usr/bin/env python3
+
+"""
+Measures how the compile time and memory of a compile-time stress test, such
+as src/exfs/iterator/traits.stress.cpp, grow with the number of types it
+instantiates.
+
+Each stress test is compiled with -fsyntax-only once for each count, with
+STRESS_COUNT defined to that count. The CPU time and peak memory of the
+compiler are reported for each count, along with the marginal cost of each
+type: the growth in time and memory from the smallest to the largest count,
+divided by the number of types added. The check fails if the marginal time
+of a stress test exceeds --max-ms-per-type.
+"""
+
+import argparse
+import json
+import os
+import shlex
+import subprocess
+import sys
+
+
+def _compile (command):
+    """
+    Runs the compiler and returns its CPU time in seconds and its peak
+    resident memory in MiB, including the processes it runs.
+    """
+    process = subprocess.Popen(command)
+    _, status, usage = os.wait4(process.pid, 0)
+    process.returncode = os.waitstatus_to_exitcode(status)
+    if process.returncode != 0:
+        raise subprocess.CalledProcessError(process.returncode, command)
+    return usage.ru_utime + usage.ru_stime, usage.ru_maxrss / 1024.0
+
+
+def main ():
+    parser = argparse.ArgumentParser(description = __doc__)
+    parser.add_argument('sources', nargs = '+', help = 'stress tests')
+    parser.add_argument(
+        '--compiler',
+        default = os.environ.get('CXX', 'c++'),
+        help = 'C++ compiler (default: $CXX or c++)',
+    )
+    parser.add_argument(
+        '--flags',
+        default = '-std=c++20',
+        help = 'compiler flags (default: -std=c++20)',
+    )
+    parser.add_argument(
+        '--include-dir',
+        default = os.path.join(
+            os.path.dirname(os.path.dirname(os.path.abspath(__file__))),
+            'src',
+        ),
+        help = 'include directory of the library',
+    )
+    parser.add_argument(
+        '--counts',
+        type = int,
+        nargs = '+',
+        default = [1, 500, 1000, 2000],
+        help = 'numbers of types to instantiate',
+    )
+    parser.add_argument(
+        '--max-ms-per-type',
+        type = float,
+        help = 'fail if the marginal time per type exceeds this',
+    )
+    parser.add_argument('--json', help = 'also write the results to this file')
+    args = parser.parse_args()
+
+    counts = sorted(set(args.counts))
+    results = {}
+    failures = []
+    for source in args.sources:
+        print(source)
+        print(f'    {"types":>8} {"time":>10} {"memory":>12}')
+        measurements = []
+        for count in counts:
+            seconds, mebibytes = _compile([
+                args.compiler,
+                *shlex.split(args.flags),
+                '-fsyntax-only',
+                f'-I{args.include_dir}',
+                f'-DSTRESS_COUNT={count}',
+                source,
+            ])
+            measurements.append(
+                {'count': count, 'seconds': seconds, 'mebibytes': mebibytes}
+            )
+            print(f'    {count:8} {seconds:8.2f} s {mebibytes:8.1f} MiB')
+
+        first, last = measurements[0], measurements[-1]
+        added = last['count'] - first['count']
+        if added > 0:
+            ms_per_type = 1e3 * (last['seconds'] - first['seconds']) / added
+            kib_per_type = (
+                1024.0 * (last['mebibytes'] - first['mebibytes']) / added
+            )
+            print(
+                f'    marginal cost: {ms_per_type:.3f} ms and '
+                f'{kib_per_type:.1f} KiB per type'
+            )
+            if (args.max_ms_per_type is not None
+                    and ms_per_type > args.max_ms_per_type):
+                failures.append(
+                    f'{source}: {ms_per_type:.3f} ms per type, over the '
+                    f'limit of {args.max_ms_per_type} ms'
+                )
+        results[source] = measurements
+
+    if args.json:
+        with open(args.json, 'w', encoding = 'utf-8') as file:
+            json.dump(results, file, indent = 4)
+            file.write('\n')
+
+    for failure in failures:
+        print(f'error: {failure}')
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
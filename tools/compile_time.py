@@ -0,0 +1,184 @@
+#! /usr/bin/env python3
+
+"""
+Measures and compares the time of full builds of the project in several
+configurations, such as with and without precompiled headers.
+
+Each configuration is configured from scratch in its own build directory
+under the build root, then the target is built and timed. By default, a
+plain build is compared with one using ARCHE_PRECOMPILE_HEADERS; other
+configurations are given as NAME=CMAKE_ARGS, for example
+"module=-DARCHE_BUILD_MODULE=ON -GNinja".
+
+With --time-trace the project is compiled with -ftime-trace (Clang only).
+The time spent in the front and back ends of each build is then reported,
+along with the headers which took the longest to parse across all
+translation units, including the headers they include.
+"""
+
+import argparse
+import json
+import os
+import shlex
+import shutil
+import subprocess
+import sys
+import time
+
+_DEFAULT_CONFIGS = [
+    'plain=',
+    'pch=-DARCHE_PRECOMPILE_HEADERS=ON',
+]
+
+
+def _parse_config (text):
+    name, _, args = text.partition('=')
+    return name, shlex.split(args)
+
+
+def _build (source_dir, build_dir, cmake_args, target, jobs):
+    """
+    Configures and builds the target from scratch, and returns the time the
+    build took in seconds.
+    """
+    shutil.rmtree(build_dir, ignore_errors = True)
+    subprocess.run(
+        ['cmake', '-S', source_dir, '-B', build_dir, *cmake_args],
+        check = True,
+        stdout = subprocess.DEVNULL,
+    )
+    start = time.perf_counter()
+    subprocess.run(
+        [
+            'cmake', '--build', build_dir,
+            '--target', target,
+            '--parallel', str(jobs),
+        ],
+        check = True,
+        stdout = subprocess.DEVNULL,
+    )
+    return time.perf_counter() - start
+
+
+def _time_traces (build_dir):
+    """
+    Yields the events of each time trace written to the build directory.
+    """
+    for root, _, files in os.walk(build_dir):
+        for name in files:
+            if not name.endswith('.json'):
+                continue
+            try:
+                with open(os.path.join(root, name), encoding = 'utf-8') as file:
+                    trace = json.load(file)
+            except (OSError, ValueError):
+                continue
+            if isinstance(trace, dict) and 'traceEvents' in trace:
+                yield trace['traceEvents']
+
+
+def _summarize_traces (build_dir):
+    """
+    Returns the total front end and back end time of the translation units of
+    the build, and the inclusive parse time of each header, in seconds.
+    """
+    totals = {'Total Frontend': 0.0, 'Total Backend': 0.0}
+    headers = {}
+    for events in _time_traces(build_dir):
+        for event in events:
+            name = event.get('name')
+            seconds = event.get('dur', 0) / 1e6
+            if name in totals:
+                totals[name] += seconds
+            elif name == 'Source':
+                path = event.get('args', {}).get('detail', '')
+                headers[path] = headers.get(path, 0.0) + seconds
+    return totals, headers
+
+
+def main ():
+    parser = argparse.ArgumentParser(
+        description = __doc__,
+        formatter_class = argparse.RawDescriptionHelpFormatter,
+    )
+    parser.add_argument(
+        'configs',
+        nargs = '*',
+        help = 'configurations to build, as NAME=CMAKE_ARGS',
+    )
+    parser.add_argument(
+        '--source-dir',
+        default = os.path.dirname(os.path.dirname(os.path.abspath(__file__))),
+        help = 'top-level directory of the project',
+    )
+    parser.add_argument(
+        '--build-root',
+        default = '_compile_time',
+        help = 'directory in which each configuration is built',
+    )
+    parser.add_argument(
+        '--target',
+        default = 'all',
+        help = 'target to build (default: all)',
+    )
+    parser.add_argument(
+        '--jobs',
+        type = int,
+        default = os.cpu_count() or 1,
+        help = 'number of parallel compile jobs',
+    )
+    parser.add_argument(
+        '--time-trace',
+        action = 'store_true',
+        help = 'compile with -ftime-trace and report where the time went',
+    )
+    parser.add_argument(
+        '--top',
+        type = int,
+        default = 15,
+        help = 'number of headers reported with --time-trace',
+    )
+    args = parser.parse_args()
+
+    configs = [_parse_config(text) for text in args.configs or _DEFAULT_CONFIGS]
+
+    results = []
+    for name, cmake_args in configs:
+        if args.time_trace:
+            cmake_args = [*cmake_args, '-DCMAKE_CXX_FLAGS=-ftime-trace']
+        build_dir = os.path.join(args.build_root, name)
+        print(f'Building {name}...', flush = True)
+        seconds = _build(
+            args.source_dir,
+            build_dir,
+            cmake_args,
+            args.target,
+            args.jobs,
+        )
+        results.append((name, build_dir, seconds))
+
+    print()
+    baseline = results[0][2]
+    for name, _, seconds in results:
+        print(f'{name:<16} {seconds:8.2f} s  {seconds / baseline - 1.0:+7.1%}')
+
+    if not args.time_trace:
+        return 0
+
+    for name, build_dir, _ in results:
+        totals, headers = _summarize_traces(build_dir)
+        if not headers:
+            print(f'\n{name}: no time traces found; -ftime-trace needs Clang')
+            continue
+        print(
+            f'\n{name}: front end {totals["Total Frontend"]:.2f} s, '
+            f'back end {totals["Total Backend"]:.2f} s'
+        )
+        ranked = sorted(headers.items(), key = lambda item: -item[1])
+        for path, seconds in ranked[:args.top]:
+            print(f'    {seconds:8.2f} s  {path}')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())